@@ -5,10 +5,14 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Framework/App.hpp"
 
+#include <algorithm>
+#include <filesystem>
+
 #include "Engine/Audio/AudioSystem.hpp"
 #include "Engine/Core/Clock.hpp"
 #include "Engine/Core/DevConsole.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/Image.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
@@ -17,7 +21,25 @@
 #include "Engine/Platform/Window.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Game/Gameplay/Game.hpp"
+#include "Game/Framework/FrameProfiler.hpp"
+#include "Game/Framework/GameEventBus.hpp"
+#include "Game/Framework/GameEvents.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/AssetRegistry.hpp"
+#include "Game/Framework/AudioDevice.hpp"
+#include "Game/Framework/AudioService.hpp"
+#include "Game/Framework/AudioStream.hpp"
+#include "Game/Framework/DebugDrawBatch.hpp"
+#include "Game/Framework/PipelineState.hpp"
+#include "Game/Framework/RenderDevice.hpp"
+#include "Game/Framework/RenderDevice_Software.hpp"
+#include "Game/Framework/RetainedDebugText.hpp"
+#include "Game/Framework/ShaderCache.hpp"
+#include "Game/Framework/ShapeTessellation.hpp"
+#include "Game/Framework/SoftwareRasterizer.hpp"
+#include "Game/Framework/TextMesh.hpp"
+#include "Game/Framework/WindowBackend.hpp"
+#include "Game/Framework/WindowBackend_Headless.hpp"
 
 //----------------------------------------------------------------------------------------------------
 App*                   g_theApp        = nullptr;       // Created and owned by Main_Windows.cpp
@@ -27,13 +49,26 @@ Game*                  g_theGame       = nullptr;       // Created and owned by
 Renderer*              g_theRenderer   = nullptr;       // Created and owned by the App
 RandomNumberGenerator* g_theRNG        = nullptr;       // Created and owned by the App
 Window*                g_theWindow     = nullptr;       // Created and owned by the App
-std::vector<HWND>      g_gameWindows;
+
+//----------------------------------------------------------------------------------------------------
+// Only headless runs create one; it draws into the HeadlessWindowBackend's surfaces.
+//
+static SoftwareRenderDevice* GetSoftwareRenderDevice()
+{
+    if (g_theRenderDevice == nullptr || g_theRenderDevice->GetType() != eRenderDeviceType::SOFTWARE)
+    {
+        return nullptr;
+    }
+
+    return static_cast<SoftwareRenderDevice*>(g_theRenderDevice);
+}
 
 //----------------------------------------------------------------------------------------------------
 STATIC bool App::m_isQuitting = false;
 
-App::App(HINSTANCE const& hInstance)
-    : m_hInstance(hInstance)
+App::App(sAppConfig const& config)
+    : m_config(config),
+      m_frameScheduler(config.m_frameSchedulerConfig)
 {
 }
 
@@ -48,6 +83,33 @@ void App::Startup()
     g_theEventSystem = new EventSystem(eventSystemConfig);
     g_theEventSystem->SubscribeEventCallbackFunction("OnCloseButtonClicked", OnWindowClose);
     g_theEventSystem->SubscribeEventCallbackFunction("quit", OnWindowClose);
+    g_theEventSystem->SubscribeEventCallbackFunction("ProfilerStart", OnProfilerStart);
+    g_theEventSystem->SubscribeEventCallbackFunction("ProfilerStop", OnProfilerStop);
+    g_theEventSystem->SubscribeEventCallbackFunction("ProfilerDump", OnProfilerDump);
+    g_theEventSystem->SubscribeEventCallbackFunction("WindowTransformStats", OnWindowTransformStats);
+    g_theEventSystem->SubscribeEventCallbackFunction("BenchmarkWindowDrift", OnBenchmarkWindowDrift);
+    g_theEventSystem->SubscribeEventCallbackFunction("PipelineStateStats", OnPipelineStateStats);
+    g_theEventSystem->SubscribeEventCallbackFunction("DebugDrawBatchStats", OnDebugDrawBatchStats);
+    g_theEventSystem->SubscribeEventCallbackFunction("DebugTextStats", OnDebugTextStats);
+    g_theEventSystem->SubscribeEventCallbackFunction("AssetLookupStats", OnAssetLookupStats);
+    g_theEventSystem->SubscribeEventCallbackFunction("AssetPreloadStats", OnAssetPreloadStats);
+    g_theEventSystem->SubscribeEventCallbackFunction("ShaderCacheStats", OnShaderCacheStats);
+    g_theEventSystem->SubscribeEventCallbackFunction("AudioStats", OnAudioStats);
+    g_theEventSystem->SubscribeEventCallbackFunction("PlayStream", OnPlayStream);
+    g_theEventSystem->SubscribeEventCallbackFunction("StopStream", OnStopStream);
+    g_theEventSystem->SubscribeEventCallbackFunction("AudioStreamStats", OnAudioStreamStats);
+    g_theEventSystem->SubscribeEventCallbackFunction("BenchmarkEvents", OnBenchmarkEvents);
+    g_theEventSystem->SubscribeEventCallbackFunction("BenchmarkTextMesh", OnBenchmarkTextMesh);
+    g_theEventSystem->SubscribeEventCallbackFunction("BenchmarkShapes", OnBenchmarkShapeTessellation);
+    g_theEventSystem->SubscribeEventCallbackFunction("OnWindowSizeChanged", OnWindowSizeChanged);
+    g_theEventSystem->SubscribeEventCallbackFunction("WindowEventStats", OnWindowEventStats);
+    g_theEventSystem->SubscribeEventCallbackFunction("RecordInput", OnRecordInput);
+    g_theEventSystem->SubscribeEventCallbackFunction("StopRecordInput", OnStopRecordInput);
+    g_theEventSystem->SubscribeEventCallbackFunction("SoftwareRasterStats", OnSoftwareRasterStats);
+    g_theEventSystem->SubscribeEventCallbackFunction("BenchmarkSoftwareRaster", OnBenchmarkSoftwareRaster);
+
+    // Events fired from code go through the typed bus; the string EventSystem stays for the console.
+    g_theGameEventBus = new GameEventBus();
 
     //-End-of-EventSystem-----------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
@@ -58,6 +120,60 @@ void App::Startup()
 
     //-End-of-InputSystem-----------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
+    //-Start-of-WindowBackend-------------------------------------------------------------------------
+
+    g_theWindowBackend = WindowBackend::Create(m_config.m_windowBackendType, m_config.m_applicationInstanceHandle);
+    g_theWindowBackend->SetPresentMode(m_config.m_windowPresentMode);
+
+    //-End-of-WindowBackend---------------------------------------------------------------------------
+    //------------------------------------------------------------------------------------------------
+    // Headless runs have no display, device or sound card; only the simulation-side subsystems exist.
+    if (IsHeadless())
+    {
+        g_theEventSystem->Startup();
+        g_theInput->Startup();
+        g_theWindowBackend->Startup();
+
+        g_theAudioService = new AudioService(AudioDevice::Create(eAudioDeviceType::NULL_DEVICE));
+        g_theAudioService->Startup();
+
+        sAudioStreamerConfig streamerConfig;
+        streamerConfig.m_outputType = eAudioStreamOutputType::NULL_OUTPUT;
+        g_theAudioStreamer          = new AudioStreamer(streamerConfig);
+        g_theAudioStreamer->Startup();
+
+        // The software rasterizer draws each window's real frame into its in-memory surface.
+        if (m_config.m_isSoftwareRasterEnabled)
+        {
+            g_theRenderDevice       = new SoftwareRenderDevice(m_config.m_softwareRasterizerConfig);
+            g_thePipelineStateCache = new PipelineStateCache();
+            g_theDebugDrawBatch     = new DebugDrawBatch();
+
+            // There is no Renderer to intern through, so every asset Game and RetainedDebugText bind is
+            // registered first; the shader is ignored by the software device anyway.
+            g_theAssetRegistry = new AssetRegistry();
+            g_theAssetRegistry->RegisterShader(ASSET_SHADER_DEFAULT, nullptr);
+            RegisterRasterTexture(ASSET_TEXTURE_GOOP);
+            RegisterRasterTexture(ASSET_TEXTURE_SERENITY);
+            RegisterRasterTexture(ASSET_TEXTURE_SQUIRREL_FIXED_FONT);
+
+            sTextureHandle const fontTexture = g_theAssetRegistry->InternTexture(ASSET_TEXTURE_SQUIRREL_FIXED_FONT);
+            g_theRetainedDebugText           = new RetainedDebugText(g_theAssetRegistry->GetTexture(fontTexture), g_theAssetRegistry->GetTextureKey(fontTexture));
+            CreateDebugDrawPipelineState();
+
+            static_cast<HeadlessWindowBackend*>(g_theWindowBackend)->m_areSurfacesRendered = true;
+        }
+
+        g_theRNG  = new RandomNumberGenerator();
+        g_theGame = new Game();
+        g_theGame->SetFixedTimestep(m_config.m_fixedTimestepSeconds);
+
+        StartInputRecordingAndReplay();
+        CreateAndRegisterMultipleWindows(windows, m_config.m_initialWindowCount);
+        m_frameScheduler.Startup();
+        return;
+    }
+
     //-Start-of-Window--------------------------------------------------------------------------------
 
     sWindowConfig windowConfig;
@@ -75,6 +191,7 @@ void App::Startup()
     sRenderConfig renderConfig;
     renderConfig.m_window = g_theWindow;
     g_theRenderer         = new Renderer(renderConfig);
+    g_theRenderDevice     = RenderDevice::Create(eRenderDeviceType::ENGINE);
 
     //-End-of-Renderer--------------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
@@ -109,6 +226,26 @@ void App::Startup()
     g_theAudio = new AudioSystem(audioConfig);
 
     //-End-of-AudioSystem-----------------------------------------------------------------------------
+    //------------------------------------------------------------------------------------------------
+    //-Start-of-AssetPreload--------------------------------------------------------------------------
+
+    // Workers warm the file cache while the subsystems below start up; creation waits for the Renderer.
+    g_theAssetRegistry = new AssetRegistry();
+    g_theShaderCache   = new ShaderCache();
+
+    // Before the manifest, so atlased textures resolve to their pages. The lookup exists only once
+    // -bakeatlas output is in Data/Images; without it every texture stands alone.
+    if (std::filesystem::exists("Data/Images/Atlas.txt") && !g_theAssetRegistry->LoadTextureAtlas("Data/Images/Atlas.txt"))
+    {
+        DebuggerPrintf("AssetRegistry: Data/Images/Atlas.txt exists but could not be loaded\n");
+    }
+
+    if (m_assetPreloader.LoadManifest("Data/AssetManifest.txt"))
+    {
+        m_assetPreloader.Start(static_cast<int>(std::thread::hardware_concurrency()) - 1);
+    }
+
+    //-End-of-AssetPreload----------------------------------------------------------------------------
 
     g_theEventSystem->Startup();
     g_theWindow->Startup();
@@ -117,12 +254,40 @@ void App::Startup()
     g_theDevConsole->StartUp();
     g_theInput->Startup();
     g_theAudio->Startup();
+    g_theWindowBackend->Startup();
+
+    g_theAudioService = new AudioService(AudioDevice::Create(eAudioDeviceType::ENGINE));
+    g_theAudioService->Startup();
+
+    g_theAudioStreamer = new AudioStreamer();
+    g_theAudioStreamer->Startup();
+
+    m_assetPreloader.FinishLoading();
+
+    sAssetPreloadStats const& preloadStats = m_assetPreloader.GetStats();
+    DebuggerPrintf("AssetPreloader: %d assets on %d warm-up workers in %.3fs (critical path %.3fs, file reads %.3fs, main-thread creation %.3fs)\n",
+                   preloadStats.m_entryCount, preloadStats.m_workerCount, preloadStats.m_wallSeconds,
+                   preloadStats.GetCriticalPathSeconds(), preloadStats.m_warmSeconds, preloadStats.m_createSeconds);
+
+    g_theBitmapFont         = g_theAssetRegistry->GetFont(g_theAssetRegistry->InternFont(ASSET_FONT_SQUIRREL_FIXED));
+    g_thePipelineStateCache = new PipelineStateCache();
+    g_theDebugDrawBatch     = new DebugDrawBatch();
+    g_theRetainedDebugText  = new RetainedDebugText(&g_theBitmapFont->GetTexture(), ASSET_TEXTURE_SQUIRREL_FIXED_FONT.m_hash);
+    g_theRNG                = new RandomNumberGenerator();
+    g_theGame               = new Game();
+    g_theGame->SetFixedTimestep(m_config.m_fixedTimestepSeconds);
 
-    g_theBitmapFont = g_theRenderer->CreateOrGetBitmapFontFromFile("Data/Fonts/SquirrelFixedFont"); // DO NOT SPECIFY FILE .EXTENSION!!  (Important later on.)
-    g_theRNG        = new RandomNumberGenerator();
-    g_theGame       = new Game();
+    CreateDebugDrawPipelineState();
+    StartInputRecordingAndReplay();
+    CreateAndRegisterMultipleWindows(windows, m_config.m_initialWindowCount);
+    m_frameScheduler.Startup();
 
-    CreateAndRegisterMultipleWindows(windows, m_hInstance, 2);
+    sShaderCacheStats const& shaderCacheStats = g_theShaderCache->GetStats();
+    DebuggerPrintf("ShaderCache: %d created in %.3fs, %d reused\n",
+                   shaderCacheStats.m_createCount, shaderCacheStats.m_createSeconds, shaderCacheStats.m_reuseCount);
+
+    // Every asset the game uses is interned by now; any later path lookup is reported.
+    g_theAssetRegistry->SealStartup();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -130,15 +295,52 @@ void App::Startup()
 //
 void App::Shutdown()
 {
-    for (Window& window : windows)
+    m_frameScheduler.Shutdown();
+    m_inputRecorder.Stop();
+
+    for (int windowIndex = 0; windowIndex < windows.GetCount(); ++windowIndex)
     {
-        if (window.m_displayContext) ReleaseDC((HWND)window.m_windowHandle, (HDC)window.m_displayContext);
+        g_theWindowBackend->DestroyChildWindow(windows.GetWindowAt(windowIndex));
     }
 
+    windows.Clear();
+    m_windowCreationOrder.clear();
+
     // Destroy all Engine Subsystem
     GAME_SAFE_RELEASE(g_theGame);
     GAME_SAFE_RELEASE(g_theRNG);
+    GAME_SAFE_RELEASE(g_theGameEventBus);
+
+    g_theWindowBackend->Shutdown();
+
+    // Stops every voice through the device, so it goes before the AudioSystem it may be driving.
+    g_theAudioService->Shutdown();
+    GAME_SAFE_RELEASE(g_theAudioService);
+    g_theAudioStreamer->Shutdown();
+    GAME_SAFE_RELEASE(g_theAudioStreamer);
+
+    if (IsHeadless())
+    {
+        g_theInput->Shutdown();
+        g_theEventSystem->Shutdown();
+
+        GAME_SAFE_RELEASE(g_theRetainedDebugText);
+        GAME_SAFE_RELEASE(g_theAssetRegistry);
+        GAME_SAFE_RELEASE(g_theDebugDrawBatch);
+        GAME_SAFE_RELEASE(g_thePipelineStateCache);
+        GAME_SAFE_RELEASE(g_theRenderDevice);
+        GAME_SAFE_RELEASE(g_theWindowBackend);
+        m_rasterTextures.clear();
+        GAME_SAFE_RELEASE(g_theInput);
+        return;
+    }
+
+    GAME_SAFE_RELEASE(g_theRetainedDebugText);
     GAME_SAFE_RELEASE(g_theBitmapFont);
+    GAME_SAFE_RELEASE(g_theDebugDrawBatch);
+    GAME_SAFE_RELEASE(g_thePipelineStateCache);
+    GAME_SAFE_RELEASE(g_theAssetRegistry);
+    GAME_SAFE_RELEASE(g_theShaderCache);
 
     g_theAudio->Shutdown();
     g_theInput->Shutdown();
@@ -152,8 +354,10 @@ void App::Shutdown()
     g_theEventSystem->Shutdown();
 
     GAME_SAFE_RELEASE(g_theAudio);
+    GAME_SAFE_RELEASE(g_theRenderDevice);
     GAME_SAFE_RELEASE(g_theRenderer);
     GAME_SAFE_RELEASE(g_theWindow);
+    GAME_SAFE_RELEASE(g_theWindowBackend);
     GAME_SAFE_RELEASE(g_theInput);
 }
 
@@ -162,10 +366,19 @@ void App::Shutdown()
 //
 void App::RunFrame()
 {
-    BeginFrame();   // Engine pre-frame stuff
-    Update();       // Game updates / moves / spawns / hurts / kills stuff
-    Render();       // Game draws current state of things
-    EndFrame();     // Engine post-frame stuff
+    PROFILE_SCOPE_INDEXED("App::RunFrame", m_frameCount);
+
+    PROFILE_CALL("App::BeginFrame", BeginFrame());     // Engine pre-frame stuff
+    PROFILE_CALL("App::Update", Update());             // Game updates / moves / spawns / hurts / kills stuff
+    PROFILE_CALL("App::Render", Render());             // Game draws current state of things
+    PROFILE_CALL("App::EndFrame", EndFrame());         // Engine post-frame stuff
+
+    ++m_frameCount;
+
+    if (m_config.m_maxFrameCount > 0 && m_frameCount >= m_config.m_maxFrameCount)
+    {
+        RequestQuit();
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -174,11 +387,29 @@ void App::RunMainLoop()
     // Program main loop; keep running frames until it's time to quit
     while (!m_isQuitting)
     {
-        // Sleep(16); // Temporary code to "slow down" our app to ~60Hz until we have proper frame timing in
         RunFrame();
+        PROFILE_CALL("FrameScheduler::WaitForNextFrame", m_frameScheduler.WaitForNextFrame());
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+FrameScheduler const& App::GetFrameScheduler() const
+{
+    return m_frameScheduler;
+}
+
+//----------------------------------------------------------------------------------------------------
+WindowTransformBatch& App::GetWindowTransforms()
+{
+    return m_windowTransforms;
+}
+
+//----------------------------------------------------------------------------------------------------
+int App::GetFrameCount() const
+{
+    return m_frameCount;
+}
+
 //----------------------------------------------------------------------------------------------------
 STATIC bool App::OnWindowClose(EventArgs& args)
 {
@@ -195,154 +426,1073 @@ STATIC void App::RequestQuit()
     m_isQuitting = true;
 }
 
-void App::AddWindow(HWND const& hwnd)
+//----------------------------------------------------------------------------------------------------
+STATIC bool App::OnProfilerStart(EventArgs& args)
 {
-    sWindowConfig config;
-    Window        window    = Window(config);
-    window.m_windowHandle   = hwnd;
-    window.m_displayContext = GetDC(hwnd);
-    window.needsUpdate      = true;
+    UNUSED(args)
+
+    FrameProfiler::StartCapture();
 
-    // UpdateWindowPosition(window);
-    HRESULT hr = g_theRenderer->CreateWindowSwapChain(window);
-    windows.push_back(window);
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------
-void App::BeginFrame() const
+STATIC bool App::OnProfilerStop(EventArgs& args)
 {
-    g_theEventSystem->BeginFrame();
-    g_theWindow->BeginFrame();
-    g_theRenderer->BeginFrame();
-    DebugRenderBeginFrame();
-    g_theDevConsole->BeginFrame();
-    g_theInput->BeginFrame();
-    g_theAudio->BeginFrame();
+    UNUSED(args)
+
+    FrameProfiler::StopCapture();
+
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------
-void App::Update()
+// Usage: ProfilerDump file=<path>   (defaults to FrameProfile.json in the working directory)
+//
+STATIC bool App::OnProfilerDump(EventArgs& args)
 {
-    Clock::TickSystemClock();
+    String const filePath = args.GetValue("file", "FrameProfile.json");
 
-    if (g_theInput->WasKeyJustPressed(KEYCODE_Z))
+    FrameProfiler::WriteChromeTrace(filePath);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Reports the last frame's window transform batch, and the totals since startup.
+//
+STATIC bool App::OnWindowTransformStats(EventArgs& args)
+{
+    UNUSED(args)
+
+    sWindowTransformStats const& frameStats = g_theApp->m_windowTransforms.GetLastFrameStats();
+    sWindowTransformStats const& totalStats = g_theApp->m_windowTransforms.GetTotalStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Last frame: requests=%u windows=%u commits=%u saved=%u",
+                                                             frameStats.m_requestCount, frameStats.m_committedWindowCount,
+                                                             frameStats.m_platformCommitCount, frameStats.GetSavedPlatformCommitCount()));
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Total:      requests=%u windows=%u commits=%u saved=%u",
+                                                             totalStats.m_requestCount, totalStats.m_committedWindowCount,
+                                                             totalStats.m_platformCommitCount, totalStats.GetSavedPlatformCommitCount()));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Blocks for a few seconds; compares per-object drift with the SoA kernels at 10 / 1k / 100k windows.
+//
+STATIC bool App::OnBenchmarkWindowDrift(EventArgs& args)
+{
+    UNUSED(args)
+
+    std::vector<sWindowDriftBenchmarkResult> results;
+    RunWindowDriftBenchmark(results);
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Window drift, ns per window (SIMD kernel: %s)", GetWindowDriftKernelName()));
+
+    for (sWindowDriftBenchmarkResult const& result : results)
     {
-        CreateAndRegisterMultipleWindows(windows, m_hInstance, 1);
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%6d windows: per-object %.3f  scalar SoA %.3f  SIMD SoA %.3f",
+                                                                 result.m_windowCount, result.m_perObjectNanoseconds,
+                                                                 result.m_scalarSoANanoseconds, result.m_simdSoANanoseconds));
     }
 
-    UpdateCursorMode();
-    for (Window& window : windows)
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Blocks for well under a second; compares the string EventArgs path with the typed GameEventBus.
+//
+STATIC bool App::OnBenchmarkEvents(EventArgs& args)
+{
+    UNUSED(args)
+
+    std::vector<sGameEventBenchmarkResult> results;
+    RunGameEventBenchmark(results);
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MAJOR, "KeyPressed event, ns per fire");
+
+    for (sGameEventBenchmarkResult const& result : results)
     {
-        window.UpdateWindowDrift((float)Clock::GetSystemClock().GetDeltaSeconds() * 1.5f);
-        window.UpdateWindowPosition();
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%d subscribers: EventArgs %.1f  typed %.1f",
+                                                                 result.m_subscriberCount, result.m_stringNanoseconds, result.m_typedNanoseconds));
     }
 
-    UpdateWindowsResizeIfNeeded(windows);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Blocks for several seconds; compares BitmapFont::AddVertsForText2D with the bulk text mesh builder.
+//
+STATIC bool App::OnBenchmarkTextMesh(EventArgs& args)
+{
+    UNUSED(args)
+
+    std::vector<sTextMeshBenchmarkResult> results;
+    RunTextMeshBenchmark(g_theBitmapFont, results);
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Text mesh, million glyphs per second (SIMD kernel: %s)", GetTextMeshKernelName()));
+
+    for (sTextMeshBenchmarkResult const& result : results)
+    {
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%-8s %d glyphs: BitmapFont %.1f  scalar %.1f  SIMD %.1f",
+                                                                 result.m_caseName, result.m_glyphCount, result.m_bitmapFontGlyphsPerSecond * 1e-6,
+                                                                 result.m_scalarGlyphsPerSecond * 1e-6, result.m_simdGlyphsPerSecond * 1e-6));
+    }
 
-    g_theGame->Update();
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------
-// Some simple OpenGL example drawing code.
-// This is the graphical equivalent of printing "Hello, world."
+// Blocks for a few seconds; compares the old per-segment trig loops with the unit-circle tables.
 //
-// Ultimately this function (App::Render) will only call methods on Renderer (like Renderer::DrawVertexArray)
-//	to draw things, never calling OpenGL (nor DirectX) functions directly.
+STATIC bool App::OnBenchmarkShapeTessellation(EventArgs& args)
+{
+    UNUSED(args)
+
+    std::vector<sShapeTessellationBenchmarkResult> results;
+    RunShapeTessellationBenchmark(results);
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Shape tessellation, million verts per second (SIMD kernel: %s)", GetShapeTessellationKernelName()));
+
+    for (sShapeTessellationBenchmarkResult const& result : results)
+    {
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%-5s %d x %d segments: trig %.1f  table scalar %.1f  table SIMD %.1f",
+                                                                 result.m_shapeName, result.m_shapeCount, result.m_segmentCount,
+                                                                 result.m_trigVertsPerSecond * 1e-6, result.m_tableScalarVertsPerSecond * 1e-6,
+                                                                 result.m_tableSIMDVertsPerSecond * 1e-6));
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The one place the engine's string resize event is parsed; everything downstream gets the payload.
 //
-void App::Render() const
+STATIC bool App::OnWindowSizeChanged(EventArgs& args)
 {
-    g_theRenderer->ClearScreen(Rgba8::BLUE);
-    g_theGame->Render();
-    g_theRenderer->Render();
-    RenderWindows(windows); // 安全地呼叫，不會改變狀態
+    sWindowSizeChangedEvent event;
+    event.m_newDimensions = IntVec2(args.GetValue("newWidth", -1), args.GetValue("newHeight", -1));
 
-    AABB2 const box = AABB2(Vec2::ZERO, Vec2(1600.f, 30.f));
+    g_theGameEventBus->Fire(event);
 
-    g_theDevConsole->Render(box);
+    return false;
 }
 
 //----------------------------------------------------------------------------------------------------
-void App::EndFrame() const
+// Child window input since startup: ring pressure and message-handled-to-drained latency, which is
+// bounded by one frame unless the ring overflowed.
+//
+STATIC bool App::OnWindowEventStats(EventArgs& args)
 {
-    g_theEventSystem->EndFrame();
-    g_theWindow->EndFrame();
-    g_theRenderer->EndFrame();
-    DebugRenderEndFrame();
-    g_theDevConsole->EndFrame();
-    g_theInput->EndFrame();
-    g_theAudio->EndFrame();
+    UNUSED(args)
+
+    sWindowEventStats const stats = g_theWindowBackend->GetWindowEventStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Window events: posted=%llu dropped=%llu drained=%llu  latency avg %.3fms max %.3fms",
+                                                             static_cast<unsigned long long>(stats.m_postedCount), static_cast<unsigned long long>(stats.m_droppedCount),
+                                                             static_cast<unsigned long long>(stats.m_drainedCount),
+                                                             stats.GetAverageLatencySeconds() * 1000.0, stats.m_maxLatencySeconds * 1000.0));
+
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------
-void App::UpdateCursorMode()
+// Usage: RecordInput file=<path>
+// Records from the next frame on; replay the log with the headless build's -replay=<path>. The log
+// carries the session's drift seed, but the startup windows have already rolled theirs by now, so
+// window drift in a console recording does not replay exactly.
+//
+STATIC bool App::OnRecordInput(EventArgs& args)
 {
-    bool const doesWindowHasFocus   = GetActiveWindow() == g_theWindow->GetWindowHandle();
-    bool const isAttractState       = g_theGame->GetCurrentGameState() == eGameState::ATTRACT;
-    bool const shouldUsePointerMode = !doesWindowHasFocus || g_theDevConsole->IsOpen() || isAttractState;
+    String const filePath = args.GetValue("file", "");
 
-    if (shouldUsePointerMode == true)
+    if (filePath.empty())
     {
-        g_theInput->SetCursorMode(eCursorMode::POINTER);
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, "Usage: RecordInput file=<path>");
+        return false;
     }
-    else
+
+    float const frameDeltaSeconds = g_theApp->m_config.m_fixedTimestepSeconds > 0.f ? g_theApp->m_config.m_fixedTimestepSeconds : 1.f / 60.f;
+
+    if (!g_theApp->m_inputRecorder.Start(filePath, frameDeltaSeconds, g_theApp->m_windowDriftSeed))
     {
-        g_theInput->SetCursorMode(eCursorMode::FPS);
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Could not open %s for writing", filePath.c_str()));
+        return false;
     }
+
+    return true;
 }
 
-void App::UpdateWindows(std::vector<Window>& windows) const
+//----------------------------------------------------------------------------------------------------
+STATIC bool App::OnStopRecordInput(EventArgs& args)
 {
-    for (int i = 0; i < windows.size(); ++i)
-    {
-        if (windows[i].needsResize)
-        {
-            HRESULT hr             = g_theRenderer->ResizeWindowSwapChain(windows[i]);
-            windows[i].needsResize = false;
-            if (FAILED(hr))
-            {
-                DebuggerPrintf("Failed to resize window swap chain: 0x%08X\n", hr);
-                continue;
-            }
-        }
+    UNUSED(args)
 
-        if (windows[i].needsUpdate)
-        {
-            // 使用 DirectX 11 版本渲染
-            // g_theRenderer->RenderViewportToWindowDX11(windows[i]);
-            g_theRenderer->RenderViewportToWindow(windows[i]);
-            // window.needsUpdate = false;
-        }
+    InputRecorder& recorder = g_theApp->m_inputRecorder;
+
+    if (recorder.IsRecording())
+    {
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Recorded %u frames, %llu input records",
+                                                                 recorder.GetFrameCount(), static_cast<unsigned long long>(recorder.GetRecordCount())));
+        recorder.Stop();
     }
+
+    return true;
 }
 
-void App::RenderWindows(const std::vector<Window>& windows) const
+//----------------------------------------------------------------------------------------------------
+// Reports last frame's software rasterizer work; only a headless -softraster run has one.
+//
+STATIC bool App::OnSoftwareRasterStats(EventArgs& args)
 {
-    for (const Window& window : windows)
+    UNUSED(args)
+
+    SoftwareRenderDevice const* softwareDevice = GetSoftwareRenderDevice();
+
+    if (softwareDevice == nullptr)
     {
-        if (window.needsUpdate)
-        {
-            g_theRenderer->RenderViewportToWindow(window);
-            // g_theRenderer->RenderViewportToWindowDX11(window);
-        }
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, "The software rasterizer is not the active RenderDevice");
+        return true;
     }
+
+    SoftwareRasterizer const&       rasterizer = softwareDevice->GetRasterizer();
+    sSoftwareRasterizerStats const& stats      = rasterizer.GetLastFrameStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Last frame (%s, %d threads): flushes=%u draws=%u triangles=%u culled=%u binEntries=%u tiles=%u pixels=%llu shade=%.3fms",
+                                                             GetSoftwareRasterizerKernelName(), rasterizer.GetThreadCount(),
+                                                             stats.m_flushCount, stats.m_drawCount, stats.m_triangleCount, stats.m_culledTriangleCount,
+                                                             stats.m_binEntryCount, stats.m_tileCount, static_cast<unsigned long long>(stats.m_pixelCount),
+                                                             stats.m_flushSeconds * 1000.0));
+
+    return true;
 }
 
-void App::UpdateWindowsResizeIfNeeded(std::vector<Window>& windows)
+//----------------------------------------------------------------------------------------------------
+STATIC bool App::OnBenchmarkSoftwareRaster(EventArgs& args)
 {
-    for (Window& window : windows)
-    {
-        if (window.needsResize)
-        {
-            HRESULT hr         = g_theRenderer->ResizeWindowSwapChain(window);
-            window.needsResize = false;
+    UNUSED(args)
 
-            if (FAILED(hr))
-            {
-                DebuggerPrintf("Failed to resize window swap chain: 0x%08X\n", hr);
-                continue;
-            }
+    std::vector<sSoftwareRasterizerBenchmarkResult> results;
+    RunSoftwareRasterizerBenchmark(results);
 
-            window.needsUpdate = true;
-        }
+    g_theDevConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Software rasterizer, ms per frame (SIMD kernel: %s)", GetSoftwareRasterizerKernelName()));
+
+    for (sSoftwareRasterizerBenchmarkResult const& result : results)
+    {
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%-9s %dx%d, %d triangles: scalar %.2f  SIMD %.2f  SIMD x%d threads %.2f  identical=%d",
+                                                                 result.m_sceneName, result.m_targetDimensions.x, result.m_targetDimensions.y, result.m_triangleCount,
+                                                                 result.m_scalarMillisecondsPerFrame, result.m_simdMillisecondsPerFrame,
+                                                                 result.m_threadCount, result.m_threadedMillisecondsPerFrame, result.m_isOutputIdentical ? 1 : 0));
     }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Reports last frame's pipeline state traffic: how many Renderer state calls were made versus elided.
+//
+STATIC bool App::OnPipelineStateStats(EventArgs& args)
+{
+    UNUSED(args)
+
+    sPipelineStateStats const& stats = g_thePipelineStateCache->GetLastFrameStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Last frame: binds=%u stateChangesIssued=%u stateChangesSkipped=%u",
+                                                             stats.m_bindCount, stats.m_stateChangesIssued, stats.m_stateChangesSkipped));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Reports last frame's DebugDraw* traffic: primitives submitted versus draw calls they cost.
+//
+STATIC bool App::OnDebugDrawBatchStats(EventArgs& args)
+{
+    UNUSED(args)
+
+    sDebugDrawBatchStats const& stats = g_theDebugDrawBatch->GetLastFrameStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Last frame: submissions=%u verts=%u drawCalls=%u",
+                                                             stats.m_submissionCount, stats.m_vertexCount, stats.m_drawCallCount));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Reports last frame's retained text updates: how many glyphs were regenerated versus kept.
+//
+STATIC bool App::OnDebugTextStats(EventArgs& args)
+{
+    UNUSED(args)
+
+    sRetainedDebugTextStats const& stats = g_theRetainedDebugText->GetLastFrameStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Last frame: updates=%u glyphsRebuilt=%u glyphsUnchanged=%u uploads=%u",
+                                                             stats.m_updateCount, stats.m_glyphsRebuilt, stats.m_glyphsUnchanged, stats.m_uploadCount));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Reports path-based asset lookups; any made after startup are hot-path string lookups to remove.
+//
+STATIC bool App::OnAssetLookupStats(EventArgs& args)
+{
+    UNUSED(args)
+
+    sAssetLookupStats const& stats = g_theAssetRegistry->GetStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Asset lookups: interned=%u afterStartup=%u",
+                                                             stats.m_internCount, stats.m_lateLookupCount));
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Texture atlas: pages=%d regions=%d",
+                                                             g_theAssetRegistry->GetTextureAtlas().GetPageCount(), g_theAssetRegistry->GetTextureAtlas().GetRegionCount()));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Startup preload timing: wall time against the critical path (the best any worker count could do),
+// the file reads the workers overlapped with startup, and the decode + creation left on the main thread.
+//
+STATIC bool App::OnAssetPreloadStats(EventArgs& args)
+{
+    UNUSED(args)
+
+    sAssetPreloadStats const& stats = g_theApp->m_assetPreloader.GetStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Preload: %d assets (%d failed), %llu bytes warmed, %d workers",
+                                                             stats.m_entryCount, stats.m_failedEntryCount, static_cast<unsigned long long>(stats.m_bytesWarmed), stats.m_workerCount));
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  wall %.3fs  criticalPath %.3fs  fileRead %.3fs  mainThreadCreate %.3fs",
+                                                             stats.m_wallSeconds, stats.GetCriticalPathSeconds(), stats.m_warmSeconds, stats.m_createSeconds));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool App::OnShaderCacheStats(EventArgs& args)
+{
+    UNUSED(args)
+
+    sShaderCacheStats const& stats = g_theShaderCache->GetStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Shader cache: created=%d reused=%d reuseRate=%.0f%%",
+                                                             stats.m_createCount, stats.m_reuseCount, 100.f * stats.GetReuseRate()));
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  create %.3fs", stats.m_createSeconds));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Audio command traffic since startup: queue pressure, game-to-audio-thread latency and voice churn.
+//
+STATIC bool App::OnAudioStats(EventArgs& args)
+{
+    UNUSED(args)
+
+    sAudioServiceStats const stats = g_theAudioService->GetStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Audio commands: posted=%llu dropped=%llu processed=%llu queueDepth=%u maxQueueDepth=%u",
+                                                             static_cast<unsigned long long>(stats.m_commandsPosted), static_cast<unsigned long long>(stats.m_commandsDropped),
+                                                             static_cast<unsigned long long>(stats.m_commandsProcessed), stats.m_queueDepth, stats.m_maxQueueDepth));
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  latency avg %.3fms max %.3fms  voices active=%d started=%llu stolen=%llu rejected=%llu",
+                                                             stats.m_averageLatencySeconds * 1000.0, stats.m_maxLatencySeconds * 1000.0, stats.m_activeVoiceCount,
+                                                             static_cast<unsigned long long>(stats.m_voicesStarted), static_cast<unsigned long long>(stats.m_voicesStolen),
+                                                             static_cast<unsigned long long>(stats.m_voicesRejected)));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Usage: PlayStream file=<path> loop=<bool> volume=<float>
+// Streams a long track instead of decoding it up front; replaces the previous console stream.
+//
+STATIC bool App::OnPlayStream(EventArgs& args)
+{
+    String const filePath = args.GetValue("file", "");
+    bool const   isLooped = args.GetValue("loop", false);
+    float const  volume   = args.GetValue("volume", 1.f);
+
+    if (filePath.empty())
+    {
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, "Usage: PlayStream file=<path> loop=<bool> volume=<float>");
+        return false;
+    }
+
+    g_theAudioStreamer->StopStream(g_theApp->m_consoleStream);
+    g_theApp->m_consoleStream = g_theAudioStreamer->PlayStream(filePath, isLooped, volume);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool App::OnStopStream(EventArgs& args)
+{
+    UNUSED(args)
+
+    g_theAudioStreamer->StopStream(g_theApp->m_consoleStream);
+    g_theApp->m_consoleStream = sAudioStreamHandle();
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Resident bytes stay at ring size per stream however long the track; underruns mean the ring or
+// the refill threshold is too small for the decoder on this machine.
+//
+STATIC bool App::OnAudioStreamStats(EventArgs& args)
+{
+    UNUSED(args)
+
+    sAudioStreamStats const stats = g_theAudioStreamer->GetStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Audio streams: active=%d failed=%d resident=%.1fKB refills=%llu decodedFrames=%llu underrunFrames=%llu",
+                                                             stats.m_activeStreamCount, stats.m_failedOpenCount, static_cast<double>(stats.m_residentBytes) / 1024.0,
+                                                             static_cast<unsigned long long>(stats.m_refillCount), static_cast<unsigned long long>(stats.m_decodedFrameCount),
+                                                             static_cast<unsigned long long>(stats.m_underrunFrameCount)));
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  decode total %.3fms, max refill %.3fms, max start %.3fms",
+                                                             stats.m_totalDecodeSeconds * 1000.0, stats.m_maxRefillSeconds * 1000.0, stats.m_maxStartSeconds * 1000.0));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The Window is constructed in place in its slot, so the backend attaches to its final address.
+//
+sWindowHandle App::AddWindow(void* windowHandle, Vec2 const& position, IntVec2 const& dimensions)
+{
+    sWindowConfig       config;
+    sWindowHandle const handle = windows.Add(config, windowHandle, position, dimensions);
+    Window*             window = windows.Get(handle);
+    window->needsUpdate        = true;
+
+    // Every window drifts in its own random direction until it meets a desktop edge.
+    float const driftSpeed   = std::uniform_real_distribution<float>(WINDOW_DRIFT_MIN_SPEED, WINDOW_DRIFT_MAX_SPEED)(m_windowDriftRNG);
+    float const driftDegrees = std::uniform_real_distribution<float>(0.f, 360.f)(m_windowDriftRNG);
+
+    Vec2 const              driftVelocity = Vec2::MakeFromPolarDegrees(driftDegrees, driftSpeed);
+    sWindowKinematics const kinematics    = windows.GetKinematics();
+    int const               denseIndex    = windows.GetDenseIndex(handle);
+
+    kinematics.m_velocityX[denseIndex] = driftVelocity.x;
+    kinematics.m_velocityY[denseIndex] = driftVelocity.y;
+
+    g_theWindowBackend->AttachChildWindow(*window);
+    m_windowCreationOrder.push_back(handle);
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool App::RemoveWindow(sWindowHandle const handle)
+{
+    Window* window = windows.Get(handle);
+
+    if (window == nullptr)
+    {
+        return false;
+    }
+
+    g_theWindowBackend->DestroyChildWindow(*window);
+
+    return windows.Remove(handle);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Dense order is shuffled by every swap-and-pop removal, so age comes from m_windowCreationOrder.
+//
+bool App::RemoveOldestWindow()
+{
+    while (!m_windowCreationOrder.empty())
+    {
+        sWindowHandle const oldestHandle = m_windowCreationOrder.front();
+        m_windowCreationOrder.pop_front();
+
+        if (RemoveWindow(oldestHandle))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void App::BeginFrame()
+{
+    if (IsHeadless())
+    {
+        PROFILE_CALL("EventSystem::BeginFrame", g_theEventSystem->BeginFrame());
+        PROFILE_CALL("WindowBackend::BeginFrame", g_theWindowBackend->BeginFrame());
+        PROFILE_CALL("App::DrainWindowEvents", DrainWindowEvents());
+        PROFILE_CALL("InputSystem::BeginFrame", g_theInput->BeginFrame());
+
+        if (g_theRenderDevice != nullptr)
+        {
+            PROFILE_CALL("RenderDevice::BeginFrame", g_theRenderDevice->BeginFrame());
+            PROFILE_CALL("PipelineStateCache::BeginFrame", g_thePipelineStateCache->BeginFrame());
+            PROFILE_CALL("DebugDrawBatch::BeginFrame", g_theDebugDrawBatch->BeginFrame());
+            PROFILE_CALL("RetainedDebugText::BeginFrame", g_theRetainedDebugText->BeginFrame());
+        }
+
+        return;
+    }
+
+    // Child window input lands in the InputSystem at the same point the main window's does.
+    PROFILE_CALL("EventSystem::BeginFrame", g_theEventSystem->BeginFrame());
+    PROFILE_CALL("Window::BeginFrame", g_theWindow->BeginFrame());
+    PROFILE_CALL("App::DrainWindowEvents", DrainWindowEvents());
+    PROFILE_CALL("RenderDevice::BeginFrame", g_theRenderDevice->BeginFrame());
+    PROFILE_CALL("PipelineStateCache::BeginFrame", g_thePipelineStateCache->BeginFrame());
+    PROFILE_CALL("DebugDrawBatch::BeginFrame", g_theDebugDrawBatch->BeginFrame());
+    PROFILE_CALL("RetainedDebugText::BeginFrame", g_theRetainedDebugText->BeginFrame());
+    PROFILE_CALL("DebugRenderBeginFrame", DebugRenderBeginFrame());
+    PROFILE_CALL("DevConsole::BeginFrame", g_theDevConsole->BeginFrame());
+    PROFILE_CALL("InputSystem::BeginFrame", g_theInput->BeginFrame());
+    PROFILE_CALL("WindowBackend::BeginFrame", g_theWindowBackend->BeginFrame());
+}
+
+//----------------------------------------------------------------------------------------------------
+void App::Update()
+{
+    PROFILE_CALL("Clock::TickSystemClock", Clock::TickSystemClock());
+
+    if (g_theInput->WasKeyJustPressed(KEYCODE_Z))
+    {
+        CreateAndRegisterMultipleWindows(windows, 1);
+    }
+
+    if (g_theInput->WasKeyJustPressed(KEYCODE_X))
+    {
+        RemoveOldestWindow();
+    }
+
+    if (!IsHeadless())
+    {
+        UpdateCursorMode();
+    }
+
+    // Replays run on the log's fixed frame delta so window drift lands in the same place every run.
+    double const frameDeltaSeconds = m_isReplayingInput ? static_cast<double>(m_inputReplayer.GetFrameDeltaSeconds()) : Clock::GetSystemClock().GetDeltaSeconds();
+
+    PROFILE_CALL("App::UpdateWindowDrift", UpdateWindowDrift((float)frameDeltaSeconds * WINDOW_DRIFT_TIME_SCALE));
+    PROFILE_CALL("App::UpdateWindowsResizeIfNeeded", UpdateWindowsResizeIfNeeded(windows));
+    PROFILE_CALL("App::UpdateWindowViews", UpdateWindowViews());
+    PROFILE_CALL("Game::Update", g_theGame->Update());
+}
+
+//----------------------------------------------------------------------------------------------------
+// Some simple OpenGL example drawing code.
+// This is the graphical equivalent of printing "Hello, world."
+//
+// Ultimately this function (App::Render) will only call methods on Renderer (like Renderer::DrawVertexArray)
+//	to draw things, never calling OpenGL (nor DirectX) functions directly.
+//
+void App::Render() const
+{
+    if (IsHeadless())
+    {
+        PROFILE_CALL("App::RenderWindows", RenderWindows(windows));
+        return;
+    }
+
+    bool const isCompositing = g_theWindowBackend->GetPresentMode() == eWindowPresentMode::COMPOSITE_SCENE;
+
+    // The Engine gives child windows no render target of their own; they share the main back buffer.
+    // In RENDER_PER_WINDOW mode child windows go first: each one draws its porthole view into the part
+    // of the back buffer underneath it and PresentChildWindow copies and presents that part at once,
+    // so the main view below is free to clear and overwrite it.
+    m_isMainViewDrawn = false;
+
+    if (!isCompositing)
+    {
+        PROFILE_CALL("App::RenderWindows", RenderWindows(windows)); // 安全地呼叫，不會改變狀態
+    }
+
+    PROFILE_CALL("RenderDevice::ClearScreen", g_theRenderDevice->ClearScreen(Rgba8::BLUE));
+    PROFILE_CALL("Game::Render", g_theGame->Render());
+    PROFILE_CALL("Renderer::Render", g_theRenderer->Render());
+    m_isMainViewDrawn = true;
+
+    // In COMPOSITE_SCENE mode the back buffer now holds this frame's scene and has not been presented
+    // yet; each child copies its part of it.
+    if (isCompositing)
+    {
+        PROFILE_CALL("App::RenderWindows", RenderWindows(windows));
+    }
+
+    AABB2 const box = AABB2(Vec2::ZERO, Vec2(1600.f, 30.f));
+
+    PROFILE_CALL("DevConsole::Render", g_theDevConsole->Render(box));
+}
+
+//----------------------------------------------------------------------------------------------------
+void App::EndFrame()
+{
+    // All window moves and resizes requested this frame reach the OS here, in one batch.
+    PROFILE_CALL("WindowTransformBatch::Commit", m_windowTransforms.Commit(*g_theWindowBackend));
+
+    if (IsHeadless())
+    {
+        PROFILE_CALL("EventSystem::EndFrame", g_theEventSystem->EndFrame());
+        PROFILE_CALL("WindowBackend::EndFrame", g_theWindowBackend->EndFrame());
+        PROFILE_CALL("InputSystem::EndFrame", g_theInput->EndFrame());
+
+        if (g_theRenderDevice != nullptr)
+        {
+            PROFILE_CALL("RenderDevice::EndFrame", g_theRenderDevice->EndFrame());
+        }
+
+        return;
+    }
+
+    PROFILE_CALL("EventSystem::EndFrame", g_theEventSystem->EndFrame());
+    PROFILE_CALL("Window::EndFrame", g_theWindow->EndFrame());
+    PROFILE_CALL("RenderDevice::EndFrame", g_theRenderDevice->EndFrame());
+    PROFILE_CALL("DebugRenderEndFrame", DebugRenderEndFrame());
+    PROFILE_CALL("DevConsole::EndFrame", g_theDevConsole->EndFrame());
+    PROFILE_CALL("InputSystem::EndFrame", g_theInput->EndFrame());
+    PROFILE_CALL("WindowBackend::EndFrame", g_theWindowBackend->EndFrame());
+}
+
+//----------------------------------------------------------------------------------------------------
+void App::UpdateCursorMode()
+{
+    bool const doesWindowHasFocus   = g_theWindowBackend->IsMainWindowFocused();
+    bool const isAttractState       = g_theGame->GetCurrentGameState() == eGameState::ATTRACT;
+    bool const shouldUsePointerMode = !doesWindowHasFocus || g_theDevConsole->IsOpen() || isAttractState;
+
+    if (shouldUsePointerMode == true)
+    {
+        g_theInput->SetCursorMode(eCursorMode::POINTER);
+    }
+    else
+    {
+        g_theInput->SetCursorMode(eCursorMode::FPS);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool App::IsHeadless() const
+{
+    return m_config.m_windowBackendType == eWindowBackendType::HEADLESS;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Headless runs have no Engine Textures, so the path is registered with a null Texture and the CPU
+// copy is registered with the software device under the path's texture key, which is what it binds by.
+//
+void App::RegisterRasterTexture(sAssetPath const& path)
+{
+    Image const   image(path.m_path);
+    IntVec2 const dimensions = image.GetDimensions();
+
+    sRasterTexture& rasterTexture = m_rasterTextures.emplace_back();
+    rasterTexture.m_dimensions    = dimensions;
+    rasterTexture.m_texels.resize(static_cast<size_t>(dimensions.x) * dimensions.y);
+
+    for (int texelY = 0; texelY < dimensions.y; ++texelY)
+    {
+        for (int texelX = 0; texelX < dimensions.x; ++texelX)
+        {
+            rasterTexture.m_texels[static_cast<size_t>(texelY) * dimensions.x + texelX] = image.GetTexelColor(IntVec2(texelX, texelY));
+        }
+    }
+
+    g_theAssetRegistry->RegisterTexture(path, nullptr);
+    static_cast<SoftwareRenderDevice*>(g_theRenderDevice)->RegisterTexture(g_theAssetRegistry->GetTextureKey(g_theAssetRegistry->InternTexture(path)), &rasterTexture);
+}
+
+//----------------------------------------------------------------------------------------------------
+// A log that fails to load is reported and the run carries on with live input, so a typo in a perf
+// script shows up as a short, obviously wrong run rather than a crash. Runs before the first window
+// is added, so a replay rolls the recorded session's window drift from the same seed.
+//
+void App::StartInputRecordingAndReplay()
+{
+    m_windowDriftSeed = std::random_device()();
+
+    if (!m_config.m_inputReplayFilePath.empty())
+    {
+        m_isReplayingInput = m_inputReplayer.Load(m_config.m_inputReplayFilePath);
+
+        if (m_isReplayingInput)
+        {
+            g_theGame->SetFixedFrameDelta(static_cast<double>(m_inputReplayer.GetFrameDeltaSeconds()));
+            m_windowDriftSeed = m_inputReplayer.GetRNGSeed();
+        }
+    }
+
+    m_windowDriftRNG.seed(m_windowDriftSeed);
+
+    if (!m_config.m_inputRecordFilePath.empty())
+    {
+        m_inputRecorder.Start(m_config.m_inputRecordFilePath, m_config.m_fixedTimestepSeconds > 0.f ? m_config.m_fixedTimestepSeconds : 1.f / 60.f, m_windowDriftSeed);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Live events first, then this frame's replayed input; the recorder samples the result, so it sees
+// exactly the key state Game::Update will see. During a replay live events are still drained, so
+// the ring never fills, but only a close request is acted on.
+//
+void App::DrainWindowEvents()
+{
+    sWindowEvent event;
+
+    while (g_theWindowBackend->PollWindowEvent(event))
+    {
+        if (m_isReplayingInput)
+        {
+            if (event.m_type == eWindowEventType::CLOSE_REQUESTED)
+            {
+                RequestQuit();
+            }
+
+            continue;
+        }
+
+        HandleWindowEvent(event);
+
+        if (m_inputRecorder.IsRecording())
+        {
+            m_inputRecorder.RecordWindowEvent(event, windows.GetDenseIndex(windows.FindByNativeHandle(event.m_windowHandle)));
+        }
+    }
+
+    if (m_isReplayingInput)
+    {
+        ReplayInputFrame();
+    }
+
+    if (m_inputRecorder.IsRecording())
+    {
+        m_inputRecorder.FinishFrame();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// The main window's WNDPROC still feeds live keys straight into the InputSystem, so any key whose
+// state has drifted from the replay is put back first, without firing game events. Every record then
+// goes through HandleWindowEvent like a live event would; window events are rebuilt against
+// whichever window now has the recorded dense index.
+//
+void App::ReplayInputFrame()
+{
+    for (int keyCode = 0; keyCode < 256; ++keyCode)
+    {
+        unsigned char const key          = static_cast<unsigned char>(keyCode);
+        bool const          isReplayDown = m_inputReplayer.IsKeyDown(key);
+
+        if (g_theInput->IsKeyDown(key) == isReplayDown)
+        {
+            continue;
+        }
+
+        if (isReplayDown)
+        {
+            g_theInput->HandleKeyPressed(key);
+        }
+        else
+        {
+            g_theInput->HandleKeyReleased(key);
+        }
+    }
+
+    sInputLogRecord record;
+
+    while (m_inputReplayer.PopRecord(m_replayFrameIndex, record))
+    {
+        bool const isKeyRecord = record.m_type == eWindowEventType::KEY_DOWN || record.m_type == eWindowEventType::KEY_UP;
+
+        if (!isKeyRecord && record.m_windowIndex >= windows.GetCount())
+        {
+            continue;
+        }
+
+        sWindowEvent event;
+        event.m_timeSeconds  = GetSchedulerTimeSeconds();
+        event.m_windowHandle = isKeyRecord ? nullptr : windows.GetWindowAt(record.m_windowIndex).m_windowHandle;
+        event.m_type         = record.m_type;
+        event.m_keyCode      = record.m_keyCode;
+        event.m_x            = record.m_x;
+        event.m_y            = record.m_y;
+        event.m_codePoint    = static_cast<uint32_t>(record.m_x);
+
+        HandleWindowEvent(event);
+    }
+
+    ++m_replayFrameIndex;
+
+    if (m_inputReplayer.IsFinished(m_replayFrameIndex))
+    {
+        RequestQuit();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Window events name their window by native handle; one removed since the event was posted is
+// simply gone from the slot map. A window the user grabs stops drifting, and a drag or resize is
+// written straight into its kinematics without a dirty flag, since the OS has already applied it.
+//
+void App::HandleWindowEvent(sWindowEvent const& event)
+{
+    switch (event.m_type)
+    {
+    case eWindowEventType::KEY_DOWN:
+        {
+            g_theInput->HandleKeyPressed(event.m_keyCode);
+
+            sKeyPressedEvent keyEvent;
+            keyEvent.m_keyCode = event.m_keyCode;
+            g_theGameEventBus->Fire(keyEvent);
+            return;
+        }
+
+    case eWindowEventType::KEY_UP:
+        {
+            g_theInput->HandleKeyReleased(event.m_keyCode);
+
+            sKeyReleasedEvent keyEvent;
+            keyEvent.m_keyCode = event.m_keyCode;
+            g_theGameEventBus->Fire(keyEvent);
+            return;
+        }
+
+    case eWindowEventType::CHAR:
+        {
+            sCharInputEvent charEvent;
+            charEvent.m_codePoint = event.m_codePoint;
+            g_theGameEventBus->Fire(charEvent);
+            return;
+        }
+
+    case eWindowEventType::CLOSE_REQUESTED:
+        RequestQuit();
+        return;
+
+    case eWindowEventType::MOVED:
+    case eWindowEventType::RESIZED:
+    case eWindowEventType::SIZE_MOVE_BEGIN:
+        break;
+    }
+
+    sWindowHandle const handle     = windows.FindByNativeHandle(event.m_windowHandle);
+    int const           denseIndex = windows.GetDenseIndex(handle);
+
+    if (denseIndex < 0)
+    {
+        return;
+    }
+
+    sWindowKinematics const kinematics = windows.GetKinematics();
+
+    if (event.m_type == eWindowEventType::SIZE_MOVE_BEGIN)
+    {
+        kinematics.m_velocityX[denseIndex] = 0.f;
+        kinematics.m_velocityY[denseIndex] = 0.f;
+    }
+    else if (event.m_type == eWindowEventType::MOVED)
+    {
+        kinematics.m_positionX[denseIndex] = static_cast<float>(event.m_x);
+        kinematics.m_positionY[denseIndex] = static_cast<float>(event.m_y);
+    }
+    else
+    {
+        float const width  = static_cast<float>(event.m_x);
+        float const height = static_cast<float>(event.m_y);
+
+        // Our own resizes come back too; those already set needsResize when they were committed.
+        if (kinematics.m_width[denseIndex] != width || kinematics.m_height[denseIndex] != height)
+        {
+            kinematics.m_width[denseIndex]  = width;
+            kinematics.m_height[denseIndex] = height;
+            windows.GetWindowAt(denseIndex).needsResize = true;
+        }
+    }
+}
+
+void App::UpdateWindows(WindowSlotMap& windows) const
+{
+    for (int i = 0; i < windows.GetCount(); ++i)
+    {
+        Window& window = windows.GetWindowAt(i);
+
+        if (window.needsResize)
+        {
+            bool const isResized = g_theWindowBackend->ResizeChildWindow(window);
+            window.needsResize   = false;
+            if (!isResized)
+            {
+                continue;
+            }
+        }
+
+        if (window.needsUpdate)
+        {
+            // 使用 DirectX 11 版本渲染
+            // g_theRenderer->RenderViewportToWindowDX11(window);
+            g_theWindowBackend->PresentChildWindow(window);
+            // window.needsUpdate = false;
+        }
+    }
+}
+
+void App::RenderWindows(WindowSlotMap const& windows) const
+{
+    if (g_theWindowBackend->GetPresentMode() == eWindowPresentMode::COMPOSITE_SCENE)
+    {
+        PROFILE_CALL("WindowBackend::BeginComposite", g_theWindowBackend->BeginComposite());
+
+        // The scene is drawn once into the backend's scene surface; each window then copies its rows.
+        if (SoftwareRenderDevice* softwareDevice = GetSoftwareRenderDevice())
+        {
+            HeadlessWindowBackend* headlessBackend = static_cast<HeadlessWindowBackend*>(g_theWindowBackend);
+
+            softwareDevice->SetTarget(headlessBackend->GetScenePixels(), headlessBackend->GetSceneDimensions());
+            softwareDevice->ClearScreen(Rgba8::BLUE);
+            PROFILE_CALL("Game::RenderView", g_theGame->RenderView(m_sceneView));
+        }
+
+        for (int windowIndex = 0; windowIndex < windows.GetCount(); ++windowIndex)
+        {
+            Window const& window = windows.GetWindowAt(windowIndex);
+
+            if (!window.needsUpdate)
+            {
+                continue;
+            }
+
+            PROFILE_SCOPE_INDEXED("App::CompositeWindow", windowIndex);
+            g_theWindowBackend->CompositeChildWindow(window);
+        }
+
+        g_theWindowBackend->EndComposite();
+        return;
+    }
+
+    // A child presenting after the main view would copy the main view's pixels, not its own.
+    GUARANTEE_OR_DIE(!m_isMainViewDrawn, "App::RenderWindows: child windows must present before the main view draws")
+
+    SoftwareRenderDevice* const softwareDevice = GetSoftwareRenderDevice();
+
+    // Every Engine child draws inside its own viewport, so one clear serves all of them.
+    if (g_theRenderDevice != nullptr && softwareDevice == nullptr)
+    {
+        g_theRenderDevice->ClearScreen(Rgba8::BLUE);
+    }
+
+    for (int windowIndex = 0; windowIndex < windows.GetCount(); ++windowIndex)
+    {
+        Window const& window = windows.GetWindowAt(windowIndex);
+
+        if (window.needsUpdate)
+        {
+            PROFILE_SCOPE_INDEXED("App::RenderWindow", windowIndex);
+
+            if (g_theRenderDevice != nullptr && windowIndex < static_cast<int>(m_windowViews.size()))
+            {
+                if (softwareDevice != nullptr)
+                {
+                    IntVec2      surfaceDimensions;
+                    Rgba8* const surfacePixels = static_cast<HeadlessWindowBackend*>(g_theWindowBackend)->GetSurfacePixels(window.m_windowHandle, surfaceDimensions);
+                    softwareDevice->SetTarget(surfacePixels, surfaceDimensions);
+                    softwareDevice->ClearScreen(Rgba8::BLUE);
+                }
+
+                g_theGame->RenderView(m_windowViews[windowIndex]);
+            }
+
+            g_theWindowBackend->PresentChildWindow(window);
+            // g_theRenderer->RenderViewportToWindowDX11(window);
+        }
+    }
+}
+
+void App::UpdateWindowsResizeIfNeeded(WindowSlotMap& windows)
+{
+    for (int windowIndex = 0; windowIndex < windows.GetCount(); ++windowIndex)
+    {
+        Window& window = windows.GetWindowAt(windowIndex);
+
+        if (window.needsResize)
+        {
+            PROFILE_SCOPE_INDEXED("App::ResizeWindow", windowIndex);
+            bool const isResized = g_theWindowBackend->ResizeChildWindow(window);
+            window.needsResize   = false;
+
+            if (!isResized)
+            {
+                continue;
+            }
+
+            window.needsUpdate = true;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Rebuilds each child window's scene-space camera from where the window will sit this frame. Runs
+// after drift but before EndFrame commits the positions, so the bounds come from the kinematics the
+// commit will send, not from the OS rect, which still holds last frame's commit.
+//
+void App::UpdateWindowViews()
+{
+    m_windowViews.resize(windows.GetCount());
+
+    sWindowKinematics const kinematics = windows.GetKinematics();
+
+    // Debug draws land in one batch that the main view and every child view render, so they are
+    // tessellated for the finest of them.
+    float      finestPixelsPerUnit = 1.f;
+    bool const isSharingBackBuffer = g_theRenderDevice != nullptr && g_theRenderDevice->GetType() == eRenderDeviceType::ENGINE;
+
+    if (g_theWindow != nullptr && g_theRenderer != nullptr)
+    {
+        IntVec2 const clientDimensions = g_theWindow->GetClientDimensions();
+        finestPixelsPerUnit            = std::max(static_cast<float>(clientDimensions.x) / SCREEN_SIZE_X, static_cast<float>(clientDimensions.y) / SCREEN_SIZE_Y);
+    }
+
+    for (int windowIndex = 0; windowIndex < windows.GetCount(); ++windowIndex)
+    {
+        Vec2 const  framePosition(kinematics.m_positionX[windowIndex], kinematics.m_positionY[windowIndex]);
+        Vec2 const  clientDimensions(kinematics.m_width[windowIndex], kinematics.m_height[windowIndex]);
+        AABB2 const normalizedBounds = g_theWindowBackend->GetChildWindowNormalizedBounds(framePosition, clientDimensions);
+        AABB2 const sceneBounds(normalizedBounds.m_mins.x * SCREEN_SIZE_X, normalizedBounds.m_mins.y * SCREEN_SIZE_Y,
+                                normalizedBounds.m_maxs.x * SCREEN_SIZE_X, normalizedBounds.m_maxs.y * SCREEN_SIZE_Y);
+
+        m_windowViews[windowIndex].SetSceneBounds(sceneBounds);
+        m_windowViews[windowIndex].SetTargetDimensions(Vec2(kinematics.m_width[windowIndex], kinematics.m_height[windowIndex]));
+
+        // Engine children share the main back buffer, so each draws where PresentChildWindow reads.
+        if (isSharingBackBuffer)
+        {
+            m_windowViews[windowIndex].m_camera.SetNormalizedViewport(normalizedBounds);
+        }
+
+        finestPixelsPerUnit = std::max(finestPixelsPerUnit, m_windowViews[windowIndex].m_pixelsPerUnit);
+    }
+
+    if (g_theWindowBackend->GetPresentMode() == eWindowPresentMode::COMPOSITE_SCENE)
+    {
+        AABB2 const desktopBounds = g_theWindowBackend->GetDesktopBounds();
+
+        m_sceneView.SetSceneBounds(AABB2(0.f, 0.f, SCREEN_SIZE_X, SCREEN_SIZE_Y));
+        m_sceneView.SetTargetDimensions(desktopBounds.m_maxs - desktopBounds.m_mins);
+
+        finestPixelsPerUnit = std::max(finestPixelsPerUnit, m_sceneView.m_pixelsPerUnit);
+    }
+
+    SetDebugDrawPixelsPerUnit(finestPixelsPerUnit);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Integrates every window's drift in one SIMD pass over the slot map's kinematics arrays. Positions
+// are only written there; the OS sees them when the transform batch commits at EndFrame.
+//
+void App::UpdateWindowDrift(float const deltaSeconds)
+{
+    int const movedCount = IntegrateWindowDrift(windows.GetKinematics(), g_theWindowBackend->GetDesktopBounds(), deltaSeconds);
+
+    m_windowTransforms.AddMoveRequests(movedCount);
 }
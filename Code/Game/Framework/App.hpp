@@ -4,19 +4,47 @@
 
 //----------------------------------------------------------------------------------------------------
 #pragma once
+#include <deque>
+#include <random>
+
 #include "GameCommon.hpp"
 #include "Engine/Core/EventSystem.hpp"
 #include "Engine/Platform/Window.hpp"
+#include "Game/Framework/AssetPreloader.hpp"
+#include "Game/Framework/AudioStream.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+#include "Game/Framework/InputRecording.hpp"
+#include "Game/Framework/RenderView.hpp"
+#include "Game/Framework/SoftwareRasterizer.hpp"
+#include "Game/Framework/WindowBackend.hpp"
+#include "Game/Framework/WindowSlotMap.hpp"
+#include "Game/Framework/WindowTransformBatch.hpp"
 
 //-Forward-Declaration--------------------------------------------------------------------------------
 class Camera;
 class Game;
 
+//----------------------------------------------------------------------------------------------------
+struct sAppConfig
+{
+    void*                     m_applicationInstanceHandle = nullptr;
+    eWindowBackendType        m_windowBackendType         = eWindowBackendType::WIN32_NATIVE;
+    eWindowPresentMode        m_windowPresentMode         = eWindowPresentMode::RENDER_PER_WINDOW;
+    int                       m_initialWindowCount        = 2;
+    int                       m_maxFrameCount             = -1;            // -1 runs until quit is requested
+    sFrameSchedulerConfig     m_frameSchedulerConfig;
+    float                     m_fixedTimestepSeconds      = 1.f / 60.f;    // <= 0 runs Game simulation once per rendered frame
+    std::string               m_inputRecordFilePath;                       // Non-empty records the session's input from the first frame
+    std::string               m_inputReplayFilePath;                       // Non-empty replays a recorded log on a fixed clock, then quits
+    bool                      m_isSoftwareRasterEnabled   = false;         // Headless only: draw every window with the SoftwareRasterizer
+    sSoftwareRasterizerConfig m_softwareRasterizerConfig;
+};
+
 //----------------------------------------------------------------------------------------------------
 class App
 {
 public:
-    App(HINSTANCE const& hInstance);
+    explicit App(sAppConfig const& config);
     ~App() = default;
     void Startup();
     void Shutdown();
@@ -24,24 +52,84 @@ public:
 
     void RunMainLoop();
 
+    FrameScheduler const& GetFrameScheduler() const;
+    WindowTransformBatch& GetWindowTransforms();
+    int                   GetFrameCount() const;
+
     static bool OnWindowClose(EventArgs& args);
     static void RequestQuit();
+    static bool OnProfilerStart(EventArgs& args);
+    static bool OnProfilerStop(EventArgs& args);
+    static bool OnProfilerDump(EventArgs& args);
+    static bool OnWindowTransformStats(EventArgs& args);
+    static bool OnBenchmarkWindowDrift(EventArgs& args);
+    static bool OnPipelineStateStats(EventArgs& args);
+    static bool OnDebugDrawBatchStats(EventArgs& args);
+    static bool OnDebugTextStats(EventArgs& args);
+    static bool OnAssetLookupStats(EventArgs& args);
+    static bool OnAssetPreloadStats(EventArgs& args);
+    static bool OnShaderCacheStats(EventArgs& args);
+    static bool OnAudioStats(EventArgs& args);
+    static bool OnPlayStream(EventArgs& args);
+    static bool OnStopStream(EventArgs& args);
+    static bool OnAudioStreamStats(EventArgs& args);
+    static bool OnBenchmarkEvents(EventArgs& args);
+    static bool OnBenchmarkTextMesh(EventArgs& args);
+    static bool OnBenchmarkShapeTessellation(EventArgs& args);
+    static bool OnWindowSizeChanged(EventArgs& args);
+    static bool OnWindowEventStats(EventArgs& args);
+    static bool OnRecordInput(EventArgs& args);
+    static bool OnStopRecordInput(EventArgs& args);
+    static bool OnSoftwareRasterStats(EventArgs& args);
+    static bool OnBenchmarkSoftwareRaster(EventArgs& args);
     static bool m_isQuitting;
 
-    void                AddWindow(HWND const& hwnd);
-    std::vector<Window> windows;
-    void                UpdateWindows(std::vector<Window>& windows) const;
-    void                RenderWindows(const std::vector<Window>& windows) const;
-    void                UpdateWindowsResizeIfNeeded(std::vector<Window>& windows);
+    sWindowHandle AddWindow(void* windowHandle, Vec2 const& position, IntVec2 const& dimensions);
+    bool          RemoveWindow(sWindowHandle handle);
+    bool          RemoveOldestWindow();
+    WindowSlotMap windows;
+    void          UpdateWindows(WindowSlotMap& windows) const;
+    void          RenderWindows(WindowSlotMap const& windows) const;
+    void          UpdateWindowsResizeIfNeeded(WindowSlotMap& windows);
+    void          UpdateWindowViews();
+    void          UpdateWindowDrift(float deltaSeconds);
 
 private:
-    void BeginFrame() const;
+    void BeginFrame();
     void Update();
     void Render() const;
-    void EndFrame() const;
+    void EndFrame();
     void UpdateCursorMode();
+    bool IsHeadless() const;
+    void StartInputRecordingAndReplay();
+    void DrainWindowEvents();
+    void HandleWindowEvent(sWindowEvent const& event);
+    void ReplayInputFrame();
+    void RegisterRasterTexture(sAssetPath const& path);
+
+    sAppConfig     m_config;
+    FrameScheduler m_frameScheduler;
+    AssetPreloader m_assetPreloader;
+
+    sAudioStreamHandle m_consoleStream;     // Last stream started by the PlayStream command
+
+    InputRecorder m_inputRecorder;
+    InputReplayer m_inputReplayer;
+    bool          m_isReplayingInput = false;
+    uint32_t      m_replayFrameIndex = 0;
+
+    std::mt19937 m_windowDriftRNG;          // Rolls each new window's drift; reseeded from the log on replay
+    uint32_t     m_windowDriftSeed = 0;
+
+    WindowTransformBatch m_windowTransforms = WindowTransformBatch(windows);
+
+    std::deque<sWindowHandle> m_windowCreationOrder;     // Oldest first; handles removed by other paths are skipped lazily
 
+    std::deque<sRasterTexture> m_rasterTextures;     // Headless software raster only; CPU copies of the textures Game binds
 
-    HINSTANCE m_hInstance;
-    Camera*   m_devConsoleCamera = nullptr;
+    std::vector<sRenderView> m_windowViews;     // Parallel to windows' dense order; scene-space porthole of each child window
+    sRenderView              m_sceneView;       // The whole scene, drawn once per frame in COMPOSITE_SCENE mode
+    Camera*        m_devConsoleCamera = nullptr;
+    int            m_frameCount       = 0;
+    mutable bool   m_isMainViewDrawn  = false;     // Set by Render once the main view owns the back buffer
 };
@@ -0,0 +1,281 @@
+//----------------------------------------------------------------------------------------------------
+// AssetPreloader.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AssetPreloader.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/AudioDevice_Engine.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/ShaderCache.hpp"
+
+//----------------------------------------------------------------------------------------------------
+AssetPreloader::~AssetPreloader()
+{
+    JoinWorkers();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Manifest lines are "<type> <path>"; blank lines and lines starting with '#' are skipped.
+//
+bool AssetPreloader::LoadManifest(char const* manifestPath)
+{
+    std::ifstream manifest(manifestPath);
+
+    if (!manifest.is_open())
+    {
+        DebuggerPrintf("AssetPreloader: manifest \"%s\" not found; assets will load on first use.\n", manifestPath);
+        return false;
+    }
+
+    std::string line;
+
+    while (std::getline(manifest, line))
+    {
+        std::istringstream lineStream(line);
+        std::string        typeName;
+        std::string        path;
+
+        if (!(lineStream >> typeName >> path) || typeName[0] == '#')
+        {
+            continue;
+        }
+
+        sPreloadEntry entry;
+        entry.m_path     = path;
+        entry.m_filePath = path;
+
+        if (typeName == "texture")
+        {
+            entry.m_type = eAssetType::TEXTURE;
+
+            // An atlased image is loaded as its page; the page is queued once however many images share it.
+            sTextureAtlasRegion const* region = g_theAssetRegistry->GetTextureAtlas().FindRegion(HashAssetPath(path.c_str()));
+
+            if (region != nullptr)
+            {
+                entry.m_path     = g_theAssetRegistry->GetTextureAtlas().GetPage(region->m_pageIndex).m_imagePath;
+                entry.m_filePath = entry.m_path;
+
+                bool const isQueued = std::any_of(m_entries.begin(), m_entries.end(), [&entry](sPreloadEntry const& queued) { return queued.m_path == entry.m_path; });
+
+                if (isQueued)
+                {
+                    continue;
+                }
+            }
+        }
+        else if (typeName == "shader")
+        {
+            entry.m_type = eAssetType::SHADER;
+            entry.m_filePath += ".hlsl";
+        }
+        else if (typeName == "sound")
+        {
+            entry.m_type = eAssetType::SOUND;
+        }
+        else if (typeName == "font")
+        {
+            entry.m_type = eAssetType::FONT;
+            entry.m_filePath += ".png";
+        }
+        else
+        {
+            DebuggerPrintf("AssetPreloader: unknown asset type \"%s\" for \"%s\"; skipped.\n", typeName.c_str(), path.c_str());
+            continue;
+        }
+
+        m_entries.push_back(std::move(entry));
+    }
+
+    m_stats.m_entryCount = static_cast<int>(m_entries.size());
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AssetPreloader::Start(int const workerCount)
+{
+    m_startSeconds        = GetSchedulerTimeSeconds();
+    m_stats.m_workerCount = std::max(1, std::min(workerCount, static_cast<int>(m_entries.size())));
+
+    if (m_entries.empty())
+    {
+        return;
+    }
+
+    for (int workerIndex = 0; workerIndex < m_stats.m_workerCount; ++workerIndex)
+    {
+        m_workers.emplace_back(&AssetPreloader::RunWorker, this);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int AssetPreloader::CreateReadyAssets()
+{
+    std::vector<int> readyEntryIndices;
+    {
+        std::lock_guard<std::mutex> lock(m_readyMutex);
+        readyEntryIndices.swap(m_readyEntryIndices);
+    }
+
+    for (int const entryIndex : readyEntryIndices)
+    {
+        CreateEntry(m_entries[entryIndex]);
+    }
+
+    if (!readyEntryIndices.empty() && IsFinished())
+    {
+        m_stats.m_wallSeconds = GetSchedulerTimeSeconds() - m_startSeconds;
+        JoinWorkers();
+    }
+
+    return static_cast<int>(readyEntryIndices.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+void AssetPreloader::FinishLoading()
+{
+    // Without workers nothing would ever become ready; the entries load on first use instead.
+    if (m_workers.empty() && !IsFinished())
+    {
+        DebuggerPrintf("AssetPreloader: FinishLoading called before Start; %d assets will load on first use.\n",
+                       static_cast<int>(m_entries.size()) - m_createdEntryCount);
+        return;
+    }
+
+    while (!IsFinished())
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_readyMutex);
+            m_readyCondition.wait(lock, [this] { return !m_readyEntryIndices.empty(); });
+        }
+
+        CreateReadyAssets();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+float AssetPreloader::GetProgress() const
+{
+    if (m_entries.empty())
+    {
+        return 1.f;
+    }
+
+    return static_cast<float>(m_createdEntryCount) / static_cast<float>(m_entries.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AssetPreloader::IsFinished() const
+{
+    return m_createdEntryCount == static_cast<int>(m_entries.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+sAssetPreloadStats const& AssetPreloader::GetStats() const
+{
+    return m_stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Entries are claimed one at a time, so a slow read never holds up the rest of the list. Workers
+// touch only their own entry until they hand its index to the main thread.
+//
+void AssetPreloader::RunWorker()
+{
+    int const entryCount = static_cast<int>(m_entries.size());
+
+    for (int entryIndex = m_nextEntryIndex.fetch_add(1); entryIndex < entryCount; entryIndex = m_nextEntryIndex.fetch_add(1))
+    {
+        sPreloadEntry& entry        = m_entries[entryIndex];
+        double const   startSeconds = GetSchedulerTimeSeconds();
+
+        // Read the whole file so the OS has it cached when the main thread creates the asset. The bytes
+        // are dropped: the Engine only creates assets from a path, so decoding happens there.
+        std::ifstream file(entry.m_filePath, std::ios::binary | std::ios::ate);
+
+        if (file.is_open())
+        {
+            std::streamoff const fileSize = file.tellg();
+
+            if (fileSize > 0)
+            {
+                std::vector<char> bytes(static_cast<size_t>(fileSize));
+                file.seekg(0);
+                file.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+                entry.m_bytesWarmed = static_cast<uint64_t>(file.gcount());
+                entry.m_isReadable  = file.gcount() == fileSize;
+            }
+        }
+
+        entry.m_warmSeconds = GetSchedulerTimeSeconds() - startSeconds;
+
+        {
+            std::lock_guard<std::mutex> lock(m_readyMutex);
+            m_readyEntryIndices.push_back(entryIndex);
+        }
+
+        m_readyCondition.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AssetPreloader::CreateEntry(sPreloadEntry& entry)
+{
+    double const      startSeconds = GetSchedulerTimeSeconds();
+    sAssetPath const  path(entry.m_path.c_str());
+    char const* const filePath = entry.m_path.c_str();
+
+    if (!entry.m_isReadable)
+    {
+        DebuggerPrintf("AssetPreloader: could not read \"%s\"; it will load on first use.\n", entry.m_filePath.c_str());
+        ++m_stats.m_failedEntryCount;
+        ++m_createdEntryCount;
+        return;
+    }
+
+    switch (entry.m_type)
+    {
+    case eAssetType::TEXTURE: g_theAssetRegistry->RegisterTexture(path, g_theRenderer->CreateOrGetTextureFromFile(filePath)); break;
+    case eAssetType::SHADER:  g_theAssetRegistry->RegisterShader(path, g_theShaderCache->CreateOrGetShader(filePath)); break;
+    case eAssetType::FONT:    g_theAssetRegistry->RegisterFont(path, g_theRenderer->CreateOrGetBitmapFontFromFile(filePath)); break;
+    case eAssetType::SOUND:
+        {
+            std::lock_guard<std::mutex> lock(g_audioSystemMutex);
+            g_theAssetRegistry->RegisterSound(path, g_theAudio->CreateOrGetSound(filePath, eAudioSystemSoundDimension::Sound2D));
+            break;
+        }
+    }
+
+    double const createSeconds = GetSchedulerTimeSeconds() - startSeconds;
+
+    m_stats.m_bytesWarmed         += entry.m_bytesWarmed;
+    m_stats.m_warmSeconds         += entry.m_warmSeconds;
+    m_stats.m_createSeconds       += createSeconds;
+    m_stats.m_longestEntrySeconds = std::max(m_stats.m_longestEntrySeconds, entry.m_warmSeconds + createSeconds);
+
+    ++m_createdEntryCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AssetPreloader::JoinWorkers()
+{
+    for (std::thread& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+
+    m_workers.clear();
+}
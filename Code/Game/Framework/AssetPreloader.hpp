@@ -0,0 +1,80 @@
+//----------------------------------------------------------------------------------------------------
+// AssetPreloader.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Game/Framework/AssetRegistry.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sAssetPreloadStats
+{
+    int      m_entryCount          = 0;
+    int      m_failedEntryCount    = 0;       // Missing or unreadable; left to load (and report) on first use
+    int      m_workerCount         = 0;
+    uint64_t m_bytesWarmed         = 0;
+    double   m_wallSeconds         = 0.0;     // Start to last creation, as seen by the main thread
+    double   m_warmSeconds         = 0.0;     // Sum of worker file-read time over all entries
+    double   m_createSeconds       = 0.0;     // Sum of main-thread decode + creation time; this part is serial
+    double   m_longestEntrySeconds = 0.0;     // Slowest single entry, read through creation
+
+    // Lower bound on m_wallSeconds however many workers there are.
+    double GetCriticalPathSeconds() const { return m_longestEntrySeconds > m_createSeconds ? m_longestEntrySeconds : m_createSeconds; }
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Warms the OS file cache for the assets listed in a manifest, then creates them before the game
+/// asks for them. Worker threads only read each file; they decode nothing. The main thread then creates
+/// every asset through the Engine's path-based calls (texture, shader, sound and font), which read the
+/// now-cached file again and do all decoding there, serially. The results are registered with
+/// g_theAssetRegistry, so the game's later Intern* calls are all hits. What overlaps with the rest of
+/// startup is therefore disk I/O only. A file a worker could not read is reported and left
+/// unregistered rather than handed to the Engine, which would die on it.
+class AssetPreloader
+{
+public:
+    ~AssetPreloader();
+
+    bool LoadManifest(char const* manifestPath);
+    void Start(int workerCount);
+    int  CreateReadyAssets();     // Main thread only; returns how many were created this call
+    void FinishLoading();         // Main thread only; blocks, creating assets as entries become ready. No-op before Start
+
+    float                     GetProgress() const;     // [0,1] fraction of entries created
+    bool                      IsFinished() const;
+    sAssetPreloadStats const& GetStats() const;
+
+private:
+    struct sPreloadEntry
+    {
+        eAssetType             m_type = eAssetType::TEXTURE;
+        std::string            m_path;
+        std::string            m_filePath;     // m_path plus the extension the Engine appends itself
+        bool                   m_isReadable  = false;
+        uint64_t               m_bytesWarmed = 0;
+        double                 m_warmSeconds = 0.0;
+    };
+
+    void RunWorker();
+    void CreateEntry(sPreloadEntry& entry);
+    void JoinWorkers();
+
+    std::vector<sPreloadEntry> m_entries;
+    std::vector<std::thread>   m_workers;
+    std::atomic<int>           m_nextEntryIndex{0};
+    std::mutex                 m_readyMutex;
+    std::condition_variable    m_readyCondition;
+    std::vector<int>           m_readyEntryIndices;     // Guarded by m_readyMutex
+    int                        m_createdEntryCount = 0;
+    double                     m_startSeconds      = 0.0;
+    sAssetPreloadStats         m_stats;
+};
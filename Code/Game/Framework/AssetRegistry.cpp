@@ -0,0 +1,245 @@
+//----------------------------------------------------------------------------------------------------
+// AssetRegistry.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AssetRegistry.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/AudioDevice_Engine.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/ShaderCache.hpp"
+
+//----------------------------------------------------------------------------------------------------
+AssetRegistry* g_theAssetRegistry = nullptr;     // Created and owned by the App
+
+//----------------------------------------------------------------------------------------------------
+// An atlased image shares its page's Texture with every other image on that page, and gets its
+// own handle only so it can carry its own UVs.
+//
+sTextureHandle AssetRegistry::InternTexture(sAssetPath const& path)
+{
+    sTextureAtlasRegion const* region = m_textureAtlas.FindRegion(path.m_hash);
+
+    sTextureHandle handle;
+
+    if (region == nullptr)
+    {
+        handle.m_index = Intern(m_textures, path, [](char const* filePath) { return g_theRenderer->CreateOrGetTextureFromFile(filePath); });
+        return handle;
+    }
+
+    handle.m_index = Intern(m_textures, path, [this, region](char const*)
+    {
+        sAssetPath const pagePath(m_textureAtlas.GetPage(region->m_pageIndex).m_imagePath.c_str());
+        auto const       found = m_textures.m_indexByHash.find(pagePath.m_hash);
+
+        if (found != m_textures.m_indexByHash.end())
+        {
+            return m_textures.m_assets[found->second];
+        }
+
+        return m_textures.m_assets[Add(m_textures, pagePath, g_theRenderer->CreateOrGetTextureFromFile(pagePath.m_path))];
+    });
+
+    if (m_textureUVs.size() <= handle.m_index)
+    {
+        m_textureUVs.resize(handle.m_index + 1, AABB2(0.f, 0.f, 1.f, 1.f));
+    }
+
+    m_textureUVs[handle.m_index] = region->m_uvs;
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+sShaderHandle AssetRegistry::InternShader(sAssetPath const& path)
+{
+    sShaderHandle handle;
+    handle.m_index = Intern(m_shaders, path, [](char const* filePath) { return g_theShaderCache->CreateOrGetShader(filePath); });
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+sSoundHandle AssetRegistry::InternSound(sAssetPath const& path)
+{
+    sSoundHandle handle;
+    handle.m_index = Intern(m_sounds, path, [](char const* filePath)
+    {
+        std::lock_guard<std::mutex> lock(g_audioSystemMutex);
+        return g_theAudio->CreateOrGetSound(filePath, eAudioSystemSoundDimension::Sound2D);
+    });
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+sFontHandle AssetRegistry::InternFont(sAssetPath const& path)
+{
+    sFontHandle handle;
+    handle.m_index = Intern(m_fonts, path, [](char const* filePath) { return g_theRenderer->CreateOrGetBitmapFontFromFile(filePath); });
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AssetRegistry::RegisterTexture(sAssetPath const& path, Texture* texture)
+{
+    Add(m_textures, path, texture);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AssetRegistry::RegisterShader(sAssetPath const& path, Shader* shader)
+{
+    Add(m_shaders, path, shader);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AssetRegistry::RegisterSound(sAssetPath const& path, SoundID const sound)
+{
+    Add(m_sounds, path, sound);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AssetRegistry::RegisterFont(sAssetPath const& path, BitmapFont* font)
+{
+    Add(m_fonts, path, font);
+}
+
+//----------------------------------------------------------------------------------------------------
+Texture* AssetRegistry::GetTexture(sTextureHandle const handle) const
+{
+    return handle.IsValid() ? m_textures.m_assets[handle.m_index] : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+// An atlased image reports its page, so images sharing a page share a key just as they share a Texture.
+//
+uint64_t AssetRegistry::GetTextureKey(sTextureHandle const handle) const
+{
+    if (!handle.IsValid())
+    {
+        return 0;
+    }
+
+    uint64_t const             pathHash = HashAssetPath(m_textures.m_paths[handle.m_index].c_str());
+    sTextureAtlasRegion const* region   = m_textureAtlas.FindRegion(pathHash);
+
+    return region != nullptr ? HashAssetPath(m_textureAtlas.GetPage(region->m_pageIndex).m_imagePath.c_str()) : pathHash;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 AssetRegistry::GetTextureUVs(sTextureHandle const handle) const
+{
+    if (!handle.IsValid() || handle.m_index >= m_textureUVs.size())
+    {
+        return AABB2(0.f, 0.f, 1.f, 1.f);
+    }
+
+    return m_textureUVs[handle.m_index];
+}
+
+//----------------------------------------------------------------------------------------------------
+Shader* AssetRegistry::GetShader(sShaderHandle const handle) const
+{
+    return handle.IsValid() ? m_shaders.m_assets[handle.m_index] : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+SoundID AssetRegistry::GetSound(sSoundHandle const handle) const
+{
+    return handle.IsValid() ? m_sounds.m_assets[handle.m_index] : MISSING_SOUND_ID;
+}
+
+//----------------------------------------------------------------------------------------------------
+BitmapFont* AssetRegistry::GetFont(sFontHandle const handle) const
+{
+    return handle.IsValid() ? m_fonts.m_assets[handle.m_index] : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Must run before any texture on the atlas is interned, or that texture keeps its standalone copy.
+//
+bool AssetRegistry::LoadTextureAtlas(char const* lookupFilePath)
+{
+    return m_textureAtlas.LoadLookup(lookupFilePath);
+}
+
+//----------------------------------------------------------------------------------------------------
+TextureAtlas const& AssetRegistry::GetTextureAtlas() const
+{
+    return m_textureAtlas;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AssetRegistry::SealStartup()
+{
+    m_isSealed = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AssetRegistry::IsSealed() const
+{
+    return m_isSealed;
+}
+
+//----------------------------------------------------------------------------------------------------
+sAssetLookupStats const& AssetRegistry::GetStats() const
+{
+    return m_stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+// A repeat path costs one integer-keyed map probe. A new path costs one string-based Engine lookup.
+// Debug builds also compare the path against the one already in its slot to catch hash collisions.
+//
+template <typename T, typename LoadFunction>
+uint32_t AssetRegistry::Intern(sAssetTable<T>& table, sAssetPath const& path, LoadFunction const& load)
+{
+    ++m_stats.m_internCount;
+
+    if (m_isSealed)
+    {
+        ++m_stats.m_lateLookupCount;
+        DebuggerPrintf("AssetRegistry: \"%s\" looked up by path after startup; intern it once and keep the handle.\n", path.m_path);
+    }
+
+    auto const found = table.m_indexByHash.find(path.m_hash);
+
+    if (found != table.m_indexByHash.end())
+    {
+#if defined(_DEBUG)
+        GUARANTEE_OR_DIE(table.m_paths[found->second] == path.m_path, Stringf("AssetRegistry: hash collision between \"%s\" and \"%s\"", table.m_paths[found->second].c_str(), path.m_path))
+#endif
+
+        return found->second;
+    }
+
+    return Add(table, path, load(path.m_path));
+}
+
+//----------------------------------------------------------------------------------------------------
+// A path registered twice keeps its first asset.
+//
+template <typename T>
+uint32_t AssetRegistry::Add(sAssetTable<T>& table, sAssetPath const& path, T const& asset)
+{
+    auto const found = table.m_indexByHash.find(path.m_hash);
+
+    if (found != table.m_indexByHash.end())
+    {
+        return found->second;
+    }
+
+    uint32_t const index = static_cast<uint32_t>(table.m_assets.size());
+
+    table.m_assets.push_back(asset);
+    table.m_paths.emplace_back(path.m_path);
+    table.m_indexByHash.emplace(path.m_hash, index);
+
+    return index;
+}
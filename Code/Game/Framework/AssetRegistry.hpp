@@ -0,0 +1,159 @@
+//----------------------------------------------------------------------------------------------------
+// AssetRegistry.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Audio/AudioSystem.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Game/Framework/TextureAtlas.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class BitmapFont;
+class Shader;
+class Texture;
+
+//----------------------------------------------------------------------------------------------------
+// 64-bit FNV-1a. constexpr so literal paths are hashed by the compiler, never at runtime.
+//
+constexpr uint64_t HashAssetPath(char const* path)
+{
+    uint64_t hash = 14695981039346656037ull;
+
+    for (; *path != '\0'; ++path)
+    {
+        hash ^= static_cast<uint8_t>(*path);
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------------------
+struct sAssetPath
+{
+    constexpr explicit sAssetPath(char const* path)
+        : m_path(path),
+          m_hash(HashAssetPath(path))
+    {
+    }
+
+    char const* m_path = nullptr;
+    uint64_t    m_hash = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class eAssetType : int8_t
+{
+    TEXTURE,
+    SHADER,
+    SOUND,
+    FONT
+};
+
+//----------------------------------------------------------------------------------------------------
+// Dense index into one of the AssetRegistry's per-type tables. The type parameter only keeps a
+// texture handle from being passed where a sound handle is expected.
+//
+template <eAssetType Type>
+struct sAssetHandle
+{
+    static uint32_t constexpr INVALID_INDEX = UINT32_MAX;
+
+    bool IsValid() const { return m_index != INVALID_INDEX; }
+
+    uint32_t m_index = INVALID_INDEX;
+};
+
+using sTextureHandle = sAssetHandle<eAssetType::TEXTURE>;
+using sShaderHandle  = sAssetHandle<eAssetType::SHADER>;
+using sSoundHandle   = sAssetHandle<eAssetType::SOUND>;
+using sFontHandle    = sAssetHandle<eAssetType::FONT>;
+
+//----------------------------------------------------------------------------------------------------
+struct sAssetLookupStats
+{
+    uint32_t m_internCount     = 0;     // Intern* calls of any kind
+    uint32_t m_lateLookupCount = 0;     // Intern* calls made after SealStartup; each one is a bug
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Resolves asset paths to typed handles once, then serves the assets by index.
+/// Intern* is keyed by the path's precomputed hash; the path string itself is only handed to the
+/// Engine's CreateOrGet* the first time it is seen. Once App::Startup calls SealStartup, every
+/// further Intern* is counted and reported, since it means a path lookup has crept into a frame.
+/// When a baked TextureAtlas is loaded, a texture that was packed into it resolves to the atlas
+/// page, and GetTextureUVs returns its sub-rectangle; every other texture's UVs are [0,1].
+/// App::Startup loads Data/Images/Atlas.txt when the -bakeatlas output is present.
+class AssetRegistry
+{
+public:
+    sTextureHandle InternTexture(sAssetPath const& path);
+    sShaderHandle  InternShader(sAssetPath const& path);
+    sSoundHandle   InternSound(sAssetPath const& path);
+    sFontHandle    InternFont(sAssetPath const& path);
+
+    // For assets loaded some other way (AssetPreloader); later Intern* calls for the path hit them.
+    void RegisterTexture(sAssetPath const& path, Texture* texture);
+    void RegisterShader(sAssetPath const& path, Shader* shader);
+    void RegisterSound(sAssetPath const& path, SoundID sound);
+    void RegisterFont(sAssetPath const& path, BitmapFont* font);
+
+    Texture*    GetTexture(sTextureHandle handle) const;
+    uint64_t    GetTextureKey(sTextureHandle handle) const;     // Path hash of the file the Texture came from; 0 if invalid
+    AABB2       GetTextureUVs(sTextureHandle handle) const;
+    Shader*     GetShader(sShaderHandle handle) const;
+    SoundID     GetSound(sSoundHandle handle) const;
+    BitmapFont* GetFont(sFontHandle handle) const;
+
+    bool                LoadTextureAtlas(char const* lookupFilePath);
+    TextureAtlas const& GetTextureAtlas() const;
+
+    void SealStartup();
+    bool IsSealed() const;
+
+    sAssetLookupStats const& GetStats() const;
+
+private:
+    template <typename T>
+    struct sAssetTable
+    {
+        std::vector<T>                         m_assets;
+        std::vector<std::string>               m_paths;     // Kept for hash collision checks and reports
+        std::unordered_map<uint64_t, uint32_t> m_indexByHash;
+    };
+
+    template <typename T, typename LoadFunction>
+    uint32_t Intern(sAssetTable<T>& table, sAssetPath const& path, LoadFunction const& load);
+
+    template <typename T>
+    uint32_t Add(sAssetTable<T>& table, sAssetPath const& path, T const& asset);
+
+    sAssetTable<Texture*>    m_textures;
+    std::vector<AABB2>       m_textureUVs;     // Parallel to m_textures; may be shorter, missing entries are [0,1]
+    TextureAtlas             m_textureAtlas;
+    sAssetTable<Shader*>     m_shaders;
+    sAssetTable<SoundID>     m_sounds;
+    sAssetTable<BitmapFont*> m_fonts;
+    bool                     m_isSealed = false;
+    sAssetLookupStats        m_stats;
+};
+
+//----------------------------------------------------------------------------------------------------
+extern AssetRegistry* g_theAssetRegistry;
+
+//----------------------------------------------------------------------------------------------------
+// Game asset paths
+//
+sAssetPath constexpr ASSET_TEXTURE_GOOP("Data/Images/goop.png");
+sAssetPath constexpr ASSET_TEXTURE_SERENITY("Data/Images/serenity.png");
+sAssetPath constexpr ASSET_SHADER_DEFAULT("Data/Shaders/Default");
+sAssetPath constexpr ASSET_SOUND_CLICK("Data/Audio/TestSound.mp3");
+sAssetPath constexpr ASSET_FONT_SQUIRREL_FIXED("Data/Fonts/SquirrelFixedFont");                 // No file extension
+sAssetPath constexpr ASSET_TEXTURE_SQUIRREL_FIXED_FONT("Data/Fonts/SquirrelFixedFont.png");     // The font's glyph sheet; only headless loads it directly
@@ -0,0 +1,22 @@
+//----------------------------------------------------------------------------------------------------
+// AudioDevice.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AudioDevice.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/AudioDevice_Engine.hpp"
+#include "Game/Framework/AudioDevice_Null.hpp"
+
+//----------------------------------------------------------------------------------------------------
+STATIC AudioDevice* AudioDevice::Create(eAudioDeviceType const type)
+{
+    switch (type)
+    {
+    case eAudioDeviceType::ENGINE:      return new EngineAudioDevice();
+    case eAudioDeviceType::NULL_DEVICE: return new NullAudioDevice();
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,35 @@
+//----------------------------------------------------------------------------------------------------
+// AudioDevice.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+#include "Engine/Audio/AudioSystem.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class eAudioDeviceType : int8_t
+{
+    ENGINE,     // Forwards to g_theAudio (FMOD)
+    NULL_DEVICE
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// What the audio thread drives. Every call may block for as long as the hardware takes; that is the
+/// point of calling it from the audio thread instead of the game thread.
+class AudioDevice
+{
+public:
+    virtual ~AudioDevice() = default;
+
+    virtual SoundPlaybackID StartVoice(SoundID sound, bool isLooped, float volume, float balance, float speed) = 0;
+    virtual void            StopVoice(SoundPlaybackID playback) = 0;
+    virtual void            SetVoiceVolume(SoundPlaybackID playback, float volume) = 0;
+    virtual void            SetVoiceBalance(SoundPlaybackID playback, float balance) = 0;
+    virtual bool            IsVoicePlaying(SoundPlaybackID playback) const = 0;
+    virtual void            Update() = 0;     // The driver's own per-tick work; replaces the AudioSystem's frame calls
+
+    static AudioDevice* Create(eAudioDeviceType type);
+};
@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------------------------------
+// AudioDevice_Engine.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AudioDevice_Engine.hpp"
+
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+std::mutex g_audioSystemMutex;
+
+//----------------------------------------------------------------------------------------------------
+SoundPlaybackID EngineAudioDevice::StartVoice(SoundID const sound, bool const isLooped, float const volume, float const balance, float const speed)
+{
+    std::lock_guard<std::mutex> lock(g_audioSystemMutex);
+
+    return g_theAudio->StartSound(sound, isLooped, volume, balance, speed);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineAudioDevice::StopVoice(SoundPlaybackID const playback)
+{
+    std::lock_guard<std::mutex> lock(g_audioSystemMutex);
+
+    g_theAudio->StopSound(playback);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineAudioDevice::SetVoiceVolume(SoundPlaybackID const playback, float const volume)
+{
+    std::lock_guard<std::mutex> lock(g_audioSystemMutex);
+
+    g_theAudio->SetSoundPlaybackVolume(playback, volume);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineAudioDevice::SetVoiceBalance(SoundPlaybackID const playback, float const balance)
+{
+    std::lock_guard<std::mutex> lock(g_audioSystemMutex);
+
+    g_theAudio->SetSoundPlaybackBalance(playback, balance);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EngineAudioDevice::IsVoicePlaying(SoundPlaybackID const playback) const
+{
+    std::lock_guard<std::mutex> lock(g_audioSystemMutex);
+
+    return g_theAudio->IsPlaying(playback);
+}
+
+//----------------------------------------------------------------------------------------------------
+// The AudioSystem's frame calls are just FMOD's update, so the audio thread runs both back to back.
+//
+void EngineAudioDevice::Update()
+{
+    std::lock_guard<std::mutex> lock(g_audioSystemMutex);
+
+    g_theAudio->BeginFrame();
+    g_theAudio->EndFrame();
+}
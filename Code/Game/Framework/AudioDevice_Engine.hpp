@@ -0,0 +1,31 @@
+//----------------------------------------------------------------------------------------------------
+// AudioDevice_Engine.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <mutex>
+
+#include "Game/Framework/AudioDevice.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// The Engine's AudioSystem is not thread-safe: FMOD's core API is, but the sound and playback tables
+// around it are not. The audio thread drives and ticks it through EngineAudioDevice; the main thread
+// only creates sounds, at startup, so every g_theAudio call made while the AudioService runs takes
+// this lock and the game frame itself never waits on it.
+//
+extern std::mutex g_audioSystemMutex;
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Plays through the Engine's AudioSystem, from the audio thread, under g_audioSystemMutex.
+class EngineAudioDevice : public AudioDevice
+{
+public:
+    SoundPlaybackID StartVoice(SoundID sound, bool isLooped, float volume, float balance, float speed) override;
+    void            StopVoice(SoundPlaybackID playback) override;
+    void            SetVoiceVolume(SoundPlaybackID playback, float volume) override;
+    void            SetVoiceBalance(SoundPlaybackID playback, float balance) override;
+    bool            IsVoicePlaying(SoundPlaybackID playback) const override;
+    void            Update() override;
+};
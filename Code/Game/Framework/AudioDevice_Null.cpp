@@ -0,0 +1,85 @@
+//----------------------------------------------------------------------------------------------------
+// AudioDevice_Null.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AudioDevice_Null.hpp"
+
+#include <limits>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+
+//----------------------------------------------------------------------------------------------------
+SoundPlaybackID NullAudioDevice::StartVoice(SoundID const sound, bool const isLooped, float const volume, float const balance, float const speed)
+{
+    UNUSED(sound)
+    UNUSED(volume)
+    UNUSED(balance)
+    UNUSED(speed)
+
+    SimulateCall();
+
+    SoundPlaybackID const playback = m_nextPlayback++;
+    m_voiceEndSeconds[playback]    = isLooped ? std::numeric_limits<double>::infinity() : GetSchedulerTimeSeconds() + m_voiceSeconds;
+    ++m_startCount;
+
+    return playback;
+}
+
+//----------------------------------------------------------------------------------------------------
+void NullAudioDevice::StopVoice(SoundPlaybackID const playback)
+{
+    SimulateCall();
+
+    m_voiceEndSeconds.erase(playback);
+    ++m_stopCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void NullAudioDevice::SetVoiceVolume(SoundPlaybackID const playback, float const volume)
+{
+    UNUSED(playback)
+    UNUSED(volume)
+
+    SimulateCall();
+}
+
+//----------------------------------------------------------------------------------------------------
+void NullAudioDevice::SetVoiceBalance(SoundPlaybackID const playback, float const balance)
+{
+    UNUSED(playback)
+    UNUSED(balance)
+
+    SimulateCall();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool NullAudioDevice::IsVoicePlaying(SoundPlaybackID const playback) const
+{
+    auto const found = m_voiceEndSeconds.find(playback);
+
+    return found != m_voiceEndSeconds.end() && GetSchedulerTimeSeconds() < found->second;
+}
+
+//----------------------------------------------------------------------------------------------------
+void NullAudioDevice::Update()
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+// Spins rather than sleeps: driver stalls are short and a sleep would round them up to the OS tick.
+//
+void NullAudioDevice::SimulateCall() const
+{
+    if (m_callSeconds <= 0.0)
+    {
+        return;
+    }
+
+    double const endSeconds = GetSchedulerTimeSeconds() + m_callSeconds;
+
+    while (GetSchedulerTimeSeconds() < endSeconds)
+    {
+    }
+}
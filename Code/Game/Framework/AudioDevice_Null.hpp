@@ -0,0 +1,37 @@
+//----------------------------------------------------------------------------------------------------
+// AudioDevice_Null.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <unordered_map>
+
+#include "Game/Framework/AudioDevice.hpp"
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Silent device for headless runs and benchmarks. Every voice "plays" for m_voiceSeconds, and each
+/// call can be made to take m_callSeconds so a slow driver can be simulated without a sound card.
+/// Accessed from the audio thread only.
+class NullAudioDevice : public AudioDevice
+{
+public:
+    SoundPlaybackID StartVoice(SoundID sound, bool isLooped, float volume, float balance, float speed) override;
+    void            StopVoice(SoundPlaybackID playback) override;
+    void            SetVoiceVolume(SoundPlaybackID playback, float volume) override;
+    void            SetVoiceBalance(SoundPlaybackID playback, float balance) override;
+    bool            IsVoicePlaying(SoundPlaybackID playback) const override;
+    void            Update() override;
+
+    double m_voiceSeconds = 0.5;
+    double m_callSeconds  = 0.0;
+
+    uint64_t m_startCount = 0;
+    uint64_t m_stopCount  = 0;
+
+private:
+    void SimulateCall() const;
+
+    SoundPlaybackID                             m_nextPlayback = 1;
+    std::unordered_map<SoundPlaybackID, double> m_voiceEndSeconds;     // Looped voices end at +inf
+};
@@ -0,0 +1,393 @@
+//----------------------------------------------------------------------------------------------------
+// AudioService.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AudioService.hpp"
+
+#include <chrono>
+
+#include "Game/Framework/AudioDevice.hpp"
+#include "Game/Framework/AudioDevice_Null.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+AudioService* g_theAudioService = nullptr;     // Created and owned by the App
+
+//----------------------------------------------------------------------------------------------------
+AudioService::AudioService(AudioDevice* device, sAudioServiceConfig const& config)
+    : m_device(device),
+      m_config(config)
+{
+    m_voices.resize(static_cast<size_t>(m_config.m_voiceCount));
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioService::~AudioService()
+{
+    Shutdown();
+    GAME_SAFE_RELEASE(m_device);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioService::Startup()
+{
+    m_isRunning.store(true);
+    m_audioThread = std::thread(&AudioService::RunAudioThread, this);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Commands still queued are executed before the thread exits, then every voice is stopped.
+//
+void AudioService::Shutdown()
+{
+    if (!m_audioThread.joinable())
+    {
+        return;
+    }
+
+    m_isRunning.store(false);
+    m_audioThread.join();
+
+    for (sVoice& voice : m_voices)
+    {
+        if (voice.m_voiceId != 0)
+        {
+            m_device->StopVoice(voice.m_playback);
+            voice.m_voiceId = 0;
+        }
+    }
+
+    m_activeVoiceCount.store(0);
+}
+
+//----------------------------------------------------------------------------------------------------
+sAudioVoiceHandle AudioService::PlaySound(SoundID const sound, sPlaySoundParams const& params)
+{
+    sAudioVoiceHandle handle;
+    handle.m_voiceId = m_nextVoiceId++;
+
+    if (m_nextVoiceId == 0)
+    {
+        m_nextVoiceId = 1;
+    }
+
+    sAudioCommand command;
+    command.m_type    = eAudioCommandType::START;
+    command.m_voiceId = handle.m_voiceId;
+    command.m_sound   = sound;
+    command.m_params  = params;
+
+    return Post(command) ? handle : sAudioVoiceHandle();
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioService::StopVoice(sAudioVoiceHandle const handle)
+{
+    sAudioCommand command;
+    command.m_type    = eAudioCommandType::STOP;
+    command.m_voiceId = handle.m_voiceId;
+
+    Post(command);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioService::SetVoiceVolume(sAudioVoiceHandle const handle, float const volume)
+{
+    sAudioCommand command;
+    command.m_type            = eAudioCommandType::SET_VOLUME;
+    command.m_voiceId         = handle.m_voiceId;
+    command.m_params.m_volume = volume;
+
+    Post(command);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioService::SetVoiceBalance(sAudioVoiceHandle const handle, float const balance)
+{
+    sAudioCommand command;
+    command.m_type             = eAudioCommandType::SET_BALANCE;
+    command.m_voiceId          = handle.m_voiceId;
+    command.m_params.m_balance = balance;
+
+    Post(command);
+}
+
+//----------------------------------------------------------------------------------------------------
+sAudioServiceStats AudioService::GetStats() const
+{
+    sAudioServiceStats stats;
+    stats.m_commandsPosted    = m_commandsPosted;
+    stats.m_commandsDropped   = m_commandsDropped;
+    stats.m_commandsProcessed = m_commandsProcessed.load(std::memory_order_relaxed);
+    stats.m_voicesStarted     = m_voicesStarted.load(std::memory_order_relaxed);
+    stats.m_voicesStolen      = m_voicesStolen.load(std::memory_order_relaxed);
+    stats.m_voicesRejected    = m_voicesRejected.load(std::memory_order_relaxed);
+    stats.m_queueDepth        = m_commands.GetApproximateSize();
+    stats.m_maxQueueDepth     = m_maxQueueDepth;
+    stats.m_activeVoiceCount  = m_activeVoiceCount.load(std::memory_order_relaxed);
+    stats.m_maxLatencySeconds = static_cast<double>(m_maxLatencyNanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+
+    if (stats.m_commandsProcessed > 0)
+    {
+        stats.m_averageLatencySeconds = static_cast<double>(m_totalLatencyNanoseconds.load(std::memory_order_relaxed)) * 1e-9 / static_cast<double>(stats.m_commandsProcessed);
+    }
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioDevice* AudioService::GetDevice() const
+{
+    return m_device;
+}
+
+//----------------------------------------------------------------------------------------------------
+// A full queue drops the command rather than blocking the game thread; the drop is counted.
+//
+bool AudioService::Post(sAudioCommand& command)
+{
+    command.m_postSeconds = GetSchedulerTimeSeconds();
+
+    if (!m_commands.TryPush(command))
+    {
+        ++m_commandsDropped;
+        return false;
+    }
+
+    ++m_commandsPosted;
+
+    uint32_t const queueDepth = m_commands.GetApproximateSize();
+
+    if (queueDepth > m_maxQueueDepth)
+    {
+        m_maxQueueDepth = queueDepth;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioService::RunAudioThread()
+{
+    auto const idleSleep = std::chrono::duration<double>(m_config.m_idleSleepSeconds);
+
+    for (;;)
+    {
+        bool const    isRunning      = m_isRunning.load();
+        int           processedCount = 0;
+        sAudioCommand command;
+
+        while (m_commands.TryPop(command))
+        {
+            ExecuteCommand(command);
+            ++processedCount;
+        }
+
+        if (!isRunning)
+        {
+            return;
+        }
+
+        double const nowSeconds = GetSchedulerTimeSeconds();
+
+        if (nowSeconds - m_lastReclaimSeconds >= m_config.m_reclaimIntervalSeconds)
+        {
+            ReclaimFinishedVoices();
+            m_lastReclaimSeconds = nowSeconds;
+        }
+
+        if (nowSeconds - m_lastUpdateSeconds >= m_config.m_updateIntervalSeconds)
+        {
+            m_device->Update();
+            m_lastUpdateSeconds = nowSeconds;
+        }
+
+        if (processedCount == 0)
+        {
+            std::this_thread::sleep_for(idleSleep);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioService::ExecuteCommand(sAudioCommand const& command)
+{
+    uint64_t const latencyNanoseconds = static_cast<uint64_t>((GetSchedulerTimeSeconds() - command.m_postSeconds) * 1e9);
+
+    m_totalLatencyNanoseconds.fetch_add(latencyNanoseconds, std::memory_order_relaxed);
+
+    if (latencyNanoseconds > m_maxLatencyNanoseconds.load(std::memory_order_relaxed))
+    {
+        m_maxLatencyNanoseconds.store(latencyNanoseconds, std::memory_order_relaxed);
+    }
+
+    if (command.m_type == eAudioCommandType::START)
+    {
+        sVoice* voice = AcquireVoice(command.m_params.m_priority);
+
+        if (voice == nullptr)
+        {
+            m_voicesRejected.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            sPlaySoundParams const& params = command.m_params;
+
+            voice->m_voiceId       = command.m_voiceId;
+            voice->m_priority      = params.m_priority;
+            voice->m_startSequence = m_nextStartSequence++;
+            voice->m_playback      = m_device->StartVoice(command.m_sound, params.m_isLooped, params.m_volume, params.m_balance, params.m_speed);
+
+            m_voicesStarted.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    else if (sVoice* voice = FindVoice(command.m_voiceId))
+    {
+        switch (command.m_type)
+        {
+        case eAudioCommandType::STOP:
+            m_device->StopVoice(voice->m_playback);
+            voice->m_voiceId = 0;
+            m_activeVoiceCount.fetch_sub(1, std::memory_order_relaxed);
+            break;
+        case eAudioCommandType::SET_VOLUME:  m_device->SetVoiceVolume(voice->m_playback, command.m_params.m_volume); break;
+        case eAudioCommandType::SET_BALANCE: m_device->SetVoiceBalance(voice->m_playback, command.m_params.m_balance); break;
+        case eAudioCommandType::START:       break;
+        }
+    }
+
+    m_commandsProcessed.fetch_add(1, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioService::ReclaimFinishedVoices()
+{
+    for (sVoice& voice : m_voices)
+    {
+        if (voice.m_voiceId != 0 && !m_device->IsVoicePlaying(voice.m_playback))
+        {
+            voice.m_voiceId = 0;
+            m_activeVoiceCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioService::sVoice* AudioService::FindVoice(uint32_t const voiceId)
+{
+    if (voiceId == 0)
+    {
+        return nullptr;
+    }
+
+    for (sVoice& voice : m_voices)
+    {
+        if (voice.m_voiceId == voiceId)
+        {
+            return &voice;
+        }
+    }
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Free slot first; failing that, reclaim voices that have finished; failing that, steal the
+// lowest-priority voice (oldest among equals) as long as it does not outrank the new one.
+//
+AudioService::sVoice* AudioService::AcquireVoice(uint8_t const priority)
+{
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (sVoice& voice : m_voices)
+        {
+            if (voice.m_voiceId == 0)
+            {
+                m_activeVoiceCount.fetch_add(1, std::memory_order_relaxed);
+                return &voice;
+            }
+        }
+
+        if (pass == 0)
+        {
+            ReclaimFinishedVoices();
+        }
+    }
+
+    sVoice* victim = nullptr;
+
+    for (sVoice& voice : m_voices)
+    {
+        if (victim == nullptr || voice.m_priority < victim->m_priority ||
+            (voice.m_priority == victim->m_priority && voice.m_startSequence < victim->m_startSequence))
+        {
+            victim = &voice;
+        }
+    }
+
+    if (victim == nullptr || victim->m_priority > priority)
+    {
+        return nullptr;
+    }
+
+    m_device->StopVoice(victim->m_playback);
+    m_voicesStolen.fetch_add(1, std::memory_order_relaxed);
+
+    return victim;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Each run posts commands in bursts of eight, one burst per millisecond, the way a busy game thread
+// would; every fourth voice is stopped right after it is started.
+//
+void RunAudioServiceBenchmark(std::vector<sAudioBenchmarkResult>& outResults)
+{
+    int constexpr    COMMAND_COUNT  = 4000;
+    int constexpr    BURST_SIZE     = 8;
+    double constexpr CALL_SECONDS[] = { 0.0, 0.00005, 0.0005 };
+
+    for (double const callSeconds : CALL_SECONDS)
+    {
+        NullAudioDevice* device = new NullAudioDevice();
+        device->m_callSeconds   = callSeconds;
+        device->m_voiceSeconds  = 0.05;
+
+        AudioService service(device);
+        service.Startup();
+
+        double postSeconds = 0.0;
+
+        for (int commandIndex = 0; commandIndex < COMMAND_COUNT; ++commandIndex)
+        {
+            sPlaySoundParams params;
+            params.m_priority = static_cast<uint8_t>(commandIndex % 3 == 0 ? 200 : 100);
+
+            double const            postStartSeconds = GetSchedulerTimeSeconds();
+            sAudioVoiceHandle const handle           = service.PlaySound(1, params);
+
+            if (commandIndex % 4 == 3)
+            {
+                service.StopVoice(handle);
+            }
+
+            postSeconds += GetSchedulerTimeSeconds() - postStartSeconds;
+
+            if (commandIndex % BURST_SIZE == BURST_SIZE - 1)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        service.Shutdown();
+
+        sAudioBenchmarkResult result;
+        result.m_commandCount    = COMMAND_COUNT;
+        result.m_callSeconds     = callSeconds;
+        result.m_postNanoseconds = postSeconds * 1e9 / COMMAND_COUNT;
+        result.m_stats           = service.GetStats();
+
+        outResults.push_back(result);
+    }
+}
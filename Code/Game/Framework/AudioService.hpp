@@ -0,0 +1,166 @@
+//----------------------------------------------------------------------------------------------------
+// AudioService.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "Engine/Audio/AudioSystem.hpp"
+#include "Game/Framework/SPSCQueue.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class AudioDevice;
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioServiceConfig
+{
+    int    m_voiceCount             = 32;        // Preallocated; starts beyond this steal or are rejected
+    double m_idleSleepSeconds       = 0.001;     // Audio thread sleep when the queue is empty
+    double m_reclaimIntervalSeconds = 0.05;      // How often finished voices are returned to the pool
+    double m_updateIntervalSeconds  = 0.016;     // How often the device's own update runs
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sPlaySoundParams
+{
+    bool    m_isLooped = false;
+    float   m_volume   = 1.f;
+    float   m_balance  = 0.f;
+    float   m_speed    = 1.f;
+    uint8_t m_priority = 128;     // Higher wins; a full pool steals from the lowest, oldest first
+};
+
+//----------------------------------------------------------------------------------------------------
+// Issued by the game thread before the voice exists, so Stop/Set* can be posted right after PlaySound.
+// A handle whose start was rejected, stolen or has finished is simply ignored by later commands.
+//
+struct sAudioVoiceHandle
+{
+    bool IsValid() const { return m_voiceId != 0; }
+
+    uint32_t m_voiceId = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioServiceStats
+{
+    uint64_t m_commandsPosted        = 0;
+    uint64_t m_commandsDropped       = 0;       // Queue full at post time
+    uint64_t m_commandsProcessed     = 0;
+    uint64_t m_voicesStarted         = 0;
+    uint64_t m_voicesStolen          = 0;
+    uint64_t m_voicesRejected        = 0;       // Pool full of higher-priority voices
+    uint32_t m_queueDepth            = 0;
+    uint32_t m_maxQueueDepth         = 0;
+    int      m_activeVoiceCount      = 0;
+    double   m_averageLatencySeconds = 0.0;     // Post to start of execution on the audio thread
+    double   m_maxLatencySeconds     = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Moves every audio device call off the game thread.
+/// The game thread posts start/stop/volume/balance commands into a lock-free SPSC queue and returns
+/// immediately; a dedicated audio thread drains the queue and drives the AudioDevice, so a slow
+/// driver call stalls only that thread. The audio thread also runs the device's own update, so the
+/// game frame never calls into the AudioSystem. Voices come from a fixed preallocated pool owned by
+/// the audio thread. Only one thread may post (the game thread); the queue is single-producer.
+class AudioService
+{
+public:
+    explicit AudioService(AudioDevice* device, sAudioServiceConfig const& config = sAudioServiceConfig());     // Takes ownership of device
+    ~AudioService();
+
+    void Startup();
+    void Shutdown();
+
+    sAudioVoiceHandle PlaySound(SoundID sound, sPlaySoundParams const& params = sPlaySoundParams());
+    void              StopVoice(sAudioVoiceHandle handle);
+    void              SetVoiceVolume(sAudioVoiceHandle handle, float volume);
+    void              SetVoiceBalance(sAudioVoiceHandle handle, float balance);
+
+    sAudioServiceStats GetStats() const;
+    AudioDevice*       GetDevice() const;
+
+private:
+    enum class eAudioCommandType : uint8_t
+    {
+        START,
+        STOP,
+        SET_VOLUME,
+        SET_BALANCE
+    };
+
+    struct sAudioCommand
+    {
+        eAudioCommandType m_type        = eAudioCommandType::START;
+        uint32_t          m_voiceId     = 0;
+        SoundID           m_sound       = MISSING_SOUND_ID;
+        sPlaySoundParams  m_params;
+        double            m_postSeconds = 0.0;
+    };
+
+    struct sVoice
+    {
+        uint32_t        m_voiceId       = 0;     // 0 while the slot is free
+        SoundPlaybackID m_playback      = 0;
+        uint8_t         m_priority      = 0;
+        uint64_t        m_startSequence = 0;
+    };
+
+    bool    Post(sAudioCommand& command);
+    void    RunAudioThread();
+    void    ExecuteCommand(sAudioCommand const& command);
+    void    ReclaimFinishedVoices();
+    sVoice* FindVoice(uint32_t voiceId);
+    sVoice* AcquireVoice(uint8_t priority);
+
+    AudioDevice*        m_device = nullptr;
+    sAudioServiceConfig m_config;
+    std::thread         m_audioThread;
+    std::atomic<bool>   m_isRunning{false};
+
+    SPSCQueue<sAudioCommand, 256> m_commands;
+
+    // Game thread only
+    uint32_t m_nextVoiceId     = 1;
+    uint64_t m_commandsPosted  = 0;
+    uint64_t m_commandsDropped = 0;
+    uint32_t m_maxQueueDepth   = 0;
+
+    // Audio thread only
+    std::vector<sVoice> m_voices;
+    uint64_t            m_nextStartSequence  = 0;
+    double              m_lastReclaimSeconds = 0.0;
+    double              m_lastUpdateSeconds  = 0.0;
+
+    // Written by the audio thread, read by GetStats
+    std::atomic<uint64_t> m_commandsProcessed{0};
+    std::atomic<uint64_t> m_voicesStarted{0};
+    std::atomic<uint64_t> m_voicesStolen{0};
+    std::atomic<uint64_t> m_voicesRejected{0};
+    std::atomic<uint64_t> m_totalLatencyNanoseconds{0};
+    std::atomic<uint64_t> m_maxLatencyNanoseconds{0};
+    std::atomic<int>      m_activeVoiceCount{0};
+};
+
+//----------------------------------------------------------------------------------------------------
+extern AudioService* g_theAudioService;
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioBenchmarkResult
+{
+    int                m_commandCount    = 0;
+    double             m_callSeconds     = 0.0;     // Simulated device cost per call
+    double             m_postNanoseconds = 0.0;     // Game-thread cost per PlaySound
+    sAudioServiceStats m_stats;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Posts bursts of PlaySound/Stop against a NullAudioDevice with several simulated driver costs.
+//
+void RunAudioServiceBenchmark(std::vector<sAudioBenchmarkResult>& outResults);
@@ -0,0 +1,617 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStream.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AudioStream.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Game/Framework/AudioStreamOutput_Null.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+AudioStreamer* g_theAudioStreamer = nullptr;     // Created and owned by the App
+
+//----------------------------------------------------------------------------------------------------
+static void UpdateAtomicMax(std::atomic<uint64_t>& maxValue, uint64_t const value)
+{
+    uint64_t previous = maxValue.load(std::memory_order_relaxed);
+
+    while (value > previous && !maxValue.compare_exchange_weak(previous, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioStream::AudioStream(AudioStreamDecoder* decoder, sAudioStreamConfig const& config, bool const isLooped, AudioStreamer* streamer)
+    : m_decoder(decoder),
+      m_streamer(streamer),
+      m_format(decoder->GetFormat()),
+      m_isLooped(isLooped)
+{
+    m_ringFrameCount = 1;
+
+    while (m_ringFrameCount < static_cast<uint32_t>(std::max(config.m_ringFrameCount, 64)))
+    {
+        m_ringFrameCount <<= 1;
+    }
+
+    m_ringFrameMask    = m_ringFrameCount - 1;
+    m_refillFrameCount = static_cast<uint32_t>(static_cast<float>(m_ringFrameCount) * config.m_refillThreshold);
+    m_decodeFrameCount = std::max(config.m_decodeFrameCount, 1);
+
+    m_ring.resize(static_cast<size_t>(m_ringFrameCount) * m_format.m_channelCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioStream::~AudioStream()
+{
+    GAME_SAFE_RELEASE(m_decoder);
+}
+
+//----------------------------------------------------------------------------------------------------
+// At most two copies (the read may wrap around the end of the ring), then one release store.
+//
+int AudioStream::ReadFrames(float* outSamples, int const frameCount)
+{
+    uint32_t const readFrame    = m_readFrame.load(std::memory_order_relaxed);
+    uint32_t const writeFrame   = m_writeFrame.load(std::memory_order_acquire);
+    uint32_t const unreadFrames = writeFrame - readFrame;
+    uint32_t const copyFrames   = std::min(unreadFrames, static_cast<uint32_t>(frameCount));
+    size_t const   channelCount = static_cast<size_t>(m_format.m_channelCount);
+
+    uint32_t const ringOffset = readFrame & m_ringFrameMask;
+    uint32_t const firstCopy  = std::min(copyFrames, m_ringFrameCount - ringOffset);
+
+    memcpy(outSamples, &m_ring[ringOffset * channelCount], firstCopy * channelCount * sizeof(float));
+    memcpy(outSamples + firstCopy * channelCount, m_ring.data(), (copyFrames - firstCopy) * channelCount * sizeof(float));
+
+    m_readFrame.store(readFrame + copyFrames, std::memory_order_release);
+
+    if (copyFrames < static_cast<uint32_t>(frameCount))
+    {
+        memset(outSamples + copyFrames * channelCount, 0, (frameCount - copyFrames) * channelCount * sizeof(float));
+
+        if (!m_isDecodeFinished.load(std::memory_order_relaxed))
+        {
+            m_underrunFrameCount.fetch_add(frameCount - copyFrames, std::memory_order_relaxed);
+        }
+    }
+
+    // Wake the streaming thread once per drain below the threshold rather than on every read.
+    if (unreadFrames - copyFrames < m_refillFrameCount && !m_isRefillRequested.exchange(true, std::memory_order_relaxed) && m_streamer != nullptr)
+    {
+        m_streamer->WakeStreamingThread();
+    }
+
+    return static_cast<int>(copyFrames);
+}
+
+//----------------------------------------------------------------------------------------------------
+// The decoder writes straight into the ring, one contiguous span at a time, and each span is
+// published as soon as it is decoded so a starving output can start on it. A looped track rewinds
+// at its end; a decoder that yields nothing even after a rewind ends the stream.
+//
+int AudioStream::Refill()
+{
+    size_t const channelCount  = static_cast<size_t>(m_format.m_channelCount);
+    int          decodedFrames = 0;
+    bool         isJustRewound = false;
+
+    m_isRefillRequested.store(false, std::memory_order_relaxed);
+
+    while (!m_isDecodeFinished.load(std::memory_order_relaxed))
+    {
+        uint32_t const writeFrame = m_writeFrame.load(std::memory_order_relaxed);
+        uint32_t const readFrame  = m_readFrame.load(std::memory_order_acquire);
+        uint32_t const freeFrames = m_ringFrameCount - (writeFrame - readFrame);
+
+        if (freeFrames == 0)
+        {
+            break;
+        }
+
+        uint32_t const ringOffset = writeFrame & m_ringFrameMask;
+        uint32_t const spanFrames = std::min({ freeFrames, m_ringFrameCount - ringOffset, static_cast<uint32_t>(m_decodeFrameCount) });
+        int const      frameCount = m_decoder->DecodeFrames(&m_ring[ringOffset * channelCount], static_cast<int>(spanFrames));
+
+        if (frameCount > 0)
+        {
+            m_writeFrame.store(writeFrame + static_cast<uint32_t>(frameCount), std::memory_order_release);
+            decodedFrames += frameCount;
+            isJustRewound  = false;
+        }
+        else if (m_isLooped && !isJustRewound && m_decoder->Rewind())
+        {
+            isJustRewound = true;
+        }
+        else
+        {
+            m_isDecodeFinished.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    return decodedFrames;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AudioStream::NeedsRefill() const
+{
+    if (m_isDecodeFinished.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    uint32_t const unreadFrames = m_writeFrame.load(std::memory_order_relaxed) - m_readFrame.load(std::memory_order_relaxed);
+
+    return unreadFrames < m_refillFrameCount || m_isRefillRequested.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AudioStream::IsFinished() const
+{
+    return m_isDecodeFinished.load(std::memory_order_acquire) && m_readFrame.load(std::memory_order_acquire) == m_writeFrame.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+sAudioStreamFormat const& AudioStream::GetFormat() const
+{
+    return m_format;
+}
+
+//----------------------------------------------------------------------------------------------------
+int AudioStream::GetResidentBytes() const
+{
+    return static_cast<int>(m_ring.capacity() * sizeof(float)) + m_decoder->GetScratchBytes();
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t AudioStream::GetUnderrunFrameCount() const
+{
+    return m_underrunFrameCount.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioStreamer::AudioStreamer(sAudioStreamerConfig const& config)
+    : m_config(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioStreamer::~AudioStreamer()
+{
+    Shutdown();
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioStreamer::Startup()
+{
+    m_isRunning.store(true);
+    m_streamingThread = std::thread(&AudioStreamer::RunStreamingThread, this);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Every stream is stopped and freed on the streaming thread before it exits.
+//
+void AudioStreamer::Shutdown()
+{
+    if (!m_streamingThread.joinable())
+    {
+        return;
+    }
+
+    m_isRunning.store(false);
+    WakeStreamingThread();
+    m_streamingThread.join();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Nothing here touches the file system; opening the decoder is the streaming thread's job.
+//
+sAudioStreamHandle AudioStreamer::PlayStream(std::string const& filePath, bool const isLooped, float const volume)
+{
+    sAudioStreamHandle handle;
+
+    {
+        std::lock_guard<std::mutex> lock(m_requestMutex);
+
+        handle.m_streamId = m_nextStreamId++;
+
+        if (m_nextStreamId == 0)
+        {
+            m_nextStreamId = 1;
+        }
+
+        sStreamRequest request;
+        request.m_streamId = handle.m_streamId;
+        request.m_filePath = filePath;
+        request.m_isLooped = isLooped;
+        request.m_volume   = volume;
+
+        m_pendingOpens.push_back(request);
+        m_liveStreamIds.push_back(handle.m_streamId);
+    }
+
+    WakeStreamingThread();
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioStreamer::StopStream(sAudioStreamHandle const handle)
+{
+    if (!handle.IsValid())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_requestMutex);
+        m_pendingStops.push_back(handle.m_streamId);
+    }
+
+    WakeStreamingThread();
+}
+
+//----------------------------------------------------------------------------------------------------
+// True from PlayStream until the track has played out, been stopped or failed to open.
+//
+bool AudioStreamer::IsStreamPlaying(sAudioStreamHandle const handle) const
+{
+    std::lock_guard<std::mutex> lock(m_requestMutex);
+
+    return std::find(m_liveStreamIds.begin(), m_liveStreamIds.end(), handle.m_streamId) != m_liveStreamIds.end();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Called from playback threads, so it never takes m_requestMutex. A wake that races the streaming
+// thread going to sleep is lost, which only delays the refill until the next poll.
+//
+void AudioStreamer::WakeStreamingThread()
+{
+    m_wakeCondition.notify_one();
+}
+
+//----------------------------------------------------------------------------------------------------
+sAudioStreamStats AudioStreamer::GetStats() const
+{
+    sAudioStreamStats stats;
+
+    {
+        std::lock_guard<std::mutex> lock(m_requestMutex);
+        stats.m_activeStreamCount = static_cast<int>(m_liveStreamIds.size());
+    }
+
+    stats.m_failedOpenCount    = m_failedOpenCount.load(std::memory_order_relaxed);
+    stats.m_residentBytes      = m_residentBytes.load(std::memory_order_relaxed);
+    stats.m_refillCount        = m_refillCount.load(std::memory_order_relaxed);
+    stats.m_decodedFrameCount  = m_decodedFrameCount.load(std::memory_order_relaxed);
+    stats.m_underrunFrameCount = m_retiredUnderrunFrameCount.load(std::memory_order_relaxed) + m_liveUnderrunFrameCount.load(std::memory_order_relaxed);
+    stats.m_totalDecodeSeconds = static_cast<double>(m_totalDecodeNanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+    stats.m_maxRefillSeconds   = static_cast<double>(m_maxRefillNanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+    stats.m_maxStartSeconds    = static_cast<double>(m_maxStartNanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Each pass: take the queued opens and stops, top up every ring that asked for it, retire streams
+// that have played out, then sleep until an output drains a ring or the poll interval passes. Every
+// decoder is opened and closed on this thread, so it owns the decoders' platform setup too.
+//
+void AudioStreamer::RunStreamingThread()
+{
+    std::vector<sStreamRequest> opens;
+    std::vector<uint32_t>       stops;
+
+    bool const isDecoderThreadStarted = AudioStreamDecoder::StartupDecoderThread();
+
+    if (!isDecoderThreadStarted)
+    {
+        DebuggerPrintf("AudioStreamer: platform decoder startup failed; only WAV files will stream\n");
+    }
+
+    while (true)
+    {
+        bool const isRunning = m_isRunning.load();
+
+        {
+            std::lock_guard<std::mutex> lock(m_requestMutex);
+            opens.swap(m_pendingOpens);
+            stops.swap(m_pendingStops);
+        }
+
+        if (isRunning)
+        {
+            for (sStreamRequest const& request : opens)
+            {
+                if (std::find(stops.begin(), stops.end(), request.m_streamId) == stops.end())
+                {
+                    OpenStream(request);
+                }
+            }
+        }
+
+        uint64_t residentBytes = 0;
+        uint64_t liveUnderruns = 0;
+
+        for (size_t streamIndex = 0; streamIndex < m_activeStreams.size();)
+        {
+            sActiveStream& activeStream = m_activeStreams[streamIndex];
+            bool const     isStopped    = !isRunning || std::find(stops.begin(), stops.end(), activeStream.m_streamId) != stops.end();
+
+            if (!isStopped && activeStream.m_stream->NeedsRefill())
+            {
+                double const   refillStartSeconds = GetSchedulerTimeSeconds();
+                int const      decodedFrames      = activeStream.m_stream->Refill();
+                uint64_t const refillNanoseconds  = static_cast<uint64_t>((GetSchedulerTimeSeconds() - refillStartSeconds) * 1e9);
+
+                m_refillCount.fetch_add(1, std::memory_order_relaxed);
+                m_decodedFrameCount.fetch_add(static_cast<uint64_t>(decodedFrames), std::memory_order_relaxed);
+                m_totalDecodeNanoseconds.fetch_add(refillNanoseconds, std::memory_order_relaxed);
+                UpdateAtomicMax(m_maxRefillNanoseconds, refillNanoseconds);
+            }
+
+            if (isStopped || activeStream.m_stream->IsFinished())
+            {
+                CloseStream(activeStream);
+                m_activeStreams.erase(m_activeStreams.begin() + static_cast<std::ptrdiff_t>(streamIndex));
+                continue;
+            }
+
+            residentBytes += static_cast<uint64_t>(activeStream.m_stream->GetResidentBytes());
+            liveUnderruns += activeStream.m_stream->GetUnderrunFrameCount();
+            ++streamIndex;
+        }
+
+        m_residentBytes.store(residentBytes, std::memory_order_relaxed);
+        m_liveUnderrunFrameCount.store(liveUnderruns, std::memory_order_relaxed);
+
+        if (!isRunning)
+        {
+            std::lock_guard<std::mutex> lock(m_requestMutex);
+            m_liveStreamIds.clear();
+            break;
+        }
+
+        if (!stops.empty())
+        {
+            std::lock_guard<std::mutex> lock(m_requestMutex);
+
+            for (uint32_t const streamId : stops)
+            {
+                m_liveStreamIds.erase(std::remove(m_liveStreamIds.begin(), m_liveStreamIds.end(), streamId), m_liveStreamIds.end());
+            }
+        }
+
+        opens.clear();
+        stops.clear();
+
+        std::unique_lock<std::mutex> lock(m_requestMutex);
+
+        if (m_pendingOpens.empty() && m_pendingStops.empty() && m_isRunning.load())
+        {
+            m_wakeCondition.wait_for(lock, std::chrono::duration<double>(m_config.m_pollSeconds));
+        }
+    }
+
+    // The loop only exits after closing every active stream, so no decoder outlives this.
+    if (isDecoderThreadStarted)
+    {
+        AudioStreamDecoder::ShutdownDecoderThread();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// The ring is primed before the output starts, so playback never begins on an underrun.
+//
+void AudioStreamer::OpenStream(sStreamRequest const& request)
+{
+    double const        openStartSeconds = GetSchedulerTimeSeconds();
+    AudioStreamDecoder* decoder          = AudioStreamDecoder::CreateForFile(request.m_filePath.c_str());
+
+    if (decoder == nullptr)
+    {
+        DebuggerPrintf("AudioStreamer: could not open \"%s\" for streaming\n", request.m_filePath.c_str());
+        m_failedOpenCount.fetch_add(1, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(m_requestMutex);
+        m_liveStreamIds.erase(std::remove(m_liveStreamIds.begin(), m_liveStreamIds.end(), request.m_streamId), m_liveStreamIds.end());
+
+        return;
+    }
+
+    sActiveStream activeStream;
+    activeStream.m_streamId = request.m_streamId;
+    activeStream.m_stream   = new AudioStream(decoder, m_config.m_streamConfig, request.m_isLooped, this);
+    activeStream.m_output   = AudioStreamOutput::Create(m_config.m_outputType);
+
+    if (m_config.m_outputType == eAudioStreamOutputType::NULL_OUTPUT)
+    {
+        static_cast<NullAudioStreamOutput*>(activeStream.m_output)->m_playbackRateScale = m_config.m_nullOutputRateScale;
+    }
+
+    m_decodedFrameCount.fetch_add(static_cast<uint64_t>(activeStream.m_stream->Refill()), std::memory_order_relaxed);
+
+    if (!activeStream.m_output->Start(*activeStream.m_stream, request.m_volume))
+    {
+        DebuggerPrintf("AudioStreamer: no output available for \"%s\"\n", request.m_filePath.c_str());
+        m_failedOpenCount.fetch_add(1, std::memory_order_relaxed);
+        CloseStream(activeStream);
+
+        std::lock_guard<std::mutex> lock(m_requestMutex);
+        m_liveStreamIds.erase(std::remove(m_liveStreamIds.begin(), m_liveStreamIds.end(), request.m_streamId), m_liveStreamIds.end());
+
+        return;
+    }
+
+    UpdateAtomicMax(m_maxStartNanoseconds, static_cast<uint64_t>((GetSchedulerTimeSeconds() - openStartSeconds) * 1e9));
+    m_activeStreams.push_back(activeStream);
+}
+
+//----------------------------------------------------------------------------------------------------
+// The output is stopped first: after Stop returns nothing reads the ring, so the stream can go.
+//
+void AudioStreamer::CloseStream(sActiveStream& activeStream)
+{
+    activeStream.m_output->Stop();
+    m_retiredUnderrunFrameCount.fetch_add(activeStream.m_stream->GetUnderrunFrameCount(), std::memory_order_relaxed);
+
+    GAME_SAFE_RELEASE(activeStream.m_output);
+    GAME_SAFE_RELEASE(activeStream.m_stream);
+
+    std::lock_guard<std::mutex> lock(m_requestMutex);
+    m_liveStreamIds.erase(std::remove(m_liveStreamIds.begin(), m_liveStreamIds.end(), activeStream.m_streamId), m_liveStreamIds.end());
+}
+
+//----------------------------------------------------------------------------------------------------
+// 16-bit stereo 44.1 kHz, the layout an MP3 decodes to; the tone keeps the data from being all zeros.
+//
+static bool WriteToneWaveFile(std::string const& filePath, double const trackSeconds)
+{
+    FILE* file = nullptr;
+#if defined(_WIN32)
+    fopen_s(&file, filePath.c_str(), "wb");
+#else
+    file = fopen(filePath.c_str(), "wb");
+#endif
+
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    uint32_t constexpr SAMPLE_RATE   = 44100;
+    uint16_t constexpr CHANNEL_COUNT = 2;
+    uint32_t const     frameCount    = static_cast<uint32_t>(trackSeconds * SAMPLE_RATE);
+    uint32_t const     dataBytes     = frameCount * CHANNEL_COUNT * sizeof(int16_t);
+
+    auto const writeU32 = [file](uint32_t const value) { uint8_t const bytes[4] = { static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 24) }; fwrite(bytes, 1, 4, file); };
+    auto const writeU16 = [file](uint16_t const value) { uint8_t const bytes[2] = { static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8) }; fwrite(bytes, 1, 2, file); };
+
+    fwrite("RIFF", 1, 4, file);
+    writeU32(36 + dataBytes);
+    fwrite("WAVEfmt ", 1, 8, file);
+    writeU32(16);
+    writeU16(1);
+    writeU16(CHANNEL_COUNT);
+    writeU32(SAMPLE_RATE);
+    writeU32(SAMPLE_RATE * CHANNEL_COUNT * sizeof(int16_t));
+    writeU16(CHANNEL_COUNT * sizeof(int16_t));
+    writeU16(16);
+    fwrite("data", 1, 4, file);
+    writeU32(dataBytes);
+
+    std::vector<int16_t> block;
+
+    for (uint32_t frameIndex = 0; frameIndex < frameCount; frameIndex += SAMPLE_RATE)
+    {
+        uint32_t const blockFrames = std::min(SAMPLE_RATE, frameCount - frameIndex);
+        block.resize(static_cast<size_t>(blockFrames) * CHANNEL_COUNT);
+
+        for (uint32_t blockFrame = 0; blockFrame < blockFrames; ++blockFrame)
+        {
+            float const   phase  = static_cast<float>(frameIndex + blockFrame) * (2.f * 3.14159265f * 440.f / SAMPLE_RATE);
+            int16_t const sample = static_cast<int16_t>(sinf(phase) * 8000.f);
+
+            block[blockFrame * 2]     = sample;
+            block[blockFrame * 2 + 1] = sample;
+        }
+
+        fwrite(block.data(), sizeof(int16_t), block.size(), file);
+    }
+
+    fclose(file);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// A 60 s track played at 8x real time: under eight seconds of wall time per ring size. Playing that
+// fast also squeezes the refill deadline by 8x, so a ring that survives here has margin at 1x.
+//
+void RunAudioStreamBenchmark(std::vector<sAudioStreamBenchmarkResult>& outResults)
+{
+    double constexpr TRACK_SECONDS       = 60.0;
+    double constexpr PLAYBACK_RATE_SCALE = 8.0;
+    int constexpr    RING_FRAME_COUNTS[] = { 8192, 16384, 65536 };
+
+    std::string const filePath = (std::filesystem::temp_directory_path() / "AudioStreamBenchmark.wav").string();
+
+    if (!WriteToneWaveFile(filePath, TRACK_SECONDS))
+    {
+        return;
+    }
+
+    // The up-front decode every non-streamed sound pays today.
+    double   fullDecodeSeconds = 0.0;
+    uint64_t fullDecodeBytes   = 0;
+    {
+        double const        decodeStartSeconds = GetSchedulerTimeSeconds();
+        AudioStreamDecoder* decoder            = AudioStreamDecoder::CreateForFile(filePath.c_str());
+        std::vector<float>  pcm;
+        float               chunk[4096 * 2];
+
+        if (decoder != nullptr)
+        {
+            int const channelCount = decoder->GetFormat().m_channelCount;
+
+            while (int const frameCount = decoder->DecodeFrames(chunk, 4096))
+            {
+                pcm.insert(pcm.end(), chunk, chunk + frameCount * channelCount);
+            }
+
+            GAME_SAFE_RELEASE(decoder);
+        }
+
+        fullDecodeSeconds = GetSchedulerTimeSeconds() - decodeStartSeconds;
+        fullDecodeBytes   = pcm.capacity() * sizeof(float);
+    }
+
+    for (int const ringFrameCount : RING_FRAME_COUNTS)
+    {
+        sAudioStreamerConfig config;
+        config.m_outputType                      = eAudioStreamOutputType::NULL_OUTPUT;
+        config.m_nullOutputRateScale             = PLAYBACK_RATE_SCALE;
+        config.m_streamConfig.m_ringFrameCount   = ringFrameCount;
+        config.m_streamConfig.m_decodeFrameCount = std::min(ringFrameCount / 4, 4096);
+
+        AudioStreamer streamer(config);
+        streamer.Startup();
+
+        double const             playStartSeconds  = GetSchedulerTimeSeconds();
+        sAudioStreamHandle const handle            = streamer.PlayStream(filePath);
+        uint64_t                 peakResidentBytes = 0;
+
+        while (streamer.IsStreamPlaying(handle))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            peakResidentBytes = std::max(peakResidentBytes, streamer.GetStats().m_residentBytes);
+        }
+
+        sAudioStreamBenchmarkResult result;
+        result.m_ringFrameCount    = ringFrameCount;
+        result.m_trackSeconds      = TRACK_SECONDS;
+        result.m_fullDecodeSeconds = fullDecodeSeconds;
+        result.m_fullDecodeBytes   = fullDecodeBytes;
+        result.m_peakResidentBytes = peakResidentBytes;
+        result.m_playbackSeconds   = GetSchedulerTimeSeconds() - playStartSeconds;
+
+        streamer.Shutdown();
+        result.m_stats = streamer.GetStats();
+
+        outResults.push_back(result);
+    }
+
+    std::error_code errorCode;
+    std::filesystem::remove(filePath, errorCode);
+}
@@ -0,0 +1,204 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStream.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Game/Framework/AudioStreamDecoder.hpp"
+#include "Game/Framework/AudioStreamOutput.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class AudioStreamer;
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioStreamConfig
+{
+    int   m_ringFrameCount   = 16384;     // Rounded up to a power of two; ~370 ms at 44.1 kHz
+    int   m_decodeFrameCount = 2048;      // Most frames asked of the decoder per call
+    float m_refillThreshold  = 0.5f;      // Fraction of the ring left unread that triggers a refill
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// One playing track: a decoder plus a fixed ring of decoded float PCM.
+/// The streaming thread is the only producer (Refill) and the output's playback thread the only
+/// consumer (ReadFrames); the two share nothing but the ring's read and write frame counters, so
+/// neither side ever takes a lock. Resident memory is the ring plus the decoder's scratch,
+/// whatever the length of the file.
+class AudioStream
+{
+public:
+    AudioStream(AudioStreamDecoder* decoder, sAudioStreamConfig const& config, bool isLooped, AudioStreamer* streamer);     // Takes ownership of decoder
+    ~AudioStream();
+
+    // Playback thread only. Frames the ring cannot supply are zero-filled; returns frames supplied.
+    int ReadFrames(float* outSamples, int frameCount);
+
+    // Streaming thread only. Decodes until the ring is full or the track ends; returns frames decoded.
+    int  Refill();
+    bool NeedsRefill() const;
+
+    bool                      IsFinished() const;     // Decoder exhausted and the ring played out
+    sAudioStreamFormat const& GetFormat() const;
+    int                       GetResidentBytes() const;
+    uint64_t                  GetUnderrunFrameCount() const;
+
+private:
+    static size_t constexpr CACHE_LINE_SIZE = 64;
+
+    AudioStreamDecoder* m_decoder  = nullptr;
+    AudioStreamer*      m_streamer = nullptr;
+    sAudioStreamFormat  m_format;
+    bool                m_isLooped = false;
+
+    std::vector<float> m_ring;
+    uint32_t           m_ringFrameCount   = 0;
+    uint32_t           m_ringFrameMask    = 0;
+    uint32_t           m_refillFrameCount = 0;     // Refill once fewer than this many frames are unread
+    int                m_decodeFrameCount = 0;
+
+    // Explicit padding rather than alignas, so AudioStream does not become over-aligned (MSVC C4324 at
+    // /W4); each index still gets a cache line to itself, clear of the read-mostly fields above.
+    char                  m_ringPadding[CACHE_LINE_SIZE];
+    std::atomic<uint32_t> m_writeFrame{0};
+    char                  m_writeFramePadding[CACHE_LINE_SIZE - sizeof(std::atomic<uint32_t>)];
+    std::atomic<uint32_t> m_readFrame{0};
+    char                  m_readFramePadding[CACHE_LINE_SIZE - sizeof(std::atomic<uint32_t>)];
+
+    std::atomic<bool>     m_isDecodeFinished{false};
+    std::atomic<bool>     m_isRefillRequested{false};
+    std::atomic<uint64_t> m_underrunFrameCount{0};
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioStreamerConfig
+{
+    eAudioStreamOutputType m_outputType          = eAudioStreamOutputType::XAUDIO2;
+    sAudioStreamConfig     m_streamConfig;
+    double                 m_pollSeconds         = 0.02;     // Longest the streaming thread sleeps without a wake
+    double                 m_nullOutputRateScale = 1.0;      // NULL_OUTPUT only: playback speed multiplier
+};
+
+//----------------------------------------------------------------------------------------------------
+// Issued by the game thread before the stream is opened, so StopStream can follow PlayStream at once.
+//
+struct sAudioStreamHandle
+{
+    bool IsValid() const { return m_streamId != 0; }
+
+    uint32_t m_streamId = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioStreamStats
+{
+    int      m_activeStreamCount  = 0;
+    int      m_failedOpenCount    = 0;
+    uint64_t m_residentBytes      = 0;       // Rings and decoder scratch of every active stream
+    uint64_t m_refillCount        = 0;
+    uint64_t m_decodedFrameCount  = 0;
+    uint64_t m_underrunFrameCount = 0;       // Frames the outputs asked for that were not decoded yet
+    double   m_totalDecodeSeconds = 0.0;
+    double   m_maxRefillSeconds   = 0.0;
+    double   m_maxStartSeconds    = 0.0;     // Open, prime the ring and start the output
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Plays long music and ambience tracks without decoding them up front.
+/// PlayStream only queues a request; the streaming thread opens the decoder, primes the ring and
+/// starts the output, then keeps every ring topped up, waking early whenever an output drains a ring
+/// below its refill threshold. Finished and stopped streams are torn down on the same thread.
+/// Short effects should keep going through AudioService: a decoded sample has no per-play cost.
+class AudioStreamer
+{
+public:
+    explicit AudioStreamer(sAudioStreamerConfig const& config = sAudioStreamerConfig());
+    ~AudioStreamer();
+
+    void Startup();
+    void Shutdown();
+
+    sAudioStreamHandle PlayStream(std::string const& filePath, bool isLooped = false, float volume = 1.f);
+    void               StopStream(sAudioStreamHandle handle);
+    bool               IsStreamPlaying(sAudioStreamHandle handle) const;
+
+    void              WakeStreamingThread();
+    sAudioStreamStats GetStats() const;
+
+private:
+    struct sStreamRequest
+    {
+        uint32_t    m_streamId = 0;
+        std::string m_filePath;
+        bool        m_isLooped = false;
+        float       m_volume   = 1.f;
+    };
+
+    struct sActiveStream
+    {
+        uint32_t           m_streamId = 0;
+        AudioStream*       m_stream   = nullptr;
+        AudioStreamOutput* m_output   = nullptr;
+    };
+
+    void RunStreamingThread();
+    void OpenStream(sStreamRequest const& request);
+    void CloseStream(sActiveStream& activeStream);
+
+    sAudioStreamerConfig    m_config;
+    std::thread             m_streamingThread;
+    std::atomic<bool>       m_isRunning{false};
+    mutable std::mutex      m_requestMutex;
+    std::condition_variable m_wakeCondition;
+
+    // Guarded by m_requestMutex
+    std::vector<sStreamRequest> m_pendingOpens;
+    std::vector<uint32_t>       m_pendingStops;
+    std::vector<uint32_t>       m_liveStreamIds;
+    uint32_t                    m_nextStreamId = 1;
+
+    // Streaming thread only
+    std::vector<sActiveStream> m_activeStreams;
+
+    // Written by the streaming thread, read by GetStats
+    std::atomic<int>      m_failedOpenCount{0};
+    std::atomic<uint64_t> m_residentBytes{0};
+    std::atomic<uint64_t> m_refillCount{0};
+    std::atomic<uint64_t> m_decodedFrameCount{0};
+    std::atomic<uint64_t> m_retiredUnderrunFrameCount{0};
+    std::atomic<uint64_t> m_liveUnderrunFrameCount{0};
+    std::atomic<uint64_t> m_totalDecodeNanoseconds{0};
+    std::atomic<uint64_t> m_maxRefillNanoseconds{0};
+    std::atomic<uint64_t> m_maxStartNanoseconds{0};
+};
+
+//----------------------------------------------------------------------------------------------------
+extern AudioStreamer* g_theAudioStreamer;
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioStreamBenchmarkResult
+{
+    int               m_ringFrameCount    = 0;
+    double            m_trackSeconds      = 0.0;
+    double            m_fullDecodeSeconds = 0.0;     // Decoding the whole track up front, as Sound2D does
+    uint64_t          m_fullDecodeBytes   = 0;
+    uint64_t          m_peakResidentBytes = 0;
+    double            m_playbackSeconds   = 0.0;     // Wall time to play the track on the sped-up null output
+    sAudioStreamStats m_stats;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Writes a long tone WAV to the temp directory, decodes it whole once, then streams it through the
+// null output at several ring sizes.
+//
+void RunAudioStreamBenchmark(std::vector<sAudioStreamBenchmarkResult>& outResults);
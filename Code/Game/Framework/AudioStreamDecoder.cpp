@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamDecoder.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AudioStreamDecoder.hpp"
+
+#include <string>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/AudioStreamDecoder_MediaFoundation.hpp"
+#include "Game/Framework/AudioStreamDecoder_Wave.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+sAudioStreamFormat const& AudioStreamDecoder::GetFormat() const
+{
+    return m_format;
+}
+
+//----------------------------------------------------------------------------------------------------
+int AudioStreamDecoder::GetScratchBytes() const
+{
+    return m_scratchBytes;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only the Media Foundation decoder has per-thread state; the WAV decoder needs none.
+//
+STATIC bool AudioStreamDecoder::StartupDecoderThread()
+{
+#if defined(_WIN32) && !defined(GAME_HEADLESS)
+    return MediaFoundationStreamDecoder::StartupThread();
+#else
+    return true;
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void AudioStreamDecoder::ShutdownDecoderThread()
+{
+#if defined(_WIN32) && !defined(GAME_HEADLESS)
+    MediaFoundationStreamDecoder::ShutdownThread();
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+// WAV is parsed directly on every platform; everything else (MP3 in particular) goes through the
+// OS decoder, which only exists on Windows.
+//
+STATIC AudioStreamDecoder* AudioStreamDecoder::CreateForFile(char const* filePath)
+{
+    std::string const path(filePath);
+    size_t const      dotIndex  = path.find_last_of('.');
+    std::string       extension = dotIndex == std::string::npos ? std::string() : path.substr(dotIndex + 1);
+
+    for (char& character : extension)
+    {
+        if (character >= 'A' && character <= 'Z')
+        {
+            character = static_cast<char>(character - 'A' + 'a');
+        }
+    }
+
+    AudioStreamDecoder* decoder = nullptr;
+
+    if (extension == "wav")
+    {
+        decoder = new WaveStreamDecoder();
+    }
+#if defined(_WIN32) && !defined(GAME_HEADLESS)
+    else
+    {
+        decoder = new MediaFoundationStreamDecoder();
+    }
+#endif
+
+    if (decoder != nullptr && !decoder->Open(filePath))
+    {
+        GAME_SAFE_RELEASE(decoder);
+    }
+
+    return decoder;
+}
@@ -0,0 +1,43 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamDecoder.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioStreamFormat
+{
+    int m_sampleRate   = 0;
+    int m_channelCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Pull decoder for one compressed audio file. Each DecodeFrames call decodes only as much of the
+/// file as it needs for the frames requested, so a decoder's memory does not grow with the length of
+/// the track. Output is always interleaved 32-bit float. Used by the streaming thread only.
+class AudioStreamDecoder
+{
+public:
+    virtual ~AudioStreamDecoder() = default;
+
+    virtual bool Open(char const* filePath) = 0;
+    virtual int  DecodeFrames(float* outSamples, int maxFrameCount) = 0;     // Returns 0 at end of stream
+    virtual bool Rewind() = 0;
+
+    sAudioStreamFormat const& GetFormat() const;
+    int                       GetScratchBytes() const;     // Decoder-side buffering, for the resident memory stats
+
+    // Picks a decoder by file extension; returns nullptr if none can open the file.
+    static AudioStreamDecoder* CreateForFile(char const* filePath);
+
+    // Per-thread setup the platform decoders need; called once by the thread that opens decoders.
+    static bool StartupDecoderThread();
+    static void ShutdownDecoderThread();
+
+protected:
+    sAudioStreamFormat m_format;
+    int                m_scratchBytes = 0;
+};
@@ -0,0 +1,213 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamDecoder_MediaFoundation.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AudioStreamDecoder_MediaFoundation.hpp"
+
+#if defined(_WIN32) && !defined(GAME_HEADLESS)
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "Engine/Core/EngineCommon.hpp"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <objbase.h>
+#include <mfapi.h>
+#include <mfidl.h>
+#include <mfreadwrite.h>
+#pragma comment(lib, "mfplat.lib")
+#pragma comment(lib, "mfreadwrite.lib")
+#pragma comment(lib, "mfuuid.lib")
+
+//----------------------------------------------------------------------------------------------------
+MediaFoundationStreamDecoder::~MediaFoundationStreamDecoder()
+{
+    if (m_reader != nullptr)
+    {
+        m_reader->Release();
+        m_reader = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// The source reader is a COM object, so the thread needs COM before Media Foundation will start.
+// Both are started once for the streaming thread's lifetime rather than once per opened file.
+//
+STATIC bool MediaFoundationStreamDecoder::StartupThread()
+{
+    if (FAILED(CoInitializeEx(nullptr, COINIT_MULTITHREADED)))
+    {
+        return false;
+    }
+
+    if (FAILED(MFStartup(MF_VERSION, MFSTARTUP_LITE)))
+    {
+        CoUninitialize();
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void MediaFoundationStreamDecoder::ShutdownThread()
+{
+    MFShutdown();
+    CoUninitialize();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Needs StartupThread to have run on the calling thread.
+//
+bool MediaFoundationStreamDecoder::Open(char const* filePath)
+{
+    int const    wideLength = MultiByteToWideChar(CP_UTF8, 0, filePath, -1, nullptr, 0);
+    std::wstring widePath(static_cast<size_t>(std::max(wideLength, 1)), L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, filePath, -1, widePath.data(), wideLength);
+
+    if (FAILED(MFCreateSourceReaderFromURL(widePath.c_str(), nullptr, &m_reader)))
+    {
+        return false;
+    }
+
+    DWORD const audioStream = static_cast<DWORD>(MF_SOURCE_READER_FIRST_AUDIO_STREAM);
+
+    m_reader->SetStreamSelection(static_cast<DWORD>(MF_SOURCE_READER_ALL_STREAMS), FALSE);
+    m_reader->SetStreamSelection(audioStream, TRUE);
+
+    IMFMediaType* requestedType = nullptr;
+
+    if (FAILED(MFCreateMediaType(&requestedType)))
+    {
+        return false;
+    }
+
+    requestedType->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Audio);
+    requestedType->SetGUID(MF_MT_SUBTYPE, MFAudioFormat_Float);
+
+    HRESULT const setResult = m_reader->SetCurrentMediaType(audioStream, nullptr, requestedType);
+    requestedType->Release();
+
+    IMFMediaType* decodedType = nullptr;
+
+    if (FAILED(setResult) || FAILED(m_reader->GetCurrentMediaType(audioStream, &decodedType)))
+    {
+        return false;
+    }
+
+    UINT32 channelCount = 0;
+    UINT32 sampleRate   = 0;
+    decodedType->GetUINT32(MF_MT_AUDIO_NUM_CHANNELS, &channelCount);
+    decodedType->GetUINT32(MF_MT_AUDIO_SAMPLES_PER_SECOND, &sampleRate);
+    decodedType->Release();
+
+    m_format.m_channelCount = static_cast<int>(channelCount);
+    m_format.m_sampleRate   = static_cast<int>(sampleRate);
+
+    return channelCount > 0 && sampleRate > 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+int MediaFoundationStreamDecoder::DecodeFrames(float* outSamples, int const maxFrameCount)
+{
+    size_t const channelCount  = static_cast<size_t>(m_format.m_channelCount);
+    size_t const wantedSamples = static_cast<size_t>(maxFrameCount) * channelCount;
+    size_t       writtenCount  = 0;
+
+    while (writtenCount < wantedSamples)
+    {
+        if (m_pendingReadIndex == m_pendingSamples.size() && !ReadNextPacket())
+        {
+            break;
+        }
+
+        size_t const copyCount = std::min(wantedSamples - writtenCount, m_pendingSamples.size() - m_pendingReadIndex);
+        memcpy(outSamples + writtenCount, m_pendingSamples.data() + m_pendingReadIndex, copyCount * sizeof(float));
+
+        writtenCount       += copyCount;
+        m_pendingReadIndex += copyCount;
+    }
+
+    return static_cast<int>(writtenCount / channelCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool MediaFoundationStreamDecoder::Rewind()
+{
+    PROPVARIANT position;
+    PropVariantInit(&position);
+    position.vt            = VT_I8;
+    position.hVal.QuadPart = 0;
+
+    HRESULT const result = m_reader->SetCurrentPosition(GUID_NULL, position);
+    PropVariantClear(&position);
+
+    m_pendingSamples.clear();
+    m_pendingReadIndex = 0;
+    m_isEndOfStream    = false;
+
+    return SUCCEEDED(result);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Packets can come back empty (stream ticks, format changes), so keep reading until PCM or the end.
+//
+bool MediaFoundationStreamDecoder::ReadNextPacket()
+{
+    m_pendingSamples.clear();
+    m_pendingReadIndex = 0;
+
+    while (!m_isEndOfStream)
+    {
+        DWORD      flags  = 0;
+        IMFSample* sample = nullptr;
+
+        if (FAILED(m_reader->ReadSample(static_cast<DWORD>(MF_SOURCE_READER_FIRST_AUDIO_STREAM), 0, nullptr, &flags, nullptr, &sample)))
+        {
+            m_isEndOfStream = true;
+            break;
+        }
+
+        if ((flags & MF_SOURCE_READERF_ENDOFSTREAM) != 0)
+        {
+            m_isEndOfStream = true;
+        }
+
+        if (sample == nullptr)
+        {
+            continue;
+        }
+
+        IMFMediaBuffer* buffer = nullptr;
+
+        if (SUCCEEDED(sample->ConvertToContiguousBuffer(&buffer)))
+        {
+            BYTE* data       = nullptr;
+            DWORD byteLength = 0;
+
+            if (SUCCEEDED(buffer->Lock(&data, nullptr, &byteLength)))
+            {
+                m_pendingSamples.assign(reinterpret_cast<float const*>(data), reinterpret_cast<float const*>(data + byteLength));
+                buffer->Unlock();
+            }
+
+            buffer->Release();
+        }
+
+        sample->Release();
+
+        if (!m_pendingSamples.empty())
+        {
+            m_scratchBytes = static_cast<int>(m_pendingSamples.capacity() * sizeof(float));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#endif // defined(_WIN32) && !defined(GAME_HEADLESS)
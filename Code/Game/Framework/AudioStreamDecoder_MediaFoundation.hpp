@@ -0,0 +1,39 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamDecoder_MediaFoundation.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include "Game/Framework/AudioStreamDecoder.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+struct IMFSourceReader;
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Decodes MP3 (and anything else Windows has a codec for) through a Media Foundation source reader
+/// asked for float PCM. The reader hands back one compressed packet's worth of PCM at a time
+/// (about 1152 frames for MP3); whatever DecodeFrames does not consume is held until the next call.
+class MediaFoundationStreamDecoder : public AudioStreamDecoder
+{
+public:
+    ~MediaFoundationStreamDecoder() override;
+
+    bool Open(char const* filePath) override;
+    int  DecodeFrames(float* outSamples, int maxFrameCount) override;
+    bool Rewind() override;
+
+    static bool StartupThread();      // COM (multithreaded apartment) and Media Foundation for the calling thread
+    static void ShutdownThread();     // Only after StartupThread succeeded, once every decoder is closed
+
+private:
+    bool ReadNextPacket();
+
+    IMFSourceReader*   m_reader           = nullptr;
+    bool               m_isEndOfStream    = false;
+    std::vector<float> m_pendingSamples;
+    size_t             m_pendingReadIndex = 0;
+};
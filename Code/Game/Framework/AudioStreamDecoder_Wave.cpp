@@ -0,0 +1,163 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamDecoder_Wave.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AudioStreamDecoder_Wave.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+uint16_t constexpr WAVE_FORMAT_TAG_PCM   = 1;
+uint16_t constexpr WAVE_FORMAT_TAG_FLOAT = 3;
+
+//----------------------------------------------------------------------------------------------------
+static uint32_t ReadLittleEndian32(uint8_t const* bytes)
+{
+    return static_cast<uint32_t>(bytes[0]) | static_cast<uint32_t>(bytes[1]) << 8 | static_cast<uint32_t>(bytes[2]) << 16 | static_cast<uint32_t>(bytes[3]) << 24;
+}
+
+//----------------------------------------------------------------------------------------------------
+static uint16_t ReadLittleEndian16(uint8_t const* bytes)
+{
+    return static_cast<uint16_t>(bytes[0] | bytes[1] << 8);
+}
+
+//----------------------------------------------------------------------------------------------------
+WaveStreamDecoder::~WaveStreamDecoder()
+{
+    if (m_file != nullptr)
+    {
+        fclose(m_file);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Walks the chunk list for "fmt " and "data"; nothing past the headers is read here.
+//
+bool WaveStreamDecoder::Open(char const* filePath)
+{
+#if defined(_WIN32)
+    fopen_s(&m_file, filePath, "rb");
+#else
+    m_file = fopen(filePath, "rb");
+#endif
+
+    if (m_file == nullptr)
+    {
+        return false;
+    }
+
+    uint8_t riffHeader[12];
+
+    if (fread(riffHeader, 1, sizeof(riffHeader), m_file) != sizeof(riffHeader) || memcmp(riffHeader, "RIFF", 4) != 0 || memcmp(riffHeader + 8, "WAVE", 4) != 0)
+    {
+        return false;
+    }
+
+    bool     isFormatFound = false;
+    uint16_t formatTag     = 0;
+    uint16_t bitsPerSample = 0;
+    uint8_t  chunkHeader[8];
+
+    while (fread(chunkHeader, 1, sizeof(chunkHeader), m_file) == sizeof(chunkHeader))
+    {
+        uint32_t const chunkSize = ReadLittleEndian32(chunkHeader + 4);
+
+        if (memcmp(chunkHeader, "fmt ", 4) == 0)
+        {
+            uint8_t formatChunk[16];
+
+            if (chunkSize < sizeof(formatChunk) || fread(formatChunk, 1, sizeof(formatChunk), m_file) != sizeof(formatChunk))
+            {
+                return false;
+            }
+
+            formatTag                = ReadLittleEndian16(formatChunk);
+            m_format.m_channelCount  = ReadLittleEndian16(formatChunk + 2);
+            m_format.m_sampleRate    = static_cast<int>(ReadLittleEndian32(formatChunk + 4));
+            bitsPerSample            = ReadLittleEndian16(formatChunk + 14);
+            isFormatFound            = true;
+
+            fseek(m_file, static_cast<long>(chunkSize - sizeof(formatChunk) + (chunkSize & 1)), SEEK_CUR);
+        }
+        else if (memcmp(chunkHeader, "data", 4) == 0)
+        {
+            if (!isFormatFound)
+            {
+                return false;
+            }
+
+            m_isFloat        = formatTag == WAVE_FORMAT_TAG_FLOAT && bitsPerSample == 32;
+            m_bytesPerSample = bitsPerSample / 8;
+
+            if (!m_isFloat && (formatTag != WAVE_FORMAT_TAG_PCM || bitsPerSample != 16))
+            {
+                return false;
+            }
+
+            if (m_format.m_channelCount <= 0 || m_format.m_sampleRate <= 0)
+            {
+                return false;
+            }
+
+            m_dataOffset     = ftell(m_file);
+            m_dataFrameCount = chunkSize / static_cast<uint32_t>(m_bytesPerSample * m_format.m_channelCount);
+            m_nextFrame      = 0;
+
+            return true;
+        }
+        else
+        {
+            fseek(m_file, static_cast<long>(chunkSize + (chunkSize & 1)), SEEK_CUR);
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+int WaveStreamDecoder::DecodeFrames(float* outSamples, int const maxFrameCount)
+{
+    int const frameCount = static_cast<int>(std::min<uint32_t>(static_cast<uint32_t>(maxFrameCount), m_dataFrameCount - m_nextFrame));
+
+    if (frameCount <= 0)
+    {
+        return 0;
+    }
+
+    size_t const sampleCount = static_cast<size_t>(frameCount) * m_format.m_channelCount;
+
+    if (m_isFloat)
+    {
+        size_t const readCount = fread(outSamples, sizeof(float), sampleCount, m_file);
+        m_nextFrame += static_cast<uint32_t>(readCount / m_format.m_channelCount);
+
+        return static_cast<int>(readCount / m_format.m_channelCount);
+    }
+
+    m_scratch.resize(sampleCount * sizeof(int16_t));
+    m_scratchBytes = static_cast<int>(m_scratch.capacity());
+
+    size_t const   readCount = fread(m_scratch.data(), sizeof(int16_t), sampleCount, m_file);
+    uint8_t const* source    = m_scratch.data();
+
+    for (size_t sampleIndex = 0; sampleIndex < readCount; ++sampleIndex)
+    {
+        int16_t const sample    = static_cast<int16_t>(ReadLittleEndian16(source + sampleIndex * sizeof(int16_t)));
+        outSamples[sampleIndex] = static_cast<float>(sample) * (1.f / 32768.f);
+    }
+
+    m_nextFrame += static_cast<uint32_t>(readCount / m_format.m_channelCount);
+
+    return static_cast<int>(readCount / m_format.m_channelCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool WaveStreamDecoder::Rewind()
+{
+    m_nextFrame = 0;
+
+    return fseek(m_file, m_dataOffset, SEEK_SET) == 0;
+}
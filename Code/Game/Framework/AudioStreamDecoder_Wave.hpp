@@ -0,0 +1,33 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamDecoder_Wave.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdio>
+#include <vector>
+
+#include "Game/Framework/AudioStreamDecoder.hpp"
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// RIFF/WAVE reader for 16-bit PCM and 32-bit float data. The file stays open and each DecodeFrames
+/// reads just the bytes for the frames asked for, through one scratch buffer of that size.
+class WaveStreamDecoder : public AudioStreamDecoder
+{
+public:
+    ~WaveStreamDecoder() override;
+
+    bool Open(char const* filePath) override;
+    int  DecodeFrames(float* outSamples, int maxFrameCount) override;
+    bool Rewind() override;
+
+private:
+    FILE*                m_file           = nullptr;
+    long                 m_dataOffset     = 0;
+    uint32_t             m_dataFrameCount = 0;
+    uint32_t             m_nextFrame      = 0;
+    int                  m_bytesPerSample = 0;
+    bool                 m_isFloat        = false;
+    std::vector<uint8_t> m_scratch;
+};
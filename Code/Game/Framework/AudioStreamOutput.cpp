@@ -0,0 +1,29 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamOutput.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AudioStreamOutput.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Game/Framework/AudioStreamOutput_Null.hpp"
+#include "Game/Framework/AudioStreamOutput_XAudio2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+STATIC AudioStreamOutput* AudioStreamOutput::Create(eAudioStreamOutputType const type)
+{
+    switch (type)
+    {
+    case eAudioStreamOutputType::XAUDIO2:
+#if defined(_WIN32) && !defined(GAME_HEADLESS)
+        return new XAudio2StreamOutput();
+#else
+        ERROR_AND_DIE("AudioStreamOutput::Create: XAUDIO2 output is not available in this build")
+#endif
+
+    case eAudioStreamOutputType::NULL_OUTPUT: return new NullAudioStreamOutput();
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,33 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamOutput.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class AudioStream;
+
+//----------------------------------------------------------------------------------------------------
+enum class eAudioStreamOutputType : int8_t
+{
+    XAUDIO2,     // A streaming source voice per stream, fed from the XAudio2 callback thread
+    NULL_OUTPUT
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Plays one AudioStream by pulling PCM from its ring as the hardware needs it. The pulling thread
+/// belongs to the output, never to the streaming thread, so a slow decode shows up as an underrun
+/// instead of a glitch in the decode loop. Created, started and stopped on the streaming thread.
+class AudioStreamOutput
+{
+public:
+    virtual ~AudioStreamOutput() = default;
+
+    virtual bool Start(AudioStream& stream, float volume) = 0;
+    virtual void Stop() = 0;     // Once this returns the stream is never read again
+
+    static AudioStreamOutput* Create(eAudioStreamOutputType type);
+};
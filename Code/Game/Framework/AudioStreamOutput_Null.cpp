@@ -0,0 +1,80 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamOutput_Null.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AudioStreamOutput_Null.hpp"
+
+#include <chrono>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/AudioStream.hpp"
+
+//----------------------------------------------------------------------------------------------------
+NullAudioStreamOutput::~NullAudioStreamOutput()
+{
+    Stop();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool NullAudioStreamOutput::Start(AudioStream& stream, float const volume)
+{
+    UNUSED(volume)
+
+    m_stream = &stream;
+    m_isRunning.store(true);
+    m_playbackThread = std::thread(&NullAudioStreamOutput::RunPlaybackThread, this);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void NullAudioStreamOutput::Stop()
+{
+    if (!m_playbackThread.joinable())
+    {
+        return;
+    }
+
+    m_isRunning.store(false);
+    m_playbackThread.join();
+    m_stream = nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t NullAudioStreamOutput::GetConsumedFrameCount() const
+{
+    return m_consumedFrameCount.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Paced against a steady clock rather than by sleep length, so oversleeping pulls a bigger period
+// next time instead of slowly drifting behind the rate a sound card would consume at.
+//
+void NullAudioStreamOutput::RunPlaybackThread()
+{
+    sAudioStreamFormat const& format          = m_stream->GetFormat();
+    double const              framesPerSecond = static_cast<double>(format.m_sampleRate) * m_playbackRateScale;
+    auto const                startTime       = std::chrono::steady_clock::now();
+    uint64_t                  pulledFrames    = 0;
+
+    while (m_isRunning.load(std::memory_order_relaxed))
+    {
+        std::this_thread::sleep_for(std::chrono::duration<double>(m_periodSeconds));
+
+        double const   elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        uint64_t const dueFrames      = static_cast<uint64_t>(elapsedSeconds * framesPerSecond);
+        int const      frameCount     = static_cast<int>(dueFrames - pulledFrames);
+
+        if (frameCount <= 0)
+        {
+            continue;
+        }
+
+        m_periodSamples.resize(static_cast<size_t>(frameCount) * format.m_channelCount);
+        m_stream->ReadFrames(m_periodSamples.data(), frameCount);
+
+        pulledFrames = dueFrames;
+        m_consumedFrameCount.store(pulledFrames, std::memory_order_relaxed);
+    }
+}
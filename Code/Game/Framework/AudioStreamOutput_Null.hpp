@@ -0,0 +1,39 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamOutput_Null.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Game/Framework/AudioStreamOutput.hpp"
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Silent output for headless runs and benchmarks. A thread of its own pulls one period of frames
+/// from the stream every m_periodSeconds, scaled by m_playbackRateScale so a long track can be
+/// consumed faster than real time.
+class NullAudioStreamOutput : public AudioStreamOutput
+{
+public:
+    ~NullAudioStreamOutput() override;
+
+    bool Start(AudioStream& stream, float volume) override;
+    void Stop() override;
+
+    uint64_t GetConsumedFrameCount() const;
+
+    double m_periodSeconds     = 0.01;
+    double m_playbackRateScale = 1.0;
+
+private:
+    void RunPlaybackThread();
+
+    AudioStream*          m_stream = nullptr;
+    std::thread           m_playbackThread;
+    std::atomic<bool>     m_isRunning{false};
+    std::atomic<uint64_t> m_consumedFrameCount{0};
+    std::vector<float>    m_periodSamples;
+};
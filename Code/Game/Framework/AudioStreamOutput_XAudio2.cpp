@@ -0,0 +1,185 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamOutput_XAudio2.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AudioStreamOutput_XAudio2.hpp"
+
+#if defined(_WIN32) && !defined(GAME_HEADLESS)
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/AudioStream.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <xaudio2.h>
+#pragma comment(lib, "xaudio2.lib")
+
+//----------------------------------------------------------------------------------------------------
+// Three ~23 ms buffers at 44.1 kHz: enough queued that the callback thread's scheduling jitter is
+// hidden, small enough that the ring, not the voice, holds nearly all of a stream's audio.
+//
+int constexpr XAUDIO2_STREAM_BUFFER_COUNT       = 3;
+int constexpr XAUDIO2_STREAM_BUFFER_FRAME_COUNT = 1024;
+
+//----------------------------------------------------------------------------------------------------
+// Outputs are only created and destroyed on the streaming thread, so the shared engine needs no lock.
+//
+static IXAudio2*               s_xaudio2        = nullptr;
+static IXAudio2MasteringVoice* s_masteringVoice = nullptr;
+static int                     s_engineRefCount = 0;
+
+//----------------------------------------------------------------------------------------------------
+static bool AcquireXAudio2Engine()
+{
+    if (s_engineRefCount == 0)
+    {
+        if (FAILED(XAudio2Create(&s_xaudio2, 0, XAUDIO2_DEFAULT_PROCESSOR)))
+        {
+            return false;
+        }
+
+        if (FAILED(s_xaudio2->CreateMasteringVoice(&s_masteringVoice)))
+        {
+            s_xaudio2->Release();
+            s_xaudio2 = nullptr;
+
+            return false;
+        }
+    }
+
+    ++s_engineRefCount;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+static void ReleaseXAudio2Engine()
+{
+    if (--s_engineRefCount > 0)
+    {
+        return;
+    }
+
+    s_masteringVoice->DestroyVoice();
+    s_masteringVoice = nullptr;
+    s_xaudio2->Release();
+    s_xaudio2 = nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+class XAudio2StreamCallback final : public IXAudio2VoiceCallback
+{
+public:
+    explicit XAudio2StreamCallback(XAudio2StreamOutput& output)
+        : m_output(output)
+    {
+    }
+
+    void STDMETHODCALLTYPE OnBufferEnd(void* bufferContext) override
+    {
+        m_output.SubmitBuffer(static_cast<int>(reinterpret_cast<intptr_t>(bufferContext)));
+    }
+
+    void STDMETHODCALLTYPE OnVoiceProcessingPassStart(UINT32 bytesRequired) override { UNUSED(bytesRequired) }
+    void STDMETHODCALLTYPE OnVoiceProcessingPassEnd() override {}
+    void STDMETHODCALLTYPE OnStreamEnd() override {}
+    void STDMETHODCALLTYPE OnBufferStart(void* bufferContext) override { UNUSED(bufferContext) }
+    void STDMETHODCALLTYPE OnLoopEnd(void* bufferContext) override { UNUSED(bufferContext) }
+    void STDMETHODCALLTYPE OnVoiceError(void* bufferContext, HRESULT error) override { UNUSED(bufferContext) UNUSED(error) }
+
+private:
+    XAudio2StreamOutput& m_output;
+};
+
+//----------------------------------------------------------------------------------------------------
+XAudio2StreamOutput::~XAudio2StreamOutput()
+{
+    Stop();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool XAudio2StreamOutput::Start(AudioStream& stream, float const volume)
+{
+    if (!AcquireXAudio2Engine())
+    {
+        return false;
+    }
+
+    m_isEngineAcquired = true;
+    m_stream           = &stream;
+    m_callback         = new XAudio2StreamCallback(*this);
+
+    sAudioStreamFormat const& format = stream.GetFormat();
+
+    WAVEFORMATEX waveFormat    = {};
+    waveFormat.wFormatTag      = WAVE_FORMAT_IEEE_FLOAT;
+    waveFormat.nChannels       = static_cast<WORD>(format.m_channelCount);
+    waveFormat.nSamplesPerSec  = static_cast<DWORD>(format.m_sampleRate);
+    waveFormat.wBitsPerSample  = 32;
+    waveFormat.nBlockAlign     = static_cast<WORD>(waveFormat.nChannels * sizeof(float));
+    waveFormat.nAvgBytesPerSec = waveFormat.nSamplesPerSec * waveFormat.nBlockAlign;
+
+    if (FAILED(s_xaudio2->CreateSourceVoice(&m_sourceVoice, &waveFormat, 0, XAUDIO2_DEFAULT_FREQ_RATIO, m_callback)))
+    {
+        Stop();
+        return false;
+    }
+
+    m_bufferSamples.resize(static_cast<size_t>(XAUDIO2_STREAM_BUFFER_COUNT) * XAUDIO2_STREAM_BUFFER_FRAME_COUNT * format.m_channelCount);
+
+    for (int bufferIndex = 0; bufferIndex < XAUDIO2_STREAM_BUFFER_COUNT; ++bufferIndex)
+    {
+        SubmitBuffer(bufferIndex);
+    }
+
+    m_sourceVoice->SetVolume(volume);
+    m_sourceVoice->Start(0);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// DestroyVoice waits for any callback in flight, so the stream is safe to free once this returns.
+//
+void XAudio2StreamOutput::Stop()
+{
+    if (m_sourceVoice != nullptr)
+    {
+        m_sourceVoice->Stop(0);
+        m_sourceVoice->DestroyVoice();
+        m_sourceVoice = nullptr;
+    }
+
+    GAME_SAFE_RELEASE(m_callback);
+
+    if (m_isEngineAcquired)
+    {
+        ReleaseXAudio2Engine();
+        m_isEngineAcquired = false;
+    }
+
+    m_stream = nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Runs on the XAudio2 callback thread (and once per buffer from Start). A short read from the ring
+// is already zero-filled by ReadFrames, so the voice never starves; it just plays silence.
+//
+void XAudio2StreamOutput::SubmitBuffer(int const bufferIndex)
+{
+    int const    channelCount = m_stream->GetFormat().m_channelCount;
+    float* const samples      = m_bufferSamples.data() + static_cast<size_t>(bufferIndex) * XAUDIO2_STREAM_BUFFER_FRAME_COUNT * channelCount;
+
+    m_stream->ReadFrames(samples, XAUDIO2_STREAM_BUFFER_FRAME_COUNT);
+
+    XAUDIO2_BUFFER buffer = {};
+    buffer.AudioBytes     = static_cast<UINT32>(XAUDIO2_STREAM_BUFFER_FRAME_COUNT * channelCount * sizeof(float));
+    buffer.pAudioData     = reinterpret_cast<BYTE const*>(samples);
+    buffer.pContext       = reinterpret_cast<void*>(static_cast<intptr_t>(bufferIndex));
+
+    m_sourceVoice->SubmitSourceBuffer(&buffer);
+}
+
+#endif // defined(_WIN32) && !defined(GAME_HEADLESS)
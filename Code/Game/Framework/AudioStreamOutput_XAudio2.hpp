@@ -0,0 +1,38 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStreamOutput_XAudio2.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <vector>
+
+#include "Game/Framework/AudioStreamOutput.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+struct IXAudio2SourceVoice;
+class XAudio2StreamCallback;
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Streaming XAudio2 source voice. A few small float buffers are kept queued on the voice; each time
+/// XAudio2 finishes one, its callback thread refills it from the stream's ring and queues it again.
+/// All outputs share one XAudio2 engine and mastering voice.
+class XAudio2StreamOutput : public AudioStreamOutput
+{
+    friend class XAudio2StreamCallback;
+
+public:
+    ~XAudio2StreamOutput() override;
+
+    bool Start(AudioStream& stream, float volume) override;
+    void Stop() override;
+
+private:
+    void SubmitBuffer(int bufferIndex);
+
+    AudioStream*           m_stream           = nullptr;
+    IXAudio2SourceVoice*   m_sourceVoice      = nullptr;
+    XAudio2StreamCallback* m_callback         = nullptr;
+    bool                   m_isEngineAcquired = false;
+    std::vector<float>     m_bufferSamples;
+};
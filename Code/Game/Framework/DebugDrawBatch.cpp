@@ -0,0 +1,190 @@
+//----------------------------------------------------------------------------------------------------
+// DebugDrawBatch.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/DebugDrawBatch.hpp"
+
+#include <algorithm>
+
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/RenderDevice.hpp"
+
+//----------------------------------------------------------------------------------------------------
+DebugDrawBatch* g_theDebugDrawBatch = nullptr;     // Created and owned by the App
+
+//----------------------------------------------------------------------------------------------------
+// Returns the index of pointer in ids, appending it on first sight. Debug draws use a handful of
+// textures and shaders, so a linear scan beats hashing here.
+//
+static uint64_t GetOrAddPointerId(std::vector<void const*>& ids, void const* pointer)
+{
+    auto const found = std::find(ids.begin(), ids.end(), pointer);
+
+    if (found != ids.end())
+    {
+        return static_cast<uint64_t>(found - ids.begin());
+    }
+
+    ids.push_back(pointer);
+
+    return static_cast<uint64_t>(ids.size() - 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebugDrawBatch::BeginFrame()
+{
+    m_verts.clear();
+    m_submissions.clear();
+    m_isSorted = true;
+
+    m_lastFrameStats = m_frameStats;
+    m_frameStats     = sDebugDrawBatchStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebugDrawBatch::AddVerts(PipelineState const& state, Vertex_PCU const* verts, int const vertCount)
+{
+    Vertex_PCU* const destination = AllocateVerts(state, vertCount);
+
+    if (destination != nullptr)
+    {
+        std::copy(verts, verts + vertCount, destination);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Consecutive submissions with the same state extend the previous run instead of adding a new one,
+// so the common case (thousands of lines in one state) sorts a single element. Bulk tessellation
+// writes straight into the returned span instead of building its vertices elsewhere and copying.
+//
+Vertex_PCU* DebugDrawBatch::AllocateVerts(PipelineState const& state, int const vertCount)
+{
+    if (vertCount <= 0)
+    {
+        return nullptr;
+    }
+
+    uint64_t const stateKey  = MakeStateKey(state.GetDesc());
+    int const      firstVert = static_cast<int>(m_verts.size());
+
+    m_verts.resize(m_verts.size() + static_cast<size_t>(vertCount));
+    m_isSorted = false;
+
+    ++m_frameStats.m_submissionCount;
+    m_frameStats.m_vertexCount += static_cast<uint32_t>(vertCount);
+
+    if (!m_submissions.empty() && m_submissions.back().m_stateKey == stateKey)
+    {
+        m_submissions.back().m_vertCount += vertCount;
+        return &m_verts[static_cast<size_t>(firstVert)];
+    }
+
+    sSubmission submission;
+    submission.m_stateKey  = stateKey;
+    submission.m_firstVert = firstVert;
+    submission.m_vertCount = vertCount;
+    submission.m_state     = state;
+
+    m_submissions.push_back(submission);
+
+    return &m_verts[static_cast<size_t>(firstVert)];
+}
+
+//----------------------------------------------------------------------------------------------------
+// Draws everything submitted so far this frame into the current camera. May be called once per view;
+// the sorted vertex stream is only rebuilt when something was added since the last call.
+//
+void DebugDrawBatch::Render()
+{
+    if (m_submissions.empty())
+    {
+        return;
+    }
+
+    if (!m_isSorted)
+    {
+        SortSubmissions();
+    }
+
+    g_thePipelineStateCache->SetModelConstants();
+
+    int const submissionCount = static_cast<int>(m_sortedSubmissionIndices.size());
+    int       runFirstVert    = 0;
+    int       sortedIndex     = 0;
+
+    while (sortedIndex < submissionCount)
+    {
+        sSubmission const& runHead      = m_submissions[m_sortedSubmissionIndices[sortedIndex]];
+        int                runVertCount = 0;
+
+        while (sortedIndex < submissionCount && m_submissions[m_sortedSubmissionIndices[sortedIndex]].m_stateKey == runHead.m_stateKey)
+        {
+            runVertCount += m_submissions[m_sortedSubmissionIndices[sortedIndex]].m_vertCount;
+            ++sortedIndex;
+        }
+
+        g_thePipelineStateCache->Bind(runHead.m_state);
+        g_theRenderDevice->DrawVertexArray(runVertCount, &m_sortedVerts[runFirstVert]);
+        ++m_frameStats.m_drawCallCount;
+
+        runFirstVert += runVertCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+sDebugDrawBatchStats const& DebugDrawBatch::GetLastFrameStats() const
+{
+    return m_lastFrameStats;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Most significant first: texture (16 bits), blend (8), shader (16), rasterizer (8), sampler (8),
+// depth (8). Texture changes are the costliest to batch around, so they split runs last.
+//
+uint64_t DebugDrawBatch::MakeStateKey(sPipelineStateDesc const& desc)
+{
+    uint64_t const textureId  = GetOrAddPointerId(m_textureIds, desc.m_texture) & 0xFFFF;
+    uint64_t const shaderId   = GetOrAddPointerId(m_shaderIds, desc.m_shader) & 0xFFFF;
+    uint64_t const blend      = static_cast<uint8_t>(desc.m_blendMode);
+    uint64_t const rasterizer = static_cast<uint8_t>(desc.m_rasterizerMode);
+    uint64_t const sampler    = static_cast<uint8_t>(desc.m_samplerMode);
+    uint64_t const depth      = static_cast<uint8_t>(desc.m_depthMode);
+
+    return textureId << 48 | blend << 40 | shaderId << 24 | rasterizer << 16 | sampler << 8 | depth;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Sorts submission indices by key (stable, so same-state draws keep their order), then gathers the
+// vertices into one stream in that order so each run is contiguous.
+//
+void DebugDrawBatch::SortSubmissions()
+{
+    int const submissionCount = static_cast<int>(m_submissions.size());
+
+    m_sortedSubmissionIndices.resize(static_cast<size_t>(submissionCount));
+
+    for (int submissionIndex = 0; submissionIndex < submissionCount; ++submissionIndex)
+    {
+        m_sortedSubmissionIndices[submissionIndex] = submissionIndex;
+    }
+
+    std::stable_sort(m_sortedSubmissionIndices.begin(), m_sortedSubmissionIndices.end(), [this](int const a, int const b)
+    {
+        return m_submissions[a].m_stateKey < m_submissions[b].m_stateKey;
+    });
+
+    m_sortedVerts.clear();
+    m_sortedVerts.reserve(m_verts.size());
+
+    for (int const submissionIndex : m_sortedSubmissionIndices)
+    {
+        sSubmission const& submission = m_submissions[submissionIndex];
+        auto const         first      = m_verts.begin() + submission.m_firstVert;
+
+        m_sortedVerts.insert(m_sortedVerts.end(), first, first + submission.m_vertCount);
+    }
+
+    m_isSorted = true;
+}
@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------------------------------
+// DebugDrawBatch.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Game/Framework/PipelineState.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sDebugDrawBatchStats
+{
+    uint32_t m_submissionCount = 0;     // AddVerts calls, i.e. DebugDraw* primitives
+    uint32_t m_vertexCount     = 0;
+    uint32_t m_drawCallCount   = 0;     // DrawVertexArray calls issued across every Render
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Frame-scoped 2D vertex batcher behind the DebugDraw* helpers.
+/// Submissions are tagged with a packed state key (texture, blend mode, shader, then the remaining
+/// modes) and, at Render, stably sorted by it so each run of identical state becomes one Bind and one
+/// DrawVertexArray. Order is only preserved between submissions that share a state.
+/// The batch is cleared at BeginFrame, so every view that calls Render in a frame draws the same set.
+class DebugDrawBatch
+{
+public:
+    void        BeginFrame();
+    void        AddVerts(PipelineState const& state, Vertex_PCU const* verts, int vertCount);
+    Vertex_PCU* AllocateVerts(PipelineState const& state, int vertCount);     // Caller writes all vertCount vertices
+    void        Render();
+
+    sDebugDrawBatchStats const& GetLastFrameStats() const;
+
+private:
+    struct sSubmission
+    {
+        uint64_t      m_stateKey  = 0;
+        int           m_firstVert = 0;
+        int           m_vertCount = 0;
+        PipelineState m_state;
+    };
+
+    uint64_t MakeStateKey(sPipelineStateDesc const& desc);
+    void     SortSubmissions();
+
+    std::vector<Vertex_PCU>  m_verts;
+    std::vector<sSubmission> m_submissions;
+    std::vector<int>         m_sortedSubmissionIndices;
+    std::vector<Vertex_PCU>  m_sortedVerts;
+    bool                     m_isSorted = true;
+
+    // Small dense ids for the pointers that go into the key; index 0 is reserved for nullptr.
+    std::vector<void const*> m_textureIds = { nullptr };
+    std::vector<void const*> m_shaderIds  = { nullptr };
+
+    sDebugDrawBatchStats m_frameStats;
+    sDebugDrawBatchStats m_lastFrameStats;
+};
+
+//----------------------------------------------------------------------------------------------------
+extern DebugDrawBatch* g_theDebugDrawBatch;
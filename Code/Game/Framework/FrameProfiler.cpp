@@ -0,0 +1,229 @@
+//----------------------------------------------------------------------------------------------------
+// FrameProfiler.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FrameProfiler.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+//----------------------------------------------------------------------------------------------------
+STATIC std::atomic<bool> FrameProfiler::s_isCapturing = false;
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    uint32_t constexpr RING_BUFFER_CAPACITY = 1u << 16;     // Must be a power of two
+
+    //------------------------------------------------------------------------------------------------
+    // Written only by its owning thread; read by WriteChromeTrace. m_writeCount is published with
+    // release ordering after each record is complete, so a reader never sees a half-written record
+    // unless the writer has lapped the whole ring during the dump.
+    // m_captureEpoch is the capture the records belong to. The owner resets its own ring when it sees
+    // a newer capture, so no other thread ever writes m_writeCount.
+    //
+    struct sProfileThreadBuffer
+    {
+        uint32_t              m_threadId     = 0;
+        std::atomic<uint32_t> m_captureEpoch = 0;
+        std::atomic<uint64_t> m_writeCount   = 0;
+        sProfileZoneRecord    m_records[RING_BUFFER_CAPACITY];
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Buffers are registered once per thread and never freed while the program runs, so zones from
+    // threads that have already exited can still be dumped.
+    //
+    struct sProfileThreadRegistry
+    {
+        ~sProfileThreadRegistry()
+        {
+            for (sProfileThreadBuffer* buffer : m_buffers)
+            {
+                delete buffer;
+            }
+        }
+
+        std::mutex                         m_mutex;
+        std::vector<sProfileThreadBuffer*> m_buffers;
+        int64_t                            m_captureStartNanoseconds = 0;
+        std::atomic<uint32_t>              m_captureEpoch            = 0;     // Bumped by every StartCapture
+    };
+
+    sProfileThreadRegistry& GetRegistry()
+    {
+        static sProfileThreadRegistry s_registry;
+        return s_registry;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    sProfileThreadBuffer* GetThreadBuffer()
+    {
+        thread_local sProfileThreadBuffer* t_buffer = nullptr;
+
+        if (t_buffer == nullptr)
+        {
+            sProfileThreadRegistry&     registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+            t_buffer             = new sProfileThreadBuffer();
+            t_buffer->m_threadId = static_cast<uint32_t>(registry.m_buffers.size());
+            registry.m_buffers.push_back(t_buffer);
+        }
+
+        return t_buffer;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void WriteEscapedJsonString(FILE* file, char const* text)
+    {
+        fputc('"', file);
+
+        for (char const* c = text; *c != '\0'; ++c)
+        {
+            if (*c == '"' || *c == '\\')
+            {
+                fputc('\\', file);
+            }
+
+            fputc(*c, file);
+        }
+
+        fputc('"', file);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void FrameProfiler::StartCapture()
+{
+    sProfileThreadRegistry& registry = GetRegistry();
+
+    {
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+        registry.m_captureStartNanoseconds = GetTimeNanoseconds();
+        registry.m_captureEpoch.fetch_add(1, std::memory_order_release);
+    }
+
+    s_isCapturing.store(true, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void FrameProfiler::StopCapture()
+{
+    s_isCapturing.store(false, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool FrameProfiler::IsCapturing()
+{
+    return s_isCapturing.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void FrameProfiler::RecordZone(char const* name, int64_t const startNanoseconds, int64_t const endNanoseconds, int32_t const index)
+{
+    sProfileThreadBuffer* buffer       = GetThreadBuffer();
+    uint32_t const        captureEpoch = GetRegistry().m_captureEpoch.load(std::memory_order_acquire);
+
+    // First zone of a new capture on this thread: drop the previous capture's records. The epoch is
+    // published after the reset, so a reader that sees it never sees the old write count.
+    if (buffer->m_captureEpoch.load(std::memory_order_relaxed) != captureEpoch)
+    {
+        buffer->m_writeCount.store(0, std::memory_order_relaxed);
+        buffer->m_captureEpoch.store(captureEpoch, std::memory_order_release);
+    }
+
+    uint64_t const      writeCount = buffer->m_writeCount.load(std::memory_order_relaxed);
+    sProfileZoneRecord& record     = buffer->m_records[writeCount & (RING_BUFFER_CAPACITY - 1)];
+
+    record.m_name             = name;
+    record.m_startNanoseconds = startNanoseconds;
+    record.m_endNanoseconds   = endNanoseconds;
+    record.m_index            = index;
+
+    buffer->m_writeCount.store(writeCount + 1, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC int64_t FrameProfiler::GetTimeNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Writes every zone still held in the ring buffers as Chrome trace-event JSON ("X" complete events),
+// loadable in chrome://tracing or Perfetto. Stop the capture first for an exact snapshot.
+//
+STATIC bool FrameProfiler::WriteChromeTrace(std::string const& filePath)
+{
+    FILE* file = nullptr;
+#if defined(_WIN32)
+    fopen_s(&file, filePath.c_str(), "wb");
+#else
+    file = fopen(filePath.c_str(), "wb");
+#endif
+
+    if (file == nullptr)
+    {
+        DebuggerPrintf("FrameProfiler: could not open \"%s\" for writing\n", filePath.c_str());
+        return false;
+    }
+
+    sProfileThreadRegistry&     registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    fputs("{\"traceEvents\":[\n", file);
+
+    bool           isFirstEvent = true;
+    uint64_t       eventCount   = 0;
+    uint32_t const captureEpoch = registry.m_captureEpoch.load(std::memory_order_acquire);
+
+    for (sProfileThreadBuffer const* buffer : registry.m_buffers)
+    {
+        // A thread that has recorded nothing since the last StartCapture still holds an older capture.
+        if (buffer->m_captureEpoch.load(std::memory_order_acquire) != captureEpoch)
+        {
+            continue;
+        }
+
+        uint64_t const writeCount = buffer->m_writeCount.load(std::memory_order_acquire);
+        uint64_t const firstIndex = writeCount > RING_BUFFER_CAPACITY ? writeCount - RING_BUFFER_CAPACITY : 0;
+
+        for (uint64_t recordIndex = firstIndex; recordIndex < writeCount; ++recordIndex)
+        {
+            sProfileZoneRecord const& record = buffer->m_records[recordIndex & (RING_BUFFER_CAPACITY - 1)];
+
+            double const startMicroseconds    = static_cast<double>(record.m_startNanoseconds - registry.m_captureStartNanoseconds) * 0.001;
+            double const durationMicroseconds = static_cast<double>(record.m_endNanoseconds - record.m_startNanoseconds) * 0.001;
+
+            fputs(isFirstEvent ? "{\"name\":" : ",\n{\"name\":", file);
+            WriteEscapedJsonString(file, record.m_name);
+            fprintf(file, ",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f",
+                    buffer->m_threadId, startMicroseconds, durationMicroseconds);
+
+            if (record.m_index >= 0)
+            {
+                fprintf(file, ",\"args\":{\"index\":%d}", record.m_index);
+            }
+
+            fputc('}', file);
+
+            isFirstEvent = false;
+            ++eventCount;
+        }
+    }
+
+    fputs("\n],\"displayTimeUnit\":\"ms\"}\n", file);
+    fclose(file);
+
+    DebuggerPrintf("FrameProfiler: wrote %llu zones to \"%s\"\n", static_cast<unsigned long long>(eventCount), filePath.c_str());
+
+    return true;
+}
@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------------------------------
+// FrameProfiler.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+//----------------------------------------------------------------------------------------------------
+// Scoped profiling zones for the frame loop.
+//
+// Each thread records into its own fixed-size ring buffer (single producer, no locks on the hot path).
+// While no capture is running a zone costs one relaxed atomic load, so the zones stay compiled into
+// shipping builds. Define GAME_DISABLE_PROFILER to compile them out entirely.
+//
+// Zone names must be string literals (or otherwise outlive the capture); only the pointer is stored.
+//
+#if !defined(GAME_DISABLE_PROFILER)
+#define PROFILE_CONCAT_INNER(a, b)              a##b
+#define PROFILE_CONCAT(a, b)                    PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name)                     sProfileScope const PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define PROFILE_SCOPE_INDEXED(name, index)      sProfileScope const PROFILE_CONCAT(profileScope_, __LINE__)(name, index)
+#define PROFILE_CALL(name, expression)          do { PROFILE_SCOPE(name); expression; } while (false)
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_SCOPE_INDEXED(name, index)
+#define PROFILE_CALL(name, expression)          do { expression; } while (false)
+#endif
+
+//----------------------------------------------------------------------------------------------------
+struct sProfileZoneRecord
+{
+    char const* m_name             = nullptr;
+    int64_t     m_startNanoseconds = 0;
+    int64_t     m_endNanoseconds   = 0;
+    int32_t     m_index            = -1;
+};
+
+//----------------------------------------------------------------------------------------------------
+class FrameProfiler
+{
+public:
+    static void StartCapture();
+    static void StopCapture();
+    static bool IsCapturing();
+
+    static bool WriteChromeTrace(std::string const& filePath);
+    static void RecordZone(char const* name, int64_t startNanoseconds, int64_t endNanoseconds, int32_t index);
+    static int64_t GetTimeNanoseconds();
+
+    static std::atomic<bool> s_isCapturing;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sProfileScope
+{
+    explicit sProfileScope(char const* name, int32_t const index = -1)
+    {
+        if (FrameProfiler::s_isCapturing.load(std::memory_order_relaxed))
+        {
+            m_name             = name;
+            m_index            = index;
+            m_startNanoseconds = FrameProfiler::GetTimeNanoseconds();
+        }
+    }
+
+    ~sProfileScope()
+    {
+        if (m_name != nullptr)
+        {
+            FrameProfiler::RecordZone(m_name, m_startNanoseconds, FrameProfiler::GetTimeNanoseconds(), m_index);
+        }
+    }
+
+    sProfileScope(sProfileScope const& copyFrom)            = delete;
+    sProfileScope& operator=(sProfileScope const& copyFrom) = delete;
+
+    char const* m_name             = nullptr;
+    int64_t     m_startNanoseconds = 0;
+    int32_t     m_index            = -1;
+};
@@ -0,0 +1,228 @@
+//----------------------------------------------------------------------------------------------------
+// FrameScheduler.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FrameScheduler.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FRAME_SCHEDULER_CPU_RELAX() _mm_pause()
+#else
+#define FRAME_SCHEDULER_CPU_RELAX() std::this_thread::yield()
+#endif
+
+//----------------------------------------------------------------------------------------------------
+double GetSchedulerTimeSeconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+FrameScheduler::FrameScheduler(sFrameSchedulerConfig const& config)
+    : m_config(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void FrameScheduler::Startup()
+{
+#if defined(_WIN32)
+    // High-resolution waitable timers (Windows 10 1803+) wake within ~0.5ms without raising the
+    // system-wide timer resolution with timeBeginPeriod.
+    m_waitableTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
+    // Sleep() wakes on the system clock tick, so the fallback may overshoot by up to one tick.
+    DWORD timeAdjustment       = 0;
+    DWORD timeIncrement        = 0;
+    BOOL  isAdjustmentDisabled = FALSE;
+    GetSystemTimeAdjustment(&timeAdjustment, &timeIncrement, &isAdjustmentDisabled);
+    m_sleepResolutionSeconds = timeIncrement > 0 ? static_cast<double>(timeIncrement) * 1e-7 : 0.0156;     // 100ns units
+
+    if (m_waitableTimer == nullptr)
+    {
+        DebuggerPrintf("FrameScheduler: high-resolution waitable timer unavailable, falling back to Sleep() (%.2f ms tick)\n", m_sleepResolutionSeconds * 1000.0);
+    }
+#else
+    m_sleepResolutionSeconds = 0.0001;     // sleep_for overshoots by about the kernel's timer slack
+#endif
+
+    m_nextDeadlineSeconds = 0.0;
+    m_stats               = sFrameSchedulerStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+void FrameScheduler::Shutdown()
+{
+#if defined(_WIN32)
+    if (m_waitableTimer != nullptr)
+    {
+        CloseHandle(m_waitableTimer);
+        m_waitableTimer = nullptr;
+    }
+#endif
+
+    if (m_stats.m_frameCount > 0)
+    {
+        DebuggerPrintf("FrameScheduler: %llu frames, %llu missed deadlines (worst %.3f ms late)\n",
+                       static_cast<unsigned long long>(m_stats.m_frameCount),
+                       static_cast<unsigned long long>(m_stats.m_missedDeadlineCount),
+                       m_stats.m_worstLatenessSeconds * 1000.0);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Called once at the end of every frame; returns when the next frame should begin.
+//
+void FrameScheduler::WaitForNextFrame()
+{
+    ++m_stats.m_frameCount;
+
+    if (m_config.m_targetFramesPerSecond <= 0.f)
+    {
+        return;
+    }
+
+    double const periodSeconds = 1.0 / static_cast<double>(m_config.m_targetFramesPerSecond);
+    double const nowSeconds    = GetSchedulerTimeSeconds();
+
+    if (m_nextDeadlineSeconds == 0.0)
+    {
+        m_nextDeadlineSeconds = nowSeconds + periodSeconds;
+    }
+
+    double const latenessSeconds = nowSeconds - m_nextDeadlineSeconds;
+
+    if (latenessSeconds > static_cast<double>(m_config.m_missedDeadlineSlack))
+    {
+        ++m_stats.m_missedDeadlineCount;
+
+        if (latenessSeconds > m_stats.m_worstLatenessSeconds)
+        {
+            m_stats.m_worstLatenessSeconds = latenessSeconds;
+        }
+
+        // Re-base the schedule instead of racing to catch up on the frames we lost.
+        m_nextDeadlineSeconds = nowSeconds + periodSeconds;
+        return;
+    }
+
+    double const deadlineSeconds = m_nextDeadlineSeconds;
+    m_nextDeadlineSeconds += periodSeconds;
+
+    double const sleepUntilSeconds = deadlineSeconds - static_cast<double>(m_config.m_spinThresholdSeconds);
+
+    if (sleepUntilSeconds > nowSeconds)
+    {
+        m_stats.m_totalSleepSeconds += SleepUntil(sleepUntilSeconds);
+    }
+
+    double const spinStartSeconds = GetSchedulerTimeSeconds();
+
+    while (GetSchedulerTimeSeconds() < deadlineSeconds)
+    {
+        FRAME_SCHEDULER_CPU_RELAX();
+    }
+
+    m_stats.m_totalSpinSeconds += GetSchedulerTimeSeconds() - spinStartSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+void FrameScheduler::SetTargetFramesPerSecond(float const targetFramesPerSecond)
+{
+    m_config.m_targetFramesPerSecond = targetFramesPerSecond;
+    m_nextDeadlineSeconds            = 0.0;
+}
+
+//----------------------------------------------------------------------------------------------------
+sFrameSchedulerConfig const& FrameScheduler::GetConfig() const
+{
+    return m_config;
+}
+
+//----------------------------------------------------------------------------------------------------
+sFrameSchedulerStats const& FrameScheduler::GetStats() const
+{
+    return m_stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The high-resolution timer wakes well within the spin threshold. The coarse fallbacks can wake a
+// whole tick late, so they stop one tick early and leave the rest to the spin.
+//
+double FrameScheduler::SleepUntil(double const deadlineSeconds)
+{
+    double const startSeconds = GetSchedulerTimeSeconds();
+    double const sleepSeconds = deadlineSeconds - startSeconds;
+
+    if (sleepSeconds <= 0.0)
+    {
+        return 0.0;
+    }
+
+#if defined(_WIN32)
+    if (m_waitableTimer != nullptr)
+    {
+        LARGE_INTEGER dueTime;
+        dueTime.QuadPart = -static_cast<LONGLONG>(sleepSeconds * 10000000.0);     // Relative, in 100ns units
+
+        if (SetWaitableTimer(m_waitableTimer, &dueTime, 0, nullptr, nullptr, FALSE))
+        {
+            WaitForSingleObject(m_waitableTimer, INFINITE);
+            return GetSchedulerTimeSeconds() - startSeconds;
+        }
+    }
+
+    double const coarseSleepSeconds = sleepSeconds - m_sleepResolutionSeconds;
+
+    if (coarseSleepSeconds < 0.001)     // Sleep() takes whole milliseconds
+    {
+        return 0.0;
+    }
+
+    Sleep(static_cast<DWORD>(coarseSleepSeconds * 1000.0));
+#else
+    double const coarseSleepSeconds = sleepSeconds - m_sleepResolutionSeconds;
+
+    if (coarseSleepSeconds <= 0.0)
+    {
+        return 0.0;
+    }
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(coarseSleepSeconds));
+#endif
+
+    return GetSchedulerTimeSeconds() - startSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+int sFixedTimestepAccumulator::ConsumeSteps(double const deltaSeconds)
+{
+    m_accumulatedSeconds += deltaSeconds;
+
+    int stepCount = 0;
+
+    while (m_accumulatedSeconds >= m_stepSeconds && stepCount < m_maxStepsPerFrame)
+    {
+        m_accumulatedSeconds -= m_stepSeconds;
+        ++stepCount;
+    }
+
+    // Drop whatever we could not simulate this frame rather than carrying an ever-growing debt.
+    if (stepCount == m_maxStepsPerFrame && m_accumulatedSeconds >= m_stepSeconds)
+    {
+        m_accumulatedSeconds = 0.0;
+    }
+
+    return stepCount;
+}
@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------------------------------
+// FrameScheduler.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+struct sFrameSchedulerConfig
+{
+    float m_targetFramesPerSecond = 60.f;       // <= 0 disables pacing (run as fast as possible)
+    float m_spinThresholdSeconds  = 0.002f;     // Sleep until this long before the deadline, then spin
+    float m_missedDeadlineSlack   = 0.0005f;    // Lateness tolerated before a frame counts as missed
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sFrameSchedulerStats
+{
+    uint64_t m_frameCount           = 0;
+    uint64_t m_missedDeadlineCount  = 0;
+    double   m_worstLatenessSeconds = 0.0;
+    double   m_totalSleepSeconds    = 0.0;     // Time actually spent asleep, measured around each sleep
+    double   m_totalSpinSeconds     = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Paces the main loop to a fixed render rate.
+/// Each frame has an absolute deadline one period after the previous one. The thread sleeps with the
+/// OS's high-resolution timer until shortly before the deadline and then spins the rest of the way.
+/// A frame that finishes after its deadline is counted as missed, and the schedule is re-based on
+/// "now" so a single hitch does not cause a burst of catch-up frames.
+class FrameScheduler
+{
+public:
+    FrameScheduler() = default;
+    explicit FrameScheduler(sFrameSchedulerConfig const& config);
+
+    void Startup();
+    void Shutdown();
+    void WaitForNextFrame();
+
+    void                         SetTargetFramesPerSecond(float targetFramesPerSecond);
+    sFrameSchedulerConfig const& GetConfig() const;
+    sFrameSchedulerStats const&  GetStats() const;
+
+private:
+    double SleepUntil(double deadlineSeconds);     // Returns the seconds actually slept
+
+    sFrameSchedulerConfig m_config;
+    sFrameSchedulerStats  m_stats;
+    double                m_nextDeadlineSeconds    = 0.0;
+    double                m_sleepResolutionSeconds = 0.0;          // How late a coarse sleep may wake
+    void*                 m_waitableTimer          = nullptr;
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Splits variable frame time into a whole number of fixed simulation steps.
+/// Leftover time carries over to the next frame; at most m_maxStepsPerFrame run per frame so a long
+/// stall cannot trigger a spiral of ever-longer catch-up frames.
+struct sFixedTimestepAccumulator
+{
+    int ConsumeSteps(double deltaSeconds);
+
+    double m_stepSeconds        = 1.0 / 60.0;
+    double m_accumulatedSeconds = 0.0;
+    int    m_maxStepsPerFrame   = 5;
+};
+
+//----------------------------------------------------------------------------------------------------
+double GetSchedulerTimeSeconds();
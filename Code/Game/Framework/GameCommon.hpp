@@ -4,11 +4,13 @@
 
 //----------------------------------------------------------------------------------------------------
 #pragma once
-#include <vector>
-#include <windows.h>
-class Window;
+
 //-Forward-Declaration--------------------------------------------------------------------------------
 struct Rgba8;
+struct sBoxRingShape;
+struct sGlowCircleShape;
+struct sLineShape;
+struct sRingShape;
 struct Vec2;
 class App;
 class AudioSystem;
@@ -16,6 +18,8 @@ class BitmapFont;
 class Game;
 class Renderer;
 class RandomNumberGenerator;
+class Window;
+class WindowSlotMap;
 
 // one-time declaration
 extern App*                   g_theApp;
@@ -24,7 +28,7 @@ extern BitmapFont*            g_theBitmapFont;
 extern Game*                  g_theGame;
 extern Renderer*              g_theRenderer;
 extern RandomNumberGenerator* g_theRNG;
-extern std::vector<HWND>      g_gameWindows;
+extern Window*                g_theWindow;
 
 //-----------------------------------------------------------------------------------------------
 // initial settings
@@ -32,15 +36,30 @@ extern std::vector<HWND>      g_gameWindows;
 float constexpr SCREEN_SIZE_X = 1920.f;
 float constexpr SCREEN_SIZE_Y = 1200.f;
 
+//-----------------------------------------------------------------------------------------------
+// Child window drift (desktop pixels per second)
+//
+float constexpr WINDOW_DRIFT_MIN_SPEED  = 60.f;
+float constexpr WINDOW_DRIFT_MAX_SPEED  = 180.f;
+float constexpr WINDOW_DRIFT_TIME_SCALE = 1.5f;
+
 //-----------------------------------------------------------------------------------------------
 // DebugRender-related
 //
+void CreateDebugDrawPipelineState();
+void SetDebugDrawPixelsPerUnit(float pixelsPerUnit);     // Round shapes pick their segment count from this
 void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 const& color);
 void DebugDrawLine(Vec2 const& start, Vec2 const& end, float thickness, Rgba8 const& color);
 void DebugDrawGlowCircle(Vec2 const& center, float radius, Rgba8 const& color, float glowIntensity);
 void DebugDrawGlowBox(Vec2 const& center, Vec2 const& dimensions, Rgba8 const& color, float glowIntensity);
 void DebugDrawBoxRing(Vec2 const& center, float radius, float thickness, Rgba8 const& color);
 
+// Bulk forms: one batch allocation for the whole array, tessellated in place (see ShapeTessellation)
+void DebugDrawRings(sRingShape const* rings, int ringCount);
+void DebugDrawLines(sLineShape const* lines, int lineCount);
+void DebugDrawGlowCircles(sGlowCircleShape const* circles, int circleCount);
+void DebugDrawBoxRings(sBoxRingShape const* boxRings, int boxRingCount);
+
 //----------------------------------------------------------------------------------------------------
 template <typename T>
 void GAME_SAFE_RELEASE(T*& pointer)
@@ -52,5 +71,4 @@ void GAME_SAFE_RELEASE(T*& pointer)
     }
 }
 
-void CreateAndRegisterMultipleWindows(std::vector<Window>& windows, HINSTANCE hInstance, int windowCount);
-HWND CreateGameWindow(HINSTANCE hInstance, const wchar_t* title, int x, int y, int width, int height);
+void CreateAndRegisterMultipleWindows(WindowSlotMap& windows, int windowCount);
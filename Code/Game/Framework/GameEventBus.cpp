@@ -0,0 +1,182 @@
+//----------------------------------------------------------------------------------------------------
+// GameEventBus.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/GameEventBus.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/EventSystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+#include "Game/Framework/GameEvents.hpp"
+
+//----------------------------------------------------------------------------------------------------
+GameEventBus* g_theGameEventBus = nullptr;     // Created and owned by the App
+
+//----------------------------------------------------------------------------------------------------
+// Enough for every subscriber the game registers, so steady-state subscribing never reallocates.
+//
+GameEventBus::GameEventBus()
+{
+    m_subscribers.reserve(64);
+}
+
+//----------------------------------------------------------------------------------------------------
+int GameEventBus::GetSubscriberCount() const
+{
+    return static_cast<int>(m_subscribers.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+// Two names hashing alike would silently share subscribers, so a collision is fatal at subscribe
+// time, while it is cheap to check, rather than a mystery at fire time.
+//
+void GameEventBus::AddSubscriber(sEventId const& eventId, EventThunk const thunk, void* object)
+{
+    auto const rangeEnd = std::upper_bound(m_subscribers.begin(), m_subscribers.end(), eventId.m_hash,
+                                           [](uint32_t const hash, sSubscriber const& subscriber) { return hash < subscriber.m_eventHash; });
+
+    if (rangeEnd != m_subscribers.begin())
+    {
+        sSubscriber const& previous = *(rangeEnd - 1);
+
+        if (previous.m_eventHash == eventId.m_hash && strcmp(previous.m_eventName, eventId.m_name) != 0)
+        {
+            ERROR_AND_DIE(Stringf("GameEventBus: \"%s\" and \"%s\" hash to the same event ID; rename one", previous.m_eventName, eventId.m_name))
+        }
+    }
+
+    sSubscriber subscriber;
+    subscriber.m_eventHash = eventId.m_hash;
+    subscriber.m_eventName = eventId.m_name;
+    subscriber.m_thunk     = thunk;
+    subscriber.m_object    = object;
+
+    m_subscribers.insert(rangeEnd, subscriber);
+}
+
+//----------------------------------------------------------------------------------------------------
+void GameEventBus::RemoveSubscriber(uint32_t const eventHash, EventThunk const thunk, void const* object)
+{
+    auto const rangeBegin = std::lower_bound(m_subscribers.begin(), m_subscribers.end(), eventHash,
+                                             [](sSubscriber const& subscriber, uint32_t const hash) { return subscriber.m_eventHash < hash; });
+
+    for (auto subscriberIter = rangeBegin; subscriberIter != m_subscribers.end() && subscriberIter->m_eventHash == eventHash; ++subscriberIter)
+    {
+        if (subscriberIter->m_thunk == thunk && subscriberIter->m_object == object)
+        {
+            m_subscribers.erase(subscriberIter);
+            return;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int GameEventBus::Dispatch(uint32_t const eventHash, void const* payload) const
+{
+    auto const rangeBegin = std::lower_bound(m_subscribers.begin(), m_subscribers.end(), eventHash,
+                                             [](sSubscriber const& subscriber, uint32_t const hash) { return subscriber.m_eventHash < hash; });
+    int        callCount  = 0;
+
+    for (auto subscriberIter = rangeBegin; subscriberIter != m_subscribers.end() && subscriberIter->m_eventHash == eventHash; ++subscriberIter)
+    {
+        ++callCount;
+
+        if (subscriberIter->m_thunk(subscriberIter->m_object, payload))
+        {
+            break;
+        }
+    }
+
+    return callCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Benchmark subscribers: read the key code the way each path's real handlers have to, and fold it
+// into a sink so neither path can be optimized away. One instantiation per subscriber slot, so every
+// subscription is a distinct callback on both paths.
+//
+static int s_benchmarkKeySink = 0;
+
+template <int SubscriberIndex>
+static bool OnBenchmarkKeyPressedArgs(EventArgs& args)
+{
+    s_benchmarkKeySink += args.GetValue("KeyCode", -1) + SubscriberIndex;
+    return false;
+}
+
+template <int SubscriberIndex>
+static bool OnBenchmarkKeyPressedTyped(sKeyPressedEvent const& event)
+{
+    s_benchmarkKeySink += event.m_keyCode + SubscriberIndex;
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <int... SubscriberIndices>
+static void SubscribeBenchmarkKeyHandlers(EventSystem& eventSystem, GameEventBus& eventBus, int const subscriberCount, std::integer_sequence<int, SubscriberIndices...>)
+{
+    EventCallbackFunction const argsCallbacks[] = { &OnBenchmarkKeyPressedArgs<SubscriberIndices>... };
+
+    for (int subscriberIndex = 0; subscriberIndex < subscriberCount; ++subscriberIndex)
+    {
+        eventSystem.SubscribeEventCallbackFunction("KeyPressed", argsCallbacks[subscriberIndex]);
+    }
+
+    int subscriberIndex = 0;
+    ((subscriberIndex++ < subscriberCount ? eventBus.Subscribe<sKeyPressedEvent, &OnBenchmarkKeyPressedTyped<SubscriberIndices>>() : void()), ...);
+}
+
+//----------------------------------------------------------------------------------------------------
+// The string path is the one WM_KEYDOWN takes through the engine today: format the key code,
+// store it in a fresh EventArgs, look the event up by name, parse the value back in each handler.
+//
+void RunGameEventBenchmark(std::vector<sGameEventBenchmarkResult>& outResults)
+{
+    int constexpr FIRE_COUNT          = 200000;
+    int constexpr SUBSCRIBER_COUNTS[] = { 1, 8 };
+
+    for (int const subscriberCount : SUBSCRIBER_COUNTS)
+    {
+        EventSystem  eventSystem((sEventSystemConfig()));
+        GameEventBus eventBus;
+
+        eventSystem.Startup();
+        SubscribeBenchmarkKeyHandlers(eventSystem, eventBus, subscriberCount, std::make_integer_sequence<int, 8>());
+
+        double const stringStartSeconds = GetSchedulerTimeSeconds();
+
+        for (int fireIndex = 0; fireIndex < FIRE_COUNT; ++fireIndex)
+        {
+            EventArgs args;
+            args.SetValue("KeyCode", Stringf("%d", fireIndex & 0xFF));
+            eventSystem.FireEvent("KeyPressed", args);
+        }
+
+        double const typedStartSeconds = GetSchedulerTimeSeconds();
+
+        for (int fireIndex = 0; fireIndex < FIRE_COUNT; ++fireIndex)
+        {
+            sKeyPressedEvent event;
+            event.m_keyCode = static_cast<uint8_t>(fireIndex & 0xFF);
+            eventBus.Fire(event);
+        }
+
+        double const endSeconds = GetSchedulerTimeSeconds();
+
+        eventSystem.Shutdown();
+
+        sGameEventBenchmarkResult result;
+        result.m_subscriberCount   = subscriberCount;
+        result.m_fireCount         = FIRE_COUNT;
+        result.m_stringNanoseconds = (typedStartSeconds - stringStartSeconds) * 1e9 / FIRE_COUNT;
+        result.m_typedNanoseconds  = (endSeconds - typedStartSeconds) * 1e9 / FIRE_COUNT;
+
+        outResults.push_back(result);
+    }
+}
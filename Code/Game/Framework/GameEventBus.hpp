@@ -0,0 +1,180 @@
+//----------------------------------------------------------------------------------------------------
+// GameEventBus.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "Engine/Core/EngineCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// 32-bit FNV-1a. constexpr so every event ID is hashed by the compiler, never at runtime.
+//
+constexpr uint32_t HashEventName(char const* name)
+{
+    uint32_t hash = 2166136261u;
+
+    for (; *name != '\0'; ++name)
+    {
+        hash ^= static_cast<uint8_t>(*name);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------------------
+struct sEventId
+{
+    constexpr explicit sEventId(char const* name)
+        : m_name(name),
+          m_hash(HashEventName(name))
+    {
+    }
+
+    char const* m_name = nullptr;
+    uint32_t    m_hash = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Typed counterpart of EventSystem for events fired from code rather than typed at the console.
+/// Every payload is a trivially copyable struct that names its own event:
+///
+///     struct sFooEvent { static constexpr sEventId ID = sEventId("Foo"); int m_value = 0; };
+///
+///     g_theGameEventBus->Subscribe<sFooEvent, &OnFoo>();                    // bool OnFoo(sFooEvent const&)
+///     g_theGameEventBus->Subscribe<sFooEvent, Game, &Game::OnFoo>(this);    // bool Game::OnFoo(sFooEvent const&)
+///     g_theGameEventBus->Fire(sFooEvent{ 42 });
+///
+/// Subscribers live in one flat array sorted by event hash; Fire binary-searches it and calls each
+/// match through a per-callback thunk, passing the payload by reference. Nothing is allocated, parsed
+/// or formatted per fire. As with EventSystem, a callback returning true consumes the event.
+/// Game thread only; subscribing or unsubscribing from inside a callback is not supported.
+class GameEventBus
+{
+public:
+    GameEventBus();
+
+    template <typename TEvent, bool (*Callback)(TEvent const&)>
+    void Subscribe();
+    template <typename TEvent, bool (*Callback)(TEvent const&)>
+    void Unsubscribe();
+
+    template <typename TEvent, typename TObject, bool (TObject::*Method)(TEvent const&)>
+    void Subscribe(TObject* object);
+    template <typename TEvent, typename TObject, bool (TObject::*Method)(TEvent const&)>
+    void Unsubscribe(TObject* object);
+
+    template <typename TEvent>
+    int Fire(TEvent const& event) const;     // Returns the number of callbacks invoked
+
+    int GetSubscriberCount() const;
+
+private:
+    using EventThunk = bool (*)(void* object, void const* payload);
+
+    struct sSubscriber
+    {
+        uint32_t    m_eventHash = 0;
+        char const* m_eventName = nullptr;
+        EventThunk  m_thunk     = nullptr;
+        void*       m_object    = nullptr;
+    };
+
+    template <typename TEvent, bool (*Callback)(TEvent const&)>
+    static bool CallFunction(void* object, void const* payload);
+    template <typename TEvent, typename TObject, bool (TObject::*Method)(TEvent const&)>
+    static bool CallMethod(void* object, void const* payload);
+
+    template <typename TEvent>
+    static void ValidatePayload();
+
+    void AddSubscriber(sEventId const& eventId, EventThunk thunk, void* object);
+    void RemoveSubscriber(uint32_t eventHash, EventThunk thunk, void const* object);
+    int  Dispatch(uint32_t eventHash, void const* payload) const;
+
+    std::vector<sSubscriber> m_subscribers;     // Sorted by m_eventHash; equal hashes keep subscribe order
+};
+
+//----------------------------------------------------------------------------------------------------
+extern GameEventBus* g_theGameEventBus;
+
+//----------------------------------------------------------------------------------------------------
+template <typename TEvent>
+void GameEventBus::ValidatePayload()
+{
+    static_assert(std::is_trivially_copyable<TEvent>::value, "GameEventBus payloads must be plain structs");
+    static_assert(std::is_same<decltype(TEvent::ID), sEventId const>::value, "GameEventBus payloads need a static constexpr sEventId ID");
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename TEvent, bool (*Callback)(TEvent const&)>
+bool GameEventBus::CallFunction(void* object, void const* payload)
+{
+    UNUSED(object)
+    return Callback(*static_cast<TEvent const*>(payload));
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename TEvent, typename TObject, bool (TObject::*Method)(TEvent const&)>
+bool GameEventBus::CallMethod(void* object, void const* payload)
+{
+    return (static_cast<TObject*>(object)->*Method)(*static_cast<TEvent const*>(payload));
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename TEvent, bool (*Callback)(TEvent const&)>
+void GameEventBus::Subscribe()
+{
+    ValidatePayload<TEvent>();
+    AddSubscriber(TEvent::ID, &CallFunction<TEvent, Callback>, nullptr);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename TEvent, bool (*Callback)(TEvent const&)>
+void GameEventBus::Unsubscribe()
+{
+    RemoveSubscriber(TEvent::ID.m_hash, &CallFunction<TEvent, Callback>, nullptr);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename TEvent, typename TObject, bool (TObject::*Method)(TEvent const&)>
+void GameEventBus::Subscribe(TObject* object)
+{
+    ValidatePayload<TEvent>();
+    AddSubscriber(TEvent::ID, &CallMethod<TEvent, TObject, Method>, object);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename TEvent, typename TObject, bool (TObject::*Method)(TEvent const&)>
+void GameEventBus::Unsubscribe(TObject* object)
+{
+    RemoveSubscriber(TEvent::ID.m_hash, &CallMethod<TEvent, TObject, Method>, object);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename TEvent>
+int GameEventBus::Fire(TEvent const& event) const
+{
+    ValidatePayload<TEvent>();
+    return Dispatch(TEvent::ID.m_hash, &event);
+}
+
+//----------------------------------------------------------------------------------------------------
+struct sGameEventBenchmarkResult
+{
+    int    m_subscriberCount   = 0;
+    int    m_fireCount         = 0;
+    double m_stringNanoseconds = 0.0;     // Per fire: EventArgs built with Stringf, parsed with GetValue
+    double m_typedNanoseconds  = 0.0;     // Per fire: POD payload through GameEventBus
+};
+
+//----------------------------------------------------------------------------------------------------
+// Fires a key-press event through a private EventSystem and a private GameEventBus, with 1 and 8
+// subscribers that each read the key code back out.
+//
+void RunGameEventBenchmark(std::vector<sGameEventBenchmarkResult>& outResults);
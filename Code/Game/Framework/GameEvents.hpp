@@ -0,0 +1,47 @@
+//----------------------------------------------------------------------------------------------------
+// GameEvents.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Game/Framework/GameEventBus.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Payloads for the GameEventBus events the framework fires. Gameplay-only events live beside the
+// code that fires them (see sGameStateChangedEvent in Game.hpp).
+//
+struct sKeyPressedEvent
+{
+    static constexpr sEventId ID = sEventId("KeyPressed");
+
+    uint8_t m_keyCode = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sKeyReleasedEvent
+{
+    static constexpr sEventId ID = sEventId("KeyReleased");
+
+    uint8_t m_keyCode = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sCharInputEvent
+{
+    static constexpr sEventId ID = sEventId("CharInput");
+
+    uint32_t m_codePoint = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Fired once per resize of the main window; the engine's string event is translated exactly once.
+//
+struct sWindowSizeChangedEvent
+{
+    static constexpr sEventId ID = sEventId("WindowSizeChanged");
+
+    IntVec2 m_newDimensions = IntVec2::ZERO;
+};
@@ -0,0 +1,275 @@
+//----------------------------------------------------------------------------------------------------
+// InputRecording.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/InputRecording.hpp"
+
+#include <cstddef>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Input/InputSystem.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Bump when sInputLogRecord or the meaning of any of its fields changes.
+//
+uint32_t constexpr INPUT_LOG_MAGIC   = 0x31474C49;     // "ILG1"
+uint32_t constexpr INPUT_LOG_VERSION = 2;
+
+size_t constexpr INPUT_LOG_FLUSH_RECORD_COUNT = 256;
+
+//----------------------------------------------------------------------------------------------------
+struct sInputLogFileHeader
+{
+    uint32_t m_magic             = INPUT_LOG_MAGIC;
+    uint32_t m_version           = INPUT_LOG_VERSION;
+    uint32_t m_frameCount        = 0;
+    float    m_frameDeltaSeconds = 0.f;
+    uint32_t m_rngSeed           = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+InputRecorder::~InputRecorder()
+{
+    Stop();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Keys already held when recording starts are recorded as pressed on frame 0, since a replay
+// starts with every key up.
+//
+bool InputRecorder::Start(std::string const& filePath, float const frameDeltaSeconds, uint32_t const rngSeed)
+{
+    Stop();
+
+    m_file.open(filePath, std::ios::binary | std::ios::trunc);
+
+    if (!m_file)
+    {
+        DebuggerPrintf("InputRecorder: could not open %s\n", filePath.c_str());
+        return false;
+    }
+
+    sInputLogFileHeader header;
+    header.m_frameDeltaSeconds = frameDeltaSeconds;
+    header.m_rngSeed           = rngSeed;
+    m_file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+    m_filePath    = filePath;
+    m_frameIndex  = 0;
+    m_recordCount = 0;
+    m_pendingRecords.clear();
+    m_pendingRecords.reserve(INPUT_LOG_FLUSH_RECORD_COUNT);
+
+    for (bool& wasKeyDown : m_wasKeyDown)
+    {
+        wasKeyDown = false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputRecorder::Stop()
+{
+    if (!m_file.is_open())
+    {
+        return;
+    }
+
+    Flush();
+
+    m_file.seekp(offsetof(sInputLogFileHeader, m_frameCount));
+    m_file.write(reinterpret_cast<char const*>(&m_frameIndex), sizeof(m_frameIndex));
+    m_file.close();
+
+    DebuggerPrintf("InputRecorder: %u frames, %llu records written to %s\n", m_frameIndex,
+                   static_cast<unsigned long long>(m_recordCount), m_filePath.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputRecorder::IsRecording() const
+{
+    return m_file.is_open();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Key events are not recorded here: they reach the InputSystem, and FinishFrame sees them there.
+//
+void InputRecorder::RecordWindowEvent(sWindowEvent const& event, int const windowIndex)
+{
+    if (event.m_type == eWindowEventType::KEY_DOWN || event.m_type == eWindowEventType::KEY_UP)
+    {
+        return;
+    }
+
+    sInputLogRecord record;
+    record.m_frameIndex  = m_frameIndex;
+    record.m_type        = event.m_type;
+    record.m_windowIndex = static_cast<uint16_t>(windowIndex);
+    record.m_x           = event.m_type == eWindowEventType::CHAR ? static_cast<int32_t>(event.m_codePoint) : event.m_x;
+    record.m_y           = event.m_y;
+
+    AddRecord(record);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only changes in held state are logged, so a press and release within one frame (which the game
+// never sees either) leaves no record.
+//
+void InputRecorder::FinishFrame()
+{
+    for (int keyCode = 0; keyCode < 256; ++keyCode)
+    {
+        bool const isKeyDown = g_theInput->IsKeyDown(static_cast<unsigned char>(keyCode));
+
+        if (isKeyDown == m_wasKeyDown[keyCode])
+        {
+            continue;
+        }
+
+        sInputLogRecord record;
+        record.m_frameIndex = m_frameIndex;
+        record.m_type       = isKeyDown ? eWindowEventType::KEY_DOWN : eWindowEventType::KEY_UP;
+        record.m_keyCode    = static_cast<uint8_t>(keyCode);
+
+        AddRecord(record);
+        m_wasKeyDown[keyCode] = isKeyDown;
+    }
+
+    ++m_frameIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t InputRecorder::GetFrameCount() const
+{
+    return m_frameIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t InputRecorder::GetRecordCount() const
+{
+    return m_recordCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputRecorder::AddRecord(sInputLogRecord const& record)
+{
+    m_pendingRecords.push_back(record);
+    ++m_recordCount;
+
+    if (m_pendingRecords.size() >= INPUT_LOG_FLUSH_RECORD_COUNT)
+    {
+        Flush();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputRecorder::Flush()
+{
+    if (m_pendingRecords.empty())
+    {
+        return;
+    }
+
+    m_file.write(reinterpret_cast<char const*>(m_pendingRecords.data()), static_cast<std::streamsize>(m_pendingRecords.size() * sizeof(sInputLogRecord)));
+    m_file.flush();
+    m_pendingRecords.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+// A log whose header was never patched (the recording session crashed) replays every frame that
+// has a record, then stops.
+//
+bool InputReplayer::Load(std::string const& filePath)
+{
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+
+    if (!file)
+    {
+        DebuggerPrintf("InputReplayer: could not open %s\n", filePath.c_str());
+        return false;
+    }
+
+    std::streamoff const fileSize = file.tellg();
+    file.seekg(0);
+
+    sInputLogFileHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    if (!file || header.m_magic != INPUT_LOG_MAGIC || header.m_version != INPUT_LOG_VERSION)
+    {
+        DebuggerPrintf("InputReplayer: %s is not a version %u input log\n", filePath.c_str(), INPUT_LOG_VERSION);
+        return false;
+    }
+
+    size_t const recordCount = static_cast<size_t>(fileSize - static_cast<std::streamoff>(sizeof(header))) / sizeof(sInputLogRecord);
+
+    m_records.resize(recordCount);
+    file.read(reinterpret_cast<char*>(m_records.data()), static_cast<std::streamsize>(recordCount * sizeof(sInputLogRecord)));
+
+    m_nextRecordIndex   = 0;
+    m_frameCount        = header.m_frameCount;
+    m_frameDeltaSeconds = header.m_frameDeltaSeconds > 0.f ? header.m_frameDeltaSeconds : 1.f / 60.f;
+    m_rngSeed           = header.m_rngSeed;
+
+    for (bool& isKeyDown : m_isKeyDown)
+    {
+        isKeyDown = false;
+    }
+
+    if (m_frameCount == 0 && !m_records.empty())
+    {
+        m_frameCount = m_records.back().m_frameIndex + 1;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputReplayer::PopRecord(uint32_t const frameIndex, sInputLogRecord& outRecord)
+{
+    if (m_nextRecordIndex >= m_records.size() || m_records[m_nextRecordIndex].m_frameIndex != frameIndex)
+    {
+        return false;
+    }
+
+    outRecord = m_records[m_nextRecordIndex++];
+
+    if (outRecord.m_type == eWindowEventType::KEY_DOWN || outRecord.m_type == eWindowEventType::KEY_UP)
+    {
+        m_isKeyDown[outRecord.m_keyCode] = outRecord.m_type == eWindowEventType::KEY_DOWN;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputReplayer::IsFinished(uint32_t const frameIndex) const
+{
+    return frameIndex >= m_frameCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputReplayer::IsKeyDown(uint8_t const keyCode) const
+{
+    return m_isKeyDown[keyCode];
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t InputReplayer::GetFrameCount() const
+{
+    return m_frameCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+float InputReplayer::GetFrameDeltaSeconds() const
+{
+    return m_frameDeltaSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t InputReplayer::GetRNGSeed() const
+{
+    return m_rngSeed;
+}
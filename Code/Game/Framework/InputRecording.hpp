@@ -0,0 +1,88 @@
+//----------------------------------------------------------------------------------------------------
+// InputRecording.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Game/Framework/WindowEvents.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// One input change, stamped with the frame it was seen on. Key changes come from the InputSystem's
+// key state, window events from the child window ring; windows are named by dense index, since
+// native handles differ between runs. CHAR events keep their code point in m_x.
+//
+struct sInputLogRecord
+{
+    uint32_t         m_frameIndex  = 0;
+    eWindowEventType m_type        = eWindowEventType::KEY_DOWN;
+    uint8_t          m_keyCode     = 0;
+    uint16_t         m_windowIndex = 0;
+    int32_t          m_x           = 0;
+    int32_t          m_y           = 0;
+};
+
+static_assert(sizeof(sInputLogRecord) == 16, "sInputLogRecord is written to disk as-is");
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Writes the session's input to a binary log: a header, then one sInputLogRecord per change in
+/// frame order. The header also carries the seed the session's window drift was rolled from. Records are buffered and written as the buffer fills; Stop patches the frame count
+/// into the header, so a log cut short by a crash still replays up to its last flush.
+class InputRecorder
+{
+public:
+    ~InputRecorder();
+
+    bool Start(std::string const& filePath, float frameDeltaSeconds, uint32_t rngSeed);
+    void Stop();
+    bool IsRecording() const;
+
+    void RecordWindowEvent(sWindowEvent const& event, int windowIndex);
+    void FinishFrame();     // Records this frame's key changes, then moves on to the next frame
+
+    uint32_t GetFrameCount() const;
+    uint64_t GetRecordCount() const;
+
+private:
+    void AddRecord(sInputLogRecord const& record);
+    void Flush();
+
+    std::ofstream                m_file;
+    std::string                  m_filePath;
+    std::vector<sInputLogRecord> m_pendingRecords;
+    uint32_t                     m_frameIndex      = 0;
+    uint64_t                     m_recordCount     = 0;
+    bool                         m_wasKeyDown[256] = {};     // Key state as of the last FinishFrame
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Loads a log written by InputRecorder and hands its records back one frame at a time.
+/// Replay runs every frame with the log's frame delta rather than the wall clock, so the same log
+/// drives the same simulation on any machine, whatever its frame rate.
+class InputReplayer
+{
+public:
+    bool Load(std::string const& filePath);
+
+    bool PopRecord(uint32_t frameIndex, sInputLogRecord& outRecord);     // Next record stamped frameIndex, if any
+    bool IsFinished(uint32_t frameIndex) const;
+    bool IsKeyDown(uint8_t keyCode) const;                                // Key state as of the last popped record
+
+    uint32_t GetFrameCount() const;
+    float    GetFrameDeltaSeconds() const;
+    uint32_t GetRNGSeed() const;
+
+private:
+    std::vector<sInputLogRecord> m_records;
+    size_t                       m_nextRecordIndex   = 0;
+    uint32_t                     m_frameCount        = 0;
+    float                        m_frameDeltaSeconds = 1.f / 60.f;
+    uint32_t                     m_rngSeed           = 0;
+    bool                         m_isKeyDown[256]    = {};
+};
@@ -0,0 +1,383 @@
+//----------------------------------------------------------------------------------------------------
+// Main_Headless.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+// Entry point for build machines without a display, GPU or sound card.
+// Built by the Headless|x64 configuration, which defines GAME_HEADLESS, links as a console program
+// and leaves out the Win32 window backend, the D3D11 RenderDevice, XAudio2 and Media Foundation.
+// The Engine library is still linked, but its Window, Renderer and AudioSystem are never created.
+// There is no non-Windows target yet: the Engine library itself only builds with MSVC.
+//
+// Usage: FirstMultipleWindows -windows=<count> -frames=<count> [-fps=<target>] [-composite=1] [-profile=<trace.json>]
+//
+// -fps defaults to 0 (unpaced) so throughput runs measure raw frame cost.
+// -benchmark=drift runs the window drift micro-benchmark instead of the frame loop.
+// -benchmark=audio drives the audio command queue against the null audio device and prints its stats.
+// -benchmark=events compares firing a key event through EventArgs strings and through the typed bus.
+// -benchmark=stream compares decoding a long track up front against streaming it through a small ring.
+// -benchmark=text times the scalar and SIMD text mesh builders (no font is loaded headless, so the
+//  BitmapFont comparison runs only from the BenchmarkTextMesh console command).
+// -benchmark=shapes compares per-segment trig against the table-driven ring and glow circle tessellators.
+// -benchmark=raster times the software rasterizer's scalar, SIMD and threaded kernels on two scenes.
+// -softraster=1 draws every window's frame with the software rasterizer into its in-memory surface
+//  (the backgrounds and the debug text font are loaded as CPU copies for it) and prints its last-frame
+//  stats at exit.
+// -rasterthreads=<n> caps the software rasterizer's threads; 0 (default) uses every hardware thread.
+// -replay=<inputLog> feeds a log recorded with -record (or the RecordInput console command) back in
+//  on its fixed frame delta and runs until the log ends, so frame timings compare across builds.
+// -record=<inputLog> records this run's input.
+// -bakeatlas=<sourceList> packs the images listed in sourceList into Data/Images/Atlas_<n>.tga plus
+//  the Data/Images/Atlas.txt UV lookup, then exits; run it from Run/ after images change. App::Startup
+//  loads the lookup whenever it exists.
+//
+#if defined(GAME_HEADLESS)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/App.hpp"
+#include "Game/Framework/AudioService.hpp"
+#include "Game/Framework/AudioStream.hpp"
+#include "Game/Framework/FrameProfiler.hpp"
+#include "Game/Framework/GameEventBus.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/RenderDevice_Software.hpp"
+#include "Game/Framework/ShapeTessellation.hpp"
+#include "Game/Framework/SoftwareRasterizer.hpp"
+#include "Game/Framework/TextMesh.hpp"
+#include "Game/Framework/TextureAtlas.hpp"
+#include "Game/Framework/WindowKinematics.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static int ParseIntArgument(int const argc, char* argv[], char const* prefix, int const defaultValue)
+{
+    size_t const prefixLength = strlen(prefix);
+
+    for (int argIndex = 1; argIndex < argc; ++argIndex)
+    {
+        if (strncmp(argv[argIndex], prefix, prefixLength) == 0)
+        {
+            return atoi(argv[argIndex] + prefixLength);
+        }
+    }
+
+    return defaultValue;
+}
+
+//----------------------------------------------------------------------------------------------------
+static char const* ParseStringArgument(int const argc, char* argv[], char const* prefix)
+{
+    size_t const prefixLength = strlen(prefix);
+
+    for (int argIndex = 1; argIndex < argc; ++argIndex)
+    {
+        if (strncmp(argv[argIndex], prefix, prefixLength) == 0)
+        {
+            return argv[argIndex] + prefixLength;
+        }
+    }
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int RunWindowDriftBenchmarkAndPrint()
+{
+    std::vector<sWindowDriftBenchmarkResult> results;
+    RunWindowDriftBenchmark(results);
+
+    for (sWindowDriftBenchmarkResult const& result : results)
+    {
+        printf("kernel=%s windows=%d iterations=%d perObjectNs=%.3f scalarSoANs=%.3f simdSoANs=%.3f\n",
+               GetWindowDriftKernelName(),
+               result.m_windowCount,
+               result.m_iterationCount,
+               result.m_perObjectNanoseconds,
+               result.m_scalarSoANanoseconds,
+               result.m_simdSoANanoseconds);
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int RunAudioServiceBenchmarkAndPrint()
+{
+    std::vector<sAudioBenchmarkResult> results;
+    RunAudioServiceBenchmark(results);
+
+    for (sAudioBenchmarkResult const& result : results)
+    {
+        sAudioServiceStats const& stats = result.m_stats;
+
+        printf("deviceCallUs=%.0f commands=%d postNs=%.1f processed=%llu dropped=%llu maxQueueDepth=%u avgLatencyUs=%.1f maxLatencyUs=%.1f started=%llu stolen=%llu rejected=%llu\n",
+               result.m_callSeconds * 1e6,
+               result.m_commandCount,
+               result.m_postNanoseconds,
+               static_cast<unsigned long long>(stats.m_commandsProcessed),
+               static_cast<unsigned long long>(stats.m_commandsDropped),
+               stats.m_maxQueueDepth,
+               stats.m_averageLatencySeconds * 1e6,
+               stats.m_maxLatencySeconds * 1e6,
+               static_cast<unsigned long long>(stats.m_voicesStarted),
+               static_cast<unsigned long long>(stats.m_voicesStolen),
+               static_cast<unsigned long long>(stats.m_voicesRejected));
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int RunAudioStreamBenchmarkAndPrint()
+{
+    std::vector<sAudioStreamBenchmarkResult> results;
+    RunAudioStreamBenchmark(results);
+
+    if (results.empty())
+    {
+        printf("stream benchmark: could not write the test track\n");
+        return 1;
+    }
+
+    printf("full decode: track=%.0fs bytes=%llu seconds=%.3f\n", results[0].m_trackSeconds,
+           static_cast<unsigned long long>(results[0].m_fullDecodeBytes), results[0].m_fullDecodeSeconds);
+
+    for (sAudioStreamBenchmarkResult const& result : results)
+    {
+        sAudioStreamStats const& stats = result.m_stats;
+
+        printf("ringFrames=%d peakResidentBytes=%llu startMs=%.3f playbackSeconds=%.2f refills=%llu maxRefillMs=%.3f underrunFrames=%llu\n",
+               result.m_ringFrameCount,
+               static_cast<unsigned long long>(result.m_peakResidentBytes),
+               stats.m_maxStartSeconds * 1000.0,
+               result.m_playbackSeconds,
+               static_cast<unsigned long long>(stats.m_refillCount),
+               stats.m_maxRefillSeconds * 1000.0,
+               static_cast<unsigned long long>(stats.m_underrunFrameCount));
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int RunGameEventBenchmarkAndPrint()
+{
+    std::vector<sGameEventBenchmarkResult> results;
+    RunGameEventBenchmark(results);
+
+    for (sGameEventBenchmarkResult const& result : results)
+    {
+        printf("subscribers=%d fires=%d eventArgsNs=%.1f typedNs=%.1f\n",
+               result.m_subscriberCount,
+               result.m_fireCount,
+               result.m_stringNanoseconds,
+               result.m_typedNanoseconds);
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int RunTextMeshBenchmarkAndPrint()
+{
+    std::vector<sTextMeshBenchmarkResult> results;
+    RunTextMeshBenchmark(nullptr, results);
+
+    for (sTextMeshBenchmarkResult const& result : results)
+    {
+        printf("kernel=%s case=%s glyphs=%d iterations=%d scalarGlyphsPerSec=%.0f simdGlyphsPerSec=%.0f\n",
+               GetTextMeshKernelName(),
+               result.m_caseName,
+               result.m_glyphCount,
+               result.m_iterationCount,
+               result.m_scalarGlyphsPerSecond,
+               result.m_simdGlyphsPerSecond);
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int RunShapeTessellationBenchmarkAndPrint()
+{
+    std::vector<sShapeTessellationBenchmarkResult> results;
+    RunShapeTessellationBenchmark(results);
+
+    for (sShapeTessellationBenchmarkResult const& result : results)
+    {
+        printf("kernel=%s shape=%s shapes=%d segments=%d iterations=%d trigVertsPerSec=%.0f tableScalarVertsPerSec=%.0f tableSimdVertsPerSec=%.0f\n",
+               GetShapeTessellationKernelName(),
+               result.m_shapeName,
+               result.m_shapeCount,
+               result.m_segmentCount,
+               result.m_iterationCount,
+               result.m_trigVertsPerSecond,
+               result.m_tableScalarVertsPerSecond,
+               result.m_tableSIMDVertsPerSecond);
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int RunSoftwareRasterizerBenchmarkAndPrint()
+{
+    std::vector<sSoftwareRasterizerBenchmarkResult> results;
+    RunSoftwareRasterizerBenchmark(results);
+
+    for (sSoftwareRasterizerBenchmarkResult const& result : results)
+    {
+        printf("kernel=%s scene=%s width=%d height=%d triangles=%d frames=%d threads=%d scalarMs=%.3f simdMs=%.3f threadedMs=%.3f identical=%d\n",
+               GetSoftwareRasterizerKernelName(),
+               result.m_sceneName,
+               result.m_targetDimensions.x,
+               result.m_targetDimensions.y,
+               result.m_triangleCount,
+               result.m_frameCount,
+               result.m_threadCount,
+               result.m_scalarMillisecondsPerFrame,
+               result.m_simdMillisecondsPerFrame,
+               result.m_threadedMillisecondsPerFrame,
+               result.m_isOutputIdentical ? 1 : 0);
+    }
+
+    return 0;
+}
+
+//-----------------------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    char const* benchmarkName = ParseStringArgument(argc, argv, "-benchmark=");
+
+    if (benchmarkName != nullptr && strcmp(benchmarkName, "drift") == 0)
+    {
+        return RunWindowDriftBenchmarkAndPrint();
+    }
+
+    if (benchmarkName != nullptr && strcmp(benchmarkName, "audio") == 0)
+    {
+        return RunAudioServiceBenchmarkAndPrint();
+    }
+
+    if (benchmarkName != nullptr && strcmp(benchmarkName, "events") == 0)
+    {
+        return RunGameEventBenchmarkAndPrint();
+    }
+
+    if (benchmarkName != nullptr && strcmp(benchmarkName, "stream") == 0)
+    {
+        return RunAudioStreamBenchmarkAndPrint();
+    }
+
+    if (benchmarkName != nullptr && strcmp(benchmarkName, "text") == 0)
+    {
+        return RunTextMeshBenchmarkAndPrint();
+    }
+
+    if (benchmarkName != nullptr && strcmp(benchmarkName, "shapes") == 0)
+    {
+        return RunShapeTessellationBenchmarkAndPrint();
+    }
+
+    if (benchmarkName != nullptr && strcmp(benchmarkName, "raster") == 0)
+    {
+        return RunSoftwareRasterizerBenchmarkAndPrint();
+    }
+
+    char const* atlasSourceListPath = ParseStringArgument(argc, argv, "-bakeatlas=");
+
+    if (atlasSourceListPath != nullptr)
+    {
+        int const pageCount = BakeTextureAtlas(atlasSourceListPath, "Data/Images/Atlas");
+        printf("bakeatlas sources=%s pages=%d\n", atlasSourceListPath, pageCount);
+        return pageCount < 0 ? 1 : 0;
+    }
+
+    char const* inputReplayFilePath = ParseStringArgument(argc, argv, "-replay=");
+    char const* inputRecordFilePath = ParseStringArgument(argc, argv, "-record=");
+
+    sAppConfig appConfig;
+    appConfig.m_windowBackendType   = eWindowBackendType::HEADLESS;
+    appConfig.m_initialWindowCount  = ParseIntArgument(argc, argv, "-windows=", 2);
+    appConfig.m_maxFrameCount       = ParseIntArgument(argc, argv, "-frames=", inputReplayFilePath != nullptr ? -1 : 1000);
+    appConfig.m_inputReplayFilePath = inputReplayFilePath != nullptr ? inputReplayFilePath : "";
+    appConfig.m_inputRecordFilePath = inputRecordFilePath != nullptr ? inputRecordFilePath : "";
+
+    appConfig.m_windowPresentMode  = ParseIntArgument(argc, argv, "-composite=", 0) != 0 ? eWindowPresentMode::COMPOSITE_SCENE : eWindowPresentMode::RENDER_PER_WINDOW;
+
+    appConfig.m_frameSchedulerConfig.m_targetFramesPerSecond = static_cast<float>(ParseIntArgument(argc, argv, "-fps=", 0));
+
+    appConfig.m_isSoftwareRasterEnabled                = ParseIntArgument(argc, argv, "-softraster=", 0) != 0;
+    appConfig.m_softwareRasterizerConfig.m_threadCount = ParseIntArgument(argc, argv, "-rasterthreads=", 0);
+
+    g_theApp = new App(appConfig);
+    g_theApp->Startup();
+
+    char const* profileFilePath = ParseStringArgument(argc, argv, "-profile=");
+
+    if (profileFilePath != nullptr)
+    {
+        FrameProfiler::StartCapture();
+    }
+
+    auto const loopStartTime = std::chrono::steady_clock::now();
+    g_theApp->RunMainLoop();
+    auto const loopEndTime = std::chrono::steady_clock::now();
+
+    if (profileFilePath != nullptr)
+    {
+        FrameProfiler::StopCapture();
+        FrameProfiler::WriteChromeTrace(profileFilePath);
+    }
+
+    double const elapsedSeconds = std::chrono::duration<double>(loopEndTime - loopStartTime).count();
+    double const frameCount     = static_cast<double>(g_theApp->GetFrameCount());
+
+    sFrameSchedulerStats const& schedulerStats = g_theApp->GetFrameScheduler().GetStats();
+
+    printf("windows=%d frames=%d seconds=%.4f fps=%.2f msPerFrame=%.4f missedDeadlines=%llu\n",
+           appConfig.m_initialWindowCount,
+           g_theApp->GetFrameCount(),
+           elapsedSeconds,
+           frameCount / elapsedSeconds,
+           1000.0 * elapsedSeconds / frameCount,
+           static_cast<unsigned long long>(schedulerStats.m_missedDeadlineCount));
+
+    sWindowTransformStats const& transformStats = g_theApp->GetWindowTransforms().GetTotalStats();
+
+    printf("windowTransformRequests=%u windowCommits=%u platformCommits=%u savedPlatformCommits=%u\n",
+           transformStats.m_requestCount,
+           transformStats.m_committedWindowCount,
+           transformStats.m_platformCommitCount,
+           transformStats.GetSavedPlatformCommitCount());
+
+    if (g_theRenderDevice != nullptr && g_theRenderDevice->GetType() == eRenderDeviceType::SOFTWARE)
+    {
+        SoftwareRasterizer const&       rasterizer  = static_cast<SoftwareRenderDevice const*>(g_theRenderDevice)->GetRasterizer();
+        sSoftwareRasterizerStats const& rasterStats = rasterizer.GetLastFrameStats();
+
+        printf("rasterKernel=%s rasterThreads=%d lastFrameFlushes=%u draws=%u triangles=%u culled=%u binEntries=%u tiles=%u pixels=%llu shadeMs=%.3f\n",
+               GetSoftwareRasterizerKernelName(),
+               rasterizer.GetThreadCount(),
+               rasterStats.m_flushCount,
+               rasterStats.m_drawCount,
+               rasterStats.m_triangleCount,
+               rasterStats.m_culledTriangleCount,
+               rasterStats.m_binEntryCount,
+               rasterStats.m_tileCount,
+               static_cast<unsigned long long>(rasterStats.m_pixelCount),
+               rasterStats.m_flushSeconds * 1000.0);
+    }
+
+    g_theApp->Shutdown();
+
+    GAME_SAFE_RELEASE(g_theApp);
+
+    return 0;
+}
+
+#endif // defined(GAME_HEADLESS)
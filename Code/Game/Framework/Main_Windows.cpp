@@ -2,9 +2,13 @@
 // Main_Windows.cpp
 //----------------------------------------------------------------------------------------------------
 
+// The Headless configuration builds Main_Headless.cpp's main() instead.
+#if !defined(GAME_HEADLESS)
+
 #define WIN32_LEAN_AND_MEAN		// Always #define this before #including <windows.h>
 
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <OleCtl.h>
 #include <windows.h>			// #include this (massive, platform-specific) header in VERY few places (and .CPPs only)
@@ -18,10 +22,21 @@ int WINAPI WinMain(HINSTANCE const applicationInstanceHandle,
                    LPSTR const commandLineString,
                    int)
 {
-    UNUSED(applicationInstanceHandle)
-    UNUSED(commandLineString)
+    sAppConfig appConfig;
+    appConfig.m_applicationInstanceHandle = applicationInstanceHandle;
+    appConfig.m_windowBackendType         = eWindowBackendType::WIN32_NATIVE;
+    appConfig.m_windowPresentMode         = strstr(commandLineString, "-composite") != nullptr ? eWindowPresentMode::COMPOSITE_SCENE : eWindowPresentMode::RENDER_PER_WINDOW;
+
+    // -record=<inputLog> records the session's input for a headless -replay run.
+    char const* recordArgument = strstr(commandLineString, "-record=");
 
-    g_theApp = new App(applicationInstanceHandle);
+    if (recordArgument != nullptr)
+    {
+        recordArgument += strlen("-record=");
+        appConfig.m_inputRecordFilePath.assign(recordArgument, strcspn(recordArgument, " "));
+    }
+
+    g_theApp = new App(appConfig);
     g_theApp->Startup();
     g_theApp->RunMainLoop();
     g_theApp->Shutdown();
@@ -30,3 +45,5 @@ int WINAPI WinMain(HINSTANCE const applicationInstanceHandle,
 
     return 0;
 }
+
+#endif // !defined(GAME_HEADLESS)
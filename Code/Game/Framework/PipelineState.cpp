@@ -0,0 +1,103 @@
+//----------------------------------------------------------------------------------------------------
+// PipelineState.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/PipelineState.hpp"
+
+#include <cstring>
+
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/RenderDevice.hpp"
+
+//----------------------------------------------------------------------------------------------------
+PipelineStateCache* g_thePipelineStateCache = nullptr;     // Created and owned by the App
+
+//----------------------------------------------------------------------------------------------------
+PipelineState::PipelineState(sPipelineStateDesc const& desc)
+    : m_desc(desc)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+sPipelineStateDesc const& PipelineState::GetDesc() const
+{
+    return m_desc;
+}
+
+//----------------------------------------------------------------------------------------------------
+void PipelineStateCache::Bind(PipelineState const& state)
+{
+    sPipelineStateDesc const& desc = state.GetDesc();
+
+    ++m_frameStats.m_bindCount;
+
+    // Each field is compared on its own: two states that share a shader still skip BindShader.
+    auto const apply = [this](bool const isChanged, auto const& call)
+    {
+        if (isChanged)
+        {
+            call();
+            ++m_frameStats.m_stateChangesIssued;
+        }
+        else
+        {
+            ++m_frameStats.m_stateChangesSkipped;
+        }
+    };
+
+    bool const isValid = m_isBoundDescValid;
+
+    apply(!isValid || desc.m_blendMode != m_boundDesc.m_blendMode, [&] { g_theRenderDevice->SetBlendMode(desc.m_blendMode); });
+    apply(!isValid || desc.m_rasterizerMode != m_boundDesc.m_rasterizerMode, [&] { g_theRenderDevice->SetRasterizerMode(desc.m_rasterizerMode); });
+    apply(!isValid || desc.m_samplerMode != m_boundDesc.m_samplerMode, [&] { g_theRenderDevice->SetSamplerMode(desc.m_samplerMode); });
+    apply(!isValid || desc.m_depthMode != m_boundDesc.m_depthMode, [&] { g_theRenderDevice->SetDepthMode(desc.m_depthMode); });
+    apply(!isValid || desc.m_texture != m_boundDesc.m_texture || desc.m_textureKey != m_boundDesc.m_textureKey, [&] { g_theRenderDevice->BindTexture(desc.m_texture, desc.m_textureKey); });
+    apply(!isValid || desc.m_shader != m_boundDesc.m_shader, [&] { g_theRenderDevice->BindShader(desc.m_shader); });
+
+    m_boundDesc        = desc;
+    m_isBoundDescValid = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void PipelineStateCache::SetModelConstants(Mat44 const& modelToWorldTransform, Rgba8 const& modelColor)
+{
+    bool const isChanged = !m_areModelConstantsValid ||
+                           memcmp(&modelToWorldTransform, &m_modelToWorldTransform, sizeof(Mat44)) != 0 ||
+                           !(modelColor == m_modelColor);
+
+    if (!isChanged)
+    {
+        ++m_frameStats.m_stateChangesSkipped;
+        return;
+    }
+
+    g_theRenderDevice->SetModelConstants(modelToWorldTransform, modelColor);
+    ++m_frameStats.m_stateChangesIssued;
+
+    m_modelToWorldTransform  = modelToWorldTransform;
+    m_modelColor             = modelColor;
+    m_areModelConstantsValid = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void PipelineStateCache::Invalidate()
+{
+    m_isBoundDescValid       = false;
+    m_areModelConstantsValid = false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void PipelineStateCache::BeginFrame()
+{
+    Invalidate();
+
+    m_lastFrameStats = m_frameStats;
+    m_frameStats     = sPipelineStateStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+sPipelineStateStats const& PipelineStateCache::GetLastFrameStats() const
+{
+    return m_lastFrameStats;
+}
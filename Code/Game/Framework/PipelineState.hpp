@@ -0,0 +1,82 @@
+//----------------------------------------------------------------------------------------------------
+// PipelineState.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Shader;
+class Texture;
+
+//----------------------------------------------------------------------------------------------------
+struct sPipelineStateDesc
+{
+    eBlendMode      m_blendMode      = eBlendMode::OPAQUE;
+    eRasterizerMode m_rasterizerMode = eRasterizerMode::SOLID_CULL_BACK;
+    eSamplerMode    m_samplerMode    = eSamplerMode::POINT_CLAMP;
+    eDepthMode      m_depthMode      = eDepthMode::DISABLED;
+    Texture const*  m_texture        = nullptr;
+    uint64_t        m_textureKey     = 0;                                    // AssetRegistry::GetTextureKey; the software device finds textures by it
+    Shader const*   m_shader         = nullptr;
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Immutable bundle of every piece of Renderer state a draw needs besides its model constants.
+/// Build one per distinct look at startup (resolving the texture and shader there, not per draw) and
+/// hand it to PipelineStateCache::Bind before drawing.
+class PipelineState
+{
+public:
+    PipelineState() = default;
+    explicit PipelineState(sPipelineStateDesc const& desc);
+
+    sPipelineStateDesc const& GetDesc() const;
+
+private:
+    sPipelineStateDesc m_desc;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sPipelineStateStats
+{
+    uint32_t m_bindCount           = 0;
+    uint32_t m_stateChangesIssued  = 0;     // Renderer Set*/Bind* calls actually made
+    uint32_t m_stateChangesSkipped = 0;     // Calls elided because the Renderer already had that state
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Shadows the Renderer's current pipeline state and model constants, and forwards only the parts
+/// that differ from what was last set. Anything that sets Renderer state directly (DevConsole,
+/// DebugRender) leaves the shadow stale, so the cache is invalidated at the start of every frame and
+/// must be invalidated by any other caller that bypasses it.
+class PipelineStateCache
+{
+public:
+    void Bind(PipelineState const& state);
+    void SetModelConstants(Mat44 const& modelToWorldTransform = Mat44(), Rgba8 const& modelColor = Rgba8::WHITE);
+    void Invalidate();
+
+    void BeginFrame();
+
+    sPipelineStateStats const& GetLastFrameStats() const;
+
+private:
+    sPipelineStateDesc  m_boundDesc;
+    bool                m_isBoundDescValid = false;
+    Mat44               m_modelToWorldTransform;
+    Rgba8               m_modelColor;
+    bool                m_areModelConstantsValid = false;
+    sPipelineStateStats m_frameStats;
+    sPipelineStateStats m_lastFrameStats;
+};
+
+//----------------------------------------------------------------------------------------------------
+extern PipelineStateCache* g_thePipelineStateCache;
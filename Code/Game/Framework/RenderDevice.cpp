@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------------------------------
+// RenderDevice.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/RenderDevice.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Game/Framework/RenderDevice_Engine.hpp"
+#include "Game/Framework/RenderDevice_Software.hpp"
+
+//----------------------------------------------------------------------------------------------------
+RenderDevice* g_theRenderDevice = nullptr;     // Created and owned by the App
+
+//----------------------------------------------------------------------------------------------------
+STATIC RenderDevice* RenderDevice::Create(eRenderDeviceType const type)
+{
+    switch (type)
+    {
+    case eRenderDeviceType::ENGINE:
+#if !defined(GAME_HEADLESS)
+        return new EngineRenderDevice();
+#else
+        ERROR_AND_DIE("RenderDevice::Create: ENGINE device is not available in this build")
+#endif
+
+    case eRenderDeviceType::SOFTWARE: return new SoftwareRenderDevice();
+    }
+
+    return nullptr;
+}
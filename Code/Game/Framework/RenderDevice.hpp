@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------------------------------
+// RenderDevice.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+struct Vertex_PCU;
+class Camera;
+class Shader;
+class Texture;
+class VertexBuffer;
+
+//----------------------------------------------------------------------------------------------------
+enum class eRenderDeviceType : int8_t
+{
+    ENGINE,      // Forwards to g_theRenderer (D3D11)
+    SOFTWARE     // SoftwareRasterizer into in-memory surfaces; needs no GPU or display
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// The Renderer calls Game code draws with. Creating resources (textures, shaders, vertex buffers)
+/// stays on the Renderer; everything that sets state or draws goes through here, so the same frame
+/// can be drawn by the GPU or on the CPU.
+class RenderDevice
+{
+public:
+    virtual ~RenderDevice() = default;
+
+    virtual void BeginFrame() = 0;
+    virtual void EndFrame() = 0;
+    virtual void ClearScreen(Rgba8 const& clearColor) = 0;
+    virtual void BeginCamera(Camera const& camera) = 0;
+    virtual void EndCamera(Camera const& camera) = 0;
+
+    virtual void SetModelConstants(Mat44 const& modelToWorldTransform, Rgba8 const& modelColor) = 0;
+    virtual void SetBlendMode(eBlendMode blendMode) = 0;
+    virtual void SetRasterizerMode(eRasterizerMode rasterizerMode) = 0;
+    virtual void SetSamplerMode(eSamplerMode samplerMode) = 0;
+    virtual void SetDepthMode(eDepthMode depthMode) = 0;
+    virtual void BindTexture(Texture const* texture, uint64_t textureKey) = 0;
+    virtual void BindShader(Shader const* shader) = 0;
+
+    virtual void DrawVertexArray(int vertCount, Vertex_PCU const* verts) = 0;
+    virtual void DrawVertexBuffer(VertexBuffer* vertexBuffer, unsigned int vertexCount) = 0;
+    virtual bool HasVertexBuffers() const = 0;     // false: retained geometry is kept on the CPU and drawn as arrays
+
+    virtual eRenderDeviceType GetType() const = 0;
+
+    static RenderDevice* Create(eRenderDeviceType type);
+};
+
+//----------------------------------------------------------------------------------------------------
+extern RenderDevice* g_theRenderDevice;
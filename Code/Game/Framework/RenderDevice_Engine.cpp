@@ -0,0 +1,111 @@
+//----------------------------------------------------------------------------------------------------
+// RenderDevice_Engine.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/RenderDevice_Engine.hpp"
+
+#if !defined(GAME_HEADLESS)
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::BeginFrame()
+{
+    g_theRenderer->BeginFrame();
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::EndFrame()
+{
+    g_theRenderer->EndFrame();
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::ClearScreen(Rgba8 const& clearColor)
+{
+    g_theRenderer->ClearScreen(clearColor);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::BeginCamera(Camera const& camera)
+{
+    g_theRenderer->BeginCamera(camera);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::EndCamera(Camera const& camera)
+{
+    g_theRenderer->EndCamera(camera);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::SetModelConstants(Mat44 const& modelToWorldTransform, Rgba8 const& modelColor)
+{
+    g_theRenderer->SetModelConstants(modelToWorldTransform, modelColor);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::SetBlendMode(eBlendMode const blendMode)
+{
+    g_theRenderer->SetBlendMode(blendMode);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::SetRasterizerMode(eRasterizerMode const rasterizerMode)
+{
+    g_theRenderer->SetRasterizerMode(rasterizerMode);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::SetSamplerMode(eSamplerMode const samplerMode)
+{
+    g_theRenderer->SetSamplerMode(samplerMode);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::SetDepthMode(eDepthMode const depthMode)
+{
+    g_theRenderer->SetDepthMode(depthMode);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::BindTexture(Texture const* const texture, uint64_t const textureKey)
+{
+    UNUSED(textureKey)
+
+    g_theRenderer->BindTexture(texture);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::BindShader(Shader const* const shader)
+{
+    g_theRenderer->BindShader(shader);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::DrawVertexArray(int const vertCount, Vertex_PCU const* const verts)
+{
+    g_theRenderer->DrawVertexArray(vertCount, verts);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineRenderDevice::DrawVertexBuffer(VertexBuffer* const vertexBuffer, unsigned int const vertexCount)
+{
+    g_theRenderer->DrawVertexBuffer(vertexBuffer, vertexCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EngineRenderDevice::HasVertexBuffers() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+eRenderDeviceType EngineRenderDevice::GetType() const
+{
+    return eRenderDeviceType::ENGINE;
+}
+
+#endif // !defined(GAME_HEADLESS)
@@ -0,0 +1,34 @@
+//----------------------------------------------------------------------------------------------------
+// RenderDevice_Engine.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Game/Framework/RenderDevice.hpp"
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Draws through the Engine's D3D11 Renderer, one call for one call.
+class EngineRenderDevice : public RenderDevice
+{
+public:
+    void BeginFrame() override;
+    void EndFrame() override;
+    void ClearScreen(Rgba8 const& clearColor) override;
+    void BeginCamera(Camera const& camera) override;
+    void EndCamera(Camera const& camera) override;
+
+    void SetModelConstants(Mat44 const& modelToWorldTransform, Rgba8 const& modelColor) override;
+    void SetBlendMode(eBlendMode blendMode) override;
+    void SetRasterizerMode(eRasterizerMode rasterizerMode) override;
+    void SetSamplerMode(eSamplerMode samplerMode) override;
+    void SetDepthMode(eDepthMode depthMode) override;
+    void BindTexture(Texture const* texture, uint64_t textureKey) override;
+    void BindShader(Shader const* shader) override;
+
+    void DrawVertexArray(int vertCount, Vertex_PCU const* verts) override;
+    void DrawVertexBuffer(VertexBuffer* vertexBuffer, unsigned int vertexCount) override;
+    bool HasVertexBuffers() const override;
+
+    eRenderDeviceType GetType() const override;
+};
@@ -0,0 +1,148 @@
+//----------------------------------------------------------------------------------------------------
+// RenderDevice_Software.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/RenderDevice_Software.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Renderer/Camera.hpp"
+
+//----------------------------------------------------------------------------------------------------
+SoftwareRenderDevice::SoftwareRenderDevice(sSoftwareRasterizerConfig const& config)
+    : m_rasterizer(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::BeginFrame()
+{
+    m_rasterizer.BeginFrame();
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::EndFrame()
+{
+    m_rasterizer.Flush();
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::ClearScreen(Rgba8 const& clearColor)
+{
+    m_rasterizer.ClearScreen(clearColor);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Game cameras are orthographic and cover the whole target, so the camera is only its view bounds.
+//
+void SoftwareRenderDevice::BeginCamera(Camera const& camera)
+{
+    m_rasterizer.SetViewBounds(AABB2(camera.GetOrthographicBottomLeft(), camera.GetOrthographicTopRight()));
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::EndCamera(Camera const& camera)
+{
+    UNUSED(camera)
+
+    m_rasterizer.Flush();
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::SetModelConstants(Mat44 const& modelToWorldTransform, Rgba8 const& modelColor)
+{
+    m_rasterizer.SetModelConstants(modelToWorldTransform, modelColor);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::SetBlendMode(eBlendMode const blendMode)
+{
+    m_rasterizer.SetBlendMode(blendMode);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::SetRasterizerMode(eRasterizerMode const rasterizerMode)
+{
+    m_rasterizer.SetRasterizerMode(rasterizerMode);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::SetSamplerMode(eSamplerMode const samplerMode)
+{
+    m_rasterizer.SetSamplerMode(samplerMode);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Draws land in submission order, which is all the depth state the Game uses (DISABLED) amounts to.
+//
+void SoftwareRenderDevice::SetDepthMode(eDepthMode const depthMode)
+{
+    UNUSED(depthMode)
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::BindTexture(Texture const* const texture, uint64_t const textureKey)
+{
+    UNUSED(texture)
+
+    auto const found = m_rasterTextures.find(textureKey);
+
+    m_rasterizer.BindTexture(found != m_rasterTextures.end() ? found->second : nullptr);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::BindShader(Shader const* const shader)
+{
+    UNUSED(shader)
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::DrawVertexArray(int const vertCount, Vertex_PCU const* const verts)
+{
+    m_rasterizer.DrawVertexArray(vertCount, verts);
+}
+
+//----------------------------------------------------------------------------------------------------
+// HasVertexBuffers is false, so RetainedMesh keeps its vertices and never gets here.
+//
+void SoftwareRenderDevice::DrawVertexBuffer(VertexBuffer* const vertexBuffer, unsigned int const vertexCount)
+{
+    UNUSED(vertexBuffer)
+    UNUSED(vertexCount)
+}
+
+//----------------------------------------------------------------------------------------------------
+bool SoftwareRenderDevice::HasVertexBuffers() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+eRenderDeviceType SoftwareRenderDevice::GetType() const
+{
+    return eRenderDeviceType::SOFTWARE;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::SetTarget(Rgba8* const pixels, IntVec2 const& dimensions)
+{
+    m_rasterizer.SetTarget(pixels, dimensions);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderDevice::RegisterTexture(uint64_t const textureKey, sRasterTexture const* const rasterTexture)
+{
+    if (rasterTexture == nullptr)
+    {
+        m_rasterTextures.erase(textureKey);
+        return;
+    }
+
+    m_rasterTextures[textureKey] = rasterTexture;
+}
+
+//----------------------------------------------------------------------------------------------------
+SoftwareRasterizer const& SoftwareRenderDevice::GetRasterizer() const
+{
+    return m_rasterizer;
+}
@@ -0,0 +1,51 @@
+//----------------------------------------------------------------------------------------------------
+// RenderDevice_Software.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <unordered_map>
+
+#include "Game/Framework/RenderDevice.hpp"
+#include "Game/Framework/SoftwareRasterizer.hpp"
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Draws on the CPU into whatever RGBA8 surface SetTarget names (a headless window, the composite
+/// scene). Draws are recorded and binned as they arrive; EndCamera and SetTarget shade them on every
+/// core. Engine Textures have no CPU copy, so textures are bound by their texture key and a key samples
+/// opaque white until a CPU copy is registered under it. Shaders are ignored: every draw is shaded as Default.hlsl would shade it.
+class SoftwareRenderDevice : public RenderDevice
+{
+public:
+    explicit SoftwareRenderDevice(sSoftwareRasterizerConfig const& config = sSoftwareRasterizerConfig());
+
+    void BeginFrame() override;
+    void EndFrame() override;
+    void ClearScreen(Rgba8 const& clearColor) override;
+    void BeginCamera(Camera const& camera) override;
+    void EndCamera(Camera const& camera) override;
+
+    void SetModelConstants(Mat44 const& modelToWorldTransform, Rgba8 const& modelColor) override;
+    void SetBlendMode(eBlendMode blendMode) override;
+    void SetRasterizerMode(eRasterizerMode rasterizerMode) override;
+    void SetSamplerMode(eSamplerMode samplerMode) override;
+    void SetDepthMode(eDepthMode depthMode) override;
+    void BindTexture(Texture const* texture, uint64_t textureKey) override;
+    void BindShader(Shader const* shader) override;
+
+    void DrawVertexArray(int vertCount, Vertex_PCU const* verts) override;
+    void DrawVertexBuffer(VertexBuffer* vertexBuffer, unsigned int vertexCount) override;
+    bool HasVertexBuffers() const override;
+
+    eRenderDeviceType GetType() const override;
+
+    void SetTarget(Rgba8* pixels, IntVec2 const& dimensions);     // Row 0 is the top; finishes the previous target first
+    void RegisterTexture(uint64_t textureKey, sRasterTexture const* rasterTexture);     // Not owned; nullptr unregisters
+
+    SoftwareRasterizer const& GetRasterizer() const;
+
+private:
+    SoftwareRasterizer                                    m_rasterizer;
+    std::unordered_map<uint64_t, sRasterTexture const*> m_rasterTextures;     // By AssetRegistry::GetTextureKey
+};
@@ -0,0 +1,53 @@
+//----------------------------------------------------------------------------------------------------
+// RenderView.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Renderer/Camera.hpp"
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// One pass of Game rendering: the camera to draw through, and the scene-space rect it can see.
+/// Draw submissions whose bounds miss m_cullBounds are dropped before they reach the Renderer.
+/// m_pixelsPerUnit scales scene lengths to target pixels, so curved shapes can pick a level of detail.
+struct sRenderView
+{
+    bool IsVisible(AABB2 const& bounds) const
+    {
+        return bounds.m_maxs.x >= m_cullBounds.m_mins.x && bounds.m_mins.x <= m_cullBounds.m_maxs.x &&
+               bounds.m_maxs.y >= m_cullBounds.m_mins.y && bounds.m_mins.y <= m_cullBounds.m_maxs.y;
+    }
+
+    void SetSceneBounds(AABB2 const& sceneBounds)
+    {
+        m_cullBounds = sceneBounds;
+        m_camera.SetOrthoGraphicView(sceneBounds.m_mins, sceneBounds.m_maxs);
+        m_camera.SetNormalizedViewport(AABB2::ZERO_TO_ONE);
+    }
+
+    // Call after SetSceneBounds; the finer axis wins when the view stretches the scene unevenly.
+    void SetTargetDimensions(Vec2 const& targetDimensions)
+    {
+        float const sceneWidth  = m_cullBounds.m_maxs.x - m_cullBounds.m_mins.x;
+        float const sceneHeight = m_cullBounds.m_maxs.y - m_cullBounds.m_mins.y;
+
+        if (sceneWidth <= 0.f || sceneHeight <= 0.f)
+        {
+            m_pixelsPerUnit = 1.f;
+            return;
+        }
+
+        float const pixelsPerUnitX = targetDimensions.x / sceneWidth;
+        float const pixelsPerUnitY = targetDimensions.y / sceneHeight;
+
+        m_pixelsPerUnit = pixelsPerUnitX > pixelsPerUnitY ? pixelsPerUnitX : pixelsPerUnitY;
+    }
+
+    float GetProjectedLength(float const sceneLength) const { return sceneLength * m_pixelsPerUnit; }
+
+    Camera m_camera;
+    AABB2  m_cullBounds;
+    float  m_pixelsPerUnit = 1.f;
+};
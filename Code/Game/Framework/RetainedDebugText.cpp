@@ -0,0 +1,267 @@
+//----------------------------------------------------------------------------------------------------
+// RetainedDebugText.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/RetainedDebugText.hpp"
+
+#include <cstdarg>
+#include <cstdio>
+
+#include "Game/Framework/AssetRegistry.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/TextMesh.hpp"
+
+//----------------------------------------------------------------------------------------------------
+RetainedDebugText* g_theRetainedDebugText = nullptr;     // Created and owned by the App
+
+//----------------------------------------------------------------------------------------------------
+// Same look DebugAddScreenText uses: the font texture, alpha blended, default shader.
+//
+RetainedDebugText::RetainedDebugText(Texture const* const fontTexture, uint64_t const fontTextureKey)
+{
+    sPipelineStateDesc desc;
+    desc.m_blendMode      = eBlendMode::ALPHA;
+    desc.m_rasterizerMode = eRasterizerMode::SOLID_CULL_NONE;
+    desc.m_samplerMode    = eSamplerMode::POINT_CLAMP;
+    desc.m_depthMode      = eDepthMode::DISABLED;
+    desc.m_texture        = fontTexture;
+    desc.m_textureKey     = fontTextureKey;
+    desc.m_shader         = g_theAssetRegistry->GetShader(g_theAssetRegistry->InternShader(ASSET_SHADER_DEFAULT));
+
+    m_textState = PipelineState(desc);
+}
+
+//----------------------------------------------------------------------------------------------------
+sDebugTextHandle RetainedDebugText::Add(sDebugTextDesc const& desc)
+{
+    uint32_t index;
+
+    if (!m_freeIndices.empty())
+    {
+        index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+    }
+    else
+    {
+        index = static_cast<uint32_t>(m_texts.size());
+        m_texts.emplace_back();
+    }
+
+    sText& text        = m_texts[index];
+    text.m_desc        = desc;
+    text.m_text[0]     = '\0';
+    text.m_length      = 0;
+    text.m_lineCount   = 0;
+    text.m_longestLine = 0;
+    text.m_isAlive     = true;
+    text.m_verts.reserve(DEBUG_TEXT_MAX_LENGTH * 6);
+    text.m_verts.clear();
+
+    sDebugTextHandle handle;
+    handle.m_index      = index;
+    handle.m_generation = text.m_generation;
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The vertex buffer is kept for whichever text reuses the slot.
+//
+void RetainedDebugText::Remove(sDebugTextHandle const handle)
+{
+    sText* text = Get(handle);
+
+    if (text == nullptr)
+    {
+        return;
+    }
+
+    text->m_isAlive = false;
+    ++text->m_generation;
+    m_freeIndices.push_back(handle.m_index);
+}
+
+//----------------------------------------------------------------------------------------------------
+// One pass measures the new string and checks whether its newlines sit where the old ones did;
+// if so (and the block origin did not move) every unchanged character keeps its quad. Lines run
+// top to bottom inside the block, so line 0 sits lineCount - 1 cells above the block origin.
+//
+void RetainedDebugText::SetText(sDebugTextHandle const handle, char const* newText)
+{
+    sText* text = Get(handle);
+
+    if (text == nullptr)
+    {
+        return;
+    }
+
+    ++m_frameStats.m_updateCount;
+
+    int  newLength      = 0;
+    int  newLineCount   = 1;
+    int  newLongestLine = 0;
+    int  lineLength     = 0;
+    bool isLayoutSame   = text->m_length > 0;
+
+    for (; newLength < DEBUG_TEXT_MAX_LENGTH - 1 && newText[newLength] != '\0'; ++newLength)
+    {
+        bool const isNewline = newText[newLength] == '\n';
+
+        if (newLength < text->m_length && isNewline != (text->m_text[newLength] == '\n'))
+        {
+            isLayoutSame = false;
+        }
+
+        if (isNewline)
+        {
+            ++newLineCount;
+            lineLength = 0;
+            continue;
+        }
+
+        ++lineLength;
+
+        if (lineLength > newLongestLine) newLongestLine = lineLength;
+    }
+
+    float const cellWidth = text->m_desc.m_cellHeight * text->m_desc.m_cellAspect;
+
+    if (newLineCount != text->m_lineCount || (newLongestLine != text->m_longestLine && text->m_desc.m_alignment.x != 0.f))
+    {
+        isLayoutSame = false;
+    }
+
+    Vec2 const blockDimensions(cellWidth * static_cast<float>(newLongestLine), text->m_desc.m_cellHeight * static_cast<float>(newLineCount));
+    Vec2 const blockOrigin(text->m_desc.m_position.x - text->m_desc.m_alignment.x * blockDimensions.x,
+                           text->m_desc.m_position.y - text->m_desc.m_alignment.y * blockDimensions.y);
+
+    text->m_verts.resize(static_cast<size_t>(newLength) * 6);
+
+    int rebuiltCount = 0;
+    int lineIndex    = 0;
+    int columnIndex  = 0;
+
+    for (int charIndex = 0; charIndex < newLength; ++charIndex)
+    {
+        bool const isUnchanged = isLayoutSame && charIndex < text->m_length && newText[charIndex] == text->m_text[charIndex];
+
+        if (!isUnchanged)
+        {
+            Vec2 const glyphMins(blockOrigin.x + cellWidth * static_cast<float>(columnIndex),
+                                 blockOrigin.y + text->m_desc.m_cellHeight * static_cast<float>(newLineCount - 1 - lineIndex));
+
+            text->m_text[charIndex] = newText[charIndex];
+            BuildGlyph(*text, charIndex, glyphMins);
+            ++rebuiltCount;
+        }
+
+        if (newText[charIndex] == '\n')
+        {
+            ++lineIndex;
+            columnIndex = 0;
+        }
+        else
+        {
+            ++columnIndex;
+        }
+    }
+
+    bool const hasChanged = rebuiltCount > 0 || newLength != text->m_length;
+
+    text->m_text[newLength] = '\0';
+    text->m_length          = newLength;
+    text->m_lineCount       = newLineCount;
+    text->m_longestLine     = newLongestLine;
+
+    m_frameStats.m_glyphsRebuilt += static_cast<uint32_t>(rebuiltCount);
+    m_frameStats.m_glyphsUnchanged += static_cast<uint32_t>(newLength - rebuiltCount);
+
+    if (hasChanged)
+    {
+        text->m_mesh.Build(text->m_verts);
+        ++m_frameStats.m_uploadCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void RetainedDebugText::Format(sDebugTextHandle const handle, char const* format, ...)
+{
+    char buffer[DEBUG_TEXT_MAX_LENGTH];
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    SetText(handle, buffer);
+}
+
+//----------------------------------------------------------------------------------------------------
+void RetainedDebugText::BeginFrame()
+{
+    m_lastFrameStats = m_frameStats;
+    m_frameStats     = sRetainedDebugTextStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+void RetainedDebugText::Render() const
+{
+    for (sText const& text : m_texts)
+    {
+        if (!text.m_isAlive || text.m_length == 0)
+        {
+            continue;
+        }
+
+        g_thePipelineStateCache->SetModelConstants();
+        g_thePipelineStateCache->Bind(m_textState);
+        text.m_mesh.Draw();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+sRetainedDebugTextStats const& RetainedDebugText::GetLastFrameStats() const
+{
+    return m_lastFrameStats;
+}
+
+//----------------------------------------------------------------------------------------------------
+RetainedDebugText::sText* RetainedDebugText::Get(sDebugTextHandle const handle)
+{
+    if (!handle.IsValid() || handle.m_index >= m_texts.size())
+    {
+        return nullptr;
+    }
+
+    sText& text = m_texts[handle.m_index];
+
+    return text.m_isAlive && text.m_generation == handle.m_generation ? &text : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+// A newline keeps its slot as a degenerate quad, so character and quad indices always match.
+//
+void RetainedDebugText::BuildGlyph(sText& text, int const charIndex, Vec2 const& glyphMins) const
+{
+    Vertex_PCU* glyphVerts = &text.m_verts[static_cast<size_t>(charIndex) * 6];
+    char const  glyph      = text.m_text[charIndex];
+
+    if (glyph == '\n')
+    {
+        for (int vertIndex = 0; vertIndex < 6; ++vertIndex)
+        {
+            glyphVerts[vertIndex] = Vertex_PCU(Vec3(glyphMins.x, glyphMins.y, 0.f), Rgba8(0, 0, 0, 0));
+        }
+
+        return;
+    }
+
+    sTextMeshDesc glyphDesc;
+    glyphDesc.m_textMins   = glyphMins;
+    glyphDesc.m_cellHeight = text.m_desc.m_cellHeight;
+    glyphDesc.m_cellAspect = text.m_desc.m_cellAspect;
+    glyphDesc.m_color      = text.m_desc.m_color;
+
+    BuildTextVerts(glyphVerts, 6, glyphDesc, &glyph, 1);
+}
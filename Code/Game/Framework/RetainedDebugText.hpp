@@ -0,0 +1,103 @@
+//----------------------------------------------------------------------------------------------------
+// RetainedDebugText.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Game/Framework/PipelineState.hpp"
+#include "Game/Framework/RetainedMesh.hpp"
+
+//----------------------------------------------------------------------------------------------------
+int constexpr DEBUG_TEXT_MAX_LENGTH = 128;     // Characters per text, newlines included; longer text is cut
+
+//----------------------------------------------------------------------------------------------------
+// Generational, like sWindowHandle: a handle to a removed text stays invalid after its slot is reused.
+//
+struct sDebugTextHandle
+{
+    static uint32_t constexpr INVALID_INDEX = UINT32_MAX;
+
+    bool IsValid() const { return m_index != INVALID_INDEX; }
+
+    uint32_t m_index      = INVALID_INDEX;
+    uint32_t m_generation = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sDebugTextDesc
+{
+    Vec2  m_position;
+    Vec2  m_alignment  = Vec2::ZERO;     // Fraction of the text block placed at m_position; (0,0) is its bottom-left
+    float m_cellHeight = 20.f;
+    float m_cellAspect = 1.f;
+    Rgba8 m_color      = Rgba8::WHITE;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sRetainedDebugTextStats
+{
+    uint32_t m_updateCount     = 0;     // SetText / Format calls
+    uint32_t m_glyphsRebuilt   = 0;
+    uint32_t m_glyphsUnchanged = 0;
+    uint32_t m_uploadCount     = 0;     // Texts whose vertices were re-uploaded
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Screen text that lives until it is removed, for values shown every frame (clocks, counters).
+/// The caller adds a text once, keeps the handle, and updates the string in place; each character
+/// owns a fixed quad slot in the text's vertex array, so an update compares the new string with the
+/// old one and regenerates only the quads of characters that changed. The whole layout is redone
+/// only when the line structure (or, for non-left alignment, the block size) changes.
+/// Vertices are uploaded into a RetainedMesh only when something changed. Format prints into a
+/// stack buffer, so a steady-state update allocates nothing.
+class RetainedDebugText
+{
+public:
+    RetainedDebugText(Texture const* fontTexture, uint64_t fontTextureKey);     // The glyph sheet BitmapFont would sample
+
+    sDebugTextHandle Add(sDebugTextDesc const& desc);
+    void             Remove(sDebugTextHandle handle);
+
+    void SetText(sDebugTextHandle handle, char const* text);
+    void Format(sDebugTextHandle handle, char const* format, ...);
+
+    void BeginFrame();
+    void Render() const;     // Draws every text into the current camera
+
+    sRetainedDebugTextStats const& GetLastFrameStats() const;
+
+private:
+    struct sText
+    {
+        sDebugTextDesc          m_desc;
+        char                    m_text[DEBUG_TEXT_MAX_LENGTH] = {};
+        int                     m_length      = 0;
+        int                     m_lineCount   = 0;
+        int                     m_longestLine = 0;
+        std::vector<Vertex_PCU> m_verts;      // 6 per character, indexed by character
+        RetainedMesh            m_mesh;
+        uint32_t                m_generation  = 0;
+        bool                    m_isAlive     = false;
+    };
+
+    sText* Get(sDebugTextHandle handle);
+    void   BuildGlyph(sText& text, int charIndex, Vec2 const& glyphMins) const;
+
+    std::deque<sText>     m_texts;     // Deque: RetainedMesh cannot move
+    std::vector<uint32_t> m_freeIndices;
+    PipelineState         m_textState;
+
+    sRetainedDebugTextStats m_frameStats;
+    sRetainedDebugTextStats m_lastFrameStats;
+};
+
+//----------------------------------------------------------------------------------------------------
+extern RetainedDebugText* g_theRetainedDebugText;
@@ -0,0 +1,87 @@
+//----------------------------------------------------------------------------------------------------
+// RetainedMesh.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/RetainedMesh.hpp"
+
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Renderer/VertexBuffer.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/RenderDevice.hpp"
+
+//----------------------------------------------------------------------------------------------------
+RetainedMesh::~RetainedMesh()
+{
+    Release();
+}
+
+//----------------------------------------------------------------------------------------------------
+void RetainedMesh::Build(std::vector<Vertex_PCU> const& verts)
+{
+    if (!g_theRenderDevice->HasVertexBuffers())
+    {
+        m_cpuVerts    = verts;
+        m_vertexCount = static_cast<unsigned int>(verts.size());
+        m_isCPUBuilt  = true;
+        return;
+    }
+
+    unsigned int const sizeBytes = static_cast<unsigned int>(verts.size() * sizeof(Vertex_PCU));
+
+    if (sizeBytes > m_capacityBytes)
+    {
+        Release();
+
+        m_vertexBuffer  = g_theRenderer->CreateVertexBuffer(sizeBytes, sizeof(Vertex_PCU));
+        m_capacityBytes = sizeBytes;
+    }
+
+    m_vertexCount = static_cast<unsigned int>(verts.size());
+
+    if (m_vertexCount > 0)
+    {
+        g_theRenderer->CopyCPUToGPU(verts.data(), sizeBytes, m_vertexBuffer);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void RetainedMesh::Release()
+{
+    GAME_SAFE_RELEASE(m_vertexBuffer);
+    m_cpuVerts.clear();
+
+    m_vertexCount   = 0;
+    m_capacityBytes = 0;
+    m_isCPUBuilt    = false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void RetainedMesh::Draw() const
+{
+    if (m_vertexCount == 0)
+    {
+        return;
+    }
+
+    if (m_isCPUBuilt)
+    {
+        g_theRenderDevice->DrawVertexArray(static_cast<int>(m_vertexCount), m_cpuVerts.data());
+        return;
+    }
+
+    g_theRenderDevice->DrawVertexBuffer(m_vertexBuffer, m_vertexCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool RetainedMesh::IsBuilt() const
+{
+    return m_vertexBuffer != nullptr || m_isCPUBuilt;
+}
+
+//----------------------------------------------------------------------------------------------------
+unsigned int RetainedMesh::GetVertexCount() const
+{
+    return m_vertexCount;
+}
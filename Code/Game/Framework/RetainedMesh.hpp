@@ -0,0 +1,42 @@
+//----------------------------------------------------------------------------------------------------
+// RetainedMesh.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <vector>
+
+#include "Engine/Core/Vertex_PCU.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class VertexBuffer;
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Vertices generated and uploaded to the GPU once, then drawn from the same VertexBuffer every frame.
+/// Movement belongs in the model constants set before Draw(); only a change to the geometry itself
+/// (e.g. the screen size it was built for) should call Build() again. Build() reuses the existing
+/// buffer when the new vertices fit in it. A RenderDevice without vertex buffers (the software
+/// rasterizer) keeps a CPU copy instead and draws it as an array.
+class RetainedMesh
+{
+public:
+    RetainedMesh() = default;
+    ~RetainedMesh();
+    RetainedMesh(RetainedMesh const&)            = delete;
+    RetainedMesh& operator=(RetainedMesh const&) = delete;
+
+    void Build(std::vector<Vertex_PCU> const& verts);
+    void Release();
+    void Draw() const;
+
+    bool         IsBuilt() const;
+    unsigned int GetVertexCount() const;
+
+private:
+    VertexBuffer*           m_vertexBuffer  = nullptr;
+    std::vector<Vertex_PCU> m_cpuVerts;     // Only when the RenderDevice has no vertex buffers
+    unsigned int            m_vertexCount   = 0;
+    unsigned int            m_capacityBytes = 0;
+    bool                    m_isCPUBuilt    = false;
+};
@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------------------------------
+// SPSCQueue.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Bounded lock-free ring for exactly one producer thread and one consumer thread.
+/// The producer only writes m_tail and the consumer only writes m_head; each side caches the other's
+/// index and re-reads it only when the ring looks full (or empty), so the shared cache lines are
+/// touched rarely. Capacity must be a power of two; one slot is never left unused.
+template <typename T, uint32_t Capacity>
+class SPSCQueue
+{
+    static_assert((Capacity & (Capacity - 1)) == 0, "SPSCQueue capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "SPSCQueue elements are copied with plain stores");
+
+public:
+    //------------------------------------------------------------------------------------------------
+    // Producer thread only.
+    //
+    bool TryPush(T const& item)
+    {
+        uint32_t const tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail - m_producerCachedHead == Capacity)
+        {
+            m_producerCachedHead = m_head.load(std::memory_order_acquire);
+
+            if (tail - m_producerCachedHead == Capacity)
+            {
+                return false;
+            }
+        }
+
+        m_items[tail & (Capacity - 1)] = item;
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Consumer thread only.
+    //
+    bool TryPop(T& outItem)
+    {
+        uint32_t const head = m_head.load(std::memory_order_relaxed);
+
+        if (head == m_consumerCachedTail)
+        {
+            m_consumerCachedTail = m_tail.load(std::memory_order_acquire);
+
+            if (head == m_consumerCachedTail)
+            {
+                return false;
+            }
+        }
+
+        outItem = m_items[head & (Capacity - 1)];
+        m_head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Either thread; exact only when the other side is idle.
+    //
+    uint32_t GetApproximateSize() const
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+
+    static uint32_t constexpr GetCapacity() { return Capacity; }
+
+private:
+    static size_t constexpr CACHE_LINE_SIZE = 64;
+
+    // Explicit padding rather than alignas: each side's index still gets a cache line to itself, and
+    // neither this queue nor any class holding one becomes over-aligned (MSVC C4324 at /W4).
+    std::atomic<uint32_t> m_head{0};
+    uint32_t              m_consumerCachedTail = 0;
+    char                  m_consumerPadding[CACHE_LINE_SIZE - sizeof(std::atomic<uint32_t>) - sizeof(uint32_t)];
+
+    std::atomic<uint32_t> m_tail{0};
+    uint32_t              m_producerCachedHead = 0;
+    char                  m_producerPadding[CACHE_LINE_SIZE - sizeof(std::atomic<uint32_t>) - sizeof(uint32_t)];
+
+    T m_items[Capacity];
+};
@@ -0,0 +1,40 @@
+//----------------------------------------------------------------------------------------------------
+// ShaderCache.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ShaderCache.hpp"
+
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+ShaderCache* g_theShaderCache = nullptr;     // Created and owned by the App
+
+//----------------------------------------------------------------------------------------------------
+Shader* ShaderCache::CreateOrGetShader(char const* shaderPath)
+{
+    auto const found = m_shaders.find(shaderPath);
+
+    if (found != m_shaders.end())
+    {
+        ++m_stats.m_reuseCount;
+        return found->second;
+    }
+
+    double const  startSeconds = GetSchedulerTimeSeconds();
+    Shader* const shader       = g_theRenderer->CreateOrGetShaderFromFile(shaderPath);
+
+    ++m_stats.m_createCount;
+    m_stats.m_createSeconds += GetSchedulerTimeSeconds() - startSeconds;
+    m_shaders[shaderPath]    = shader;
+
+    return shader;
+}
+
+//----------------------------------------------------------------------------------------------------
+sShaderCacheStats const& ShaderCache::GetStats() const
+{
+    return m_stats;
+}
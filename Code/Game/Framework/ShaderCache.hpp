@@ -0,0 +1,42 @@
+//----------------------------------------------------------------------------------------------------
+// ShaderCache.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <string>
+#include <unordered_map>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Shader;
+
+//----------------------------------------------------------------------------------------------------
+struct sShaderCacheStats
+{
+    int    m_reuseCount    = 0;       // Already created this run; the Renderer is not asked again
+    int    m_createCount   = 0;
+    double m_createSeconds = 0.0;     // Time spent in Renderer::CreateOrGetShaderFromFile, creations only
+
+    float GetReuseRate() const { return m_reuseCount + m_createCount > 0 ? static_cast<float>(m_reuseCount) / static_cast<float>(m_reuseCount + m_createCount) : 0.f; }
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Creates each shader once per run through Renderer::CreateOrGetShaderFromFile and hands the same
+/// Shader back on every later request, timing the creations so startup shader cost is visible.
+/// The Engine compiles HLSL from source and exposes no way to create a Shader from bytecode, so
+/// nothing is persisted between runs.
+class ShaderCache
+{
+public:
+    Shader* CreateOrGetShader(char const* shaderPath);     // Path without extension, as for the Renderer
+
+    sShaderCacheStats const& GetStats() const;
+
+private:
+    sShaderCacheStats                        m_stats;
+    std::unordered_map<std::string, Shader*> m_shaders;     // Path -> Shader; the Renderer owns them
+};
+
+//----------------------------------------------------------------------------------------------------
+extern ShaderCache* g_theShaderCache;
@@ -0,0 +1,834 @@
+//----------------------------------------------------------------------------------------------------
+// ShapeTessellation.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ShapeTessellation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define SHAPE_TESSELLATION_SSE
+#endif
+
+//----------------------------------------------------------------------------------------------------
+// Compile-time sine and cosine for the tables: Taylor series in double precision, for angles already
+// reduced to [-pi, pi], where 12 terms are accurate far beyond float precision.
+//
+double constexpr TABLE_PI = 3.14159265358979323846;
+
+constexpr double ConstexprSin(double const radians)
+{
+    double const radiansSquared = radians * radians;
+    double       term           = radians;
+    double       sum            = radians;
+
+    for (int termIndex = 1; termIndex < 12; ++termIndex)
+    {
+        term *= -radiansSquared / static_cast<double>((2 * termIndex) * (2 * termIndex + 1));
+        sum += term;
+    }
+
+    return sum;
+}
+
+constexpr double ConstexprCos(double const radians)
+{
+    double const radiansSquared = radians * radians;
+    double       term           = 1.0;
+    double       sum            = 1.0;
+
+    for (int termIndex = 1; termIndex < 12; ++termIndex)
+    {
+        term *= -radiansSquared / static_cast<double>((2 * termIndex - 1) * (2 * termIndex));
+        sum += term;
+    }
+
+    return sum;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <int SEGMENT_COUNT>
+struct sUnitCircleTable
+{
+    static int constexpr ENTRY_COUNT = SEGMENT_COUNT + 4;     // Wrapped entries, see sUnitCircle
+
+    float m_cos[ENTRY_COUNT] = {};
+    float m_sin[ENTRY_COUNT] = {};
+};
+
+template <int SEGMENT_COUNT>
+constexpr sUnitCircleTable<SEGMENT_COUNT> MakeUnitCircleTable()
+{
+    sUnitCircleTable<SEGMENT_COUNT> table;
+
+    for (int entryIndex = 0; entryIndex < sUnitCircleTable<SEGMENT_COUNT>::ENTRY_COUNT; ++entryIndex)
+    {
+        int const segmentIndex = entryIndex % SEGMENT_COUNT;
+        double    radians      = 2.0 * TABLE_PI * static_cast<double>(segmentIndex) / static_cast<double>(SEGMENT_COUNT);
+
+        if (radians > TABLE_PI)
+        {
+            radians -= 2.0 * TABLE_PI;
+        }
+
+        table.m_cos[entryIndex] = static_cast<float>(ConstexprCos(radians));
+        table.m_sin[entryIndex] = static_cast<float>(ConstexprSin(radians));
+    }
+
+    return table;
+}
+
+static constexpr sUnitCircleTable<4>   UNIT_CIRCLE_4   = MakeUnitCircleTable<4>();
+static constexpr sUnitCircleTable<8>   UNIT_CIRCLE_8   = MakeUnitCircleTable<8>();
+static constexpr sUnitCircleTable<16>  UNIT_CIRCLE_16  = MakeUnitCircleTable<16>();
+static constexpr sUnitCircleTable<32>  UNIT_CIRCLE_32  = MakeUnitCircleTable<32>();
+static constexpr sUnitCircleTable<64>  UNIT_CIRCLE_64  = MakeUnitCircleTable<64>();
+static constexpr sUnitCircleTable<128> UNIT_CIRCLE_128 = MakeUnitCircleTable<128>();
+static constexpr sUnitCircleTable<256> UNIT_CIRCLE_256 = MakeUnitCircleTable<256>();
+
+static_assert(UNIT_CIRCLE_4.m_cos[0] == 1.f && UNIT_CIRCLE_4.m_sin[1] == 1.f && UNIT_CIRCLE_4.m_cos[2] == -1.f, "Unit circle tables are off");
+static_assert((SHAPE_MIN_SEGMENT_COUNT << (SHAPE_LOD_BUCKET_COUNT - 1)) == SHAPE_MAX_SEGMENT_COUNT, "One LOD bucket per table");
+static_assert(UNIT_CIRCLE_32.m_cos[32] == UNIT_CIRCLE_32.m_cos[0] && UNIT_CIRCLE_32.m_sin[33] == UNIT_CIRCLE_32.m_sin[1], "Unit circle tables must wrap");
+
+//----------------------------------------------------------------------------------------------------
+int GetSupportedSegmentCount(int const segmentCount)
+{
+    int supportedCount = SHAPE_MIN_SEGMENT_COUNT;
+
+    while (supportedCount < segmentCount && supportedCount < SHAPE_MAX_SEGMENT_COUNT)
+    {
+        supportedCount *= 2;
+    }
+
+    return supportedCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Solved through the half-angle form, 1 - cos(a) = 2 * sin(a / 2)^2, which stays accurate for large
+// radii where 1 - maxChordError / projectedRadius rounds to 1 in float.
+//
+int GetSegmentCountForProjectedRadius(float const projectedRadius, float const maxChordError)
+{
+    if (maxChordError <= 0.f)
+    {
+        return SHAPE_MAX_SEGMENT_COUNT;
+    }
+
+    if (projectedRadius <= maxChordError)
+    {
+        return SHAPE_MIN_SEGMENT_COUNT;
+    }
+
+    float const halfSegmentRadians = 2.f * asinf(sqrtf(0.5f * maxChordError / projectedRadius));
+    float const segmentCount       = static_cast<float>(TABLE_PI) / halfSegmentRadians;
+
+    if (segmentCount >= static_cast<float>(SHAPE_MAX_SEGMENT_COUNT))
+    {
+        return SHAPE_MAX_SEGMENT_COUNT;
+    }
+
+    return GetSupportedSegmentCount(static_cast<int>(ceilf(segmentCount)));
+}
+
+//----------------------------------------------------------------------------------------------------
+int GetShapeLODBucket(int const segmentCount)
+{
+    int lodBucket = 0;
+
+    for (int bucketSegmentCount = SHAPE_MIN_SEGMENT_COUNT; bucketSegmentCount < GetSupportedSegmentCount(segmentCount); bucketSegmentCount *= 2)
+    {
+        ++lodBucket;
+    }
+
+    return lodBucket;
+}
+
+//----------------------------------------------------------------------------------------------------
+int GetShapeLODBucketSegmentCount(int const lodBucket)
+{
+    return SHAPE_MIN_SEGMENT_COUNT << std::min(std::max(lodBucket, 0), SHAPE_LOD_BUCKET_COUNT - 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+sUnitCircle GetUnitCircle(int const segmentCount)
+{
+    sUnitCircle circle;
+    circle.m_segmentCount = GetSupportedSegmentCount(segmentCount);
+
+    switch (circle.m_segmentCount)
+    {
+    case 4:   circle.m_cos = UNIT_CIRCLE_4.m_cos;   circle.m_sin = UNIT_CIRCLE_4.m_sin;   break;
+    case 8:   circle.m_cos = UNIT_CIRCLE_8.m_cos;   circle.m_sin = UNIT_CIRCLE_8.m_sin;   break;
+    case 16:  circle.m_cos = UNIT_CIRCLE_16.m_cos;  circle.m_sin = UNIT_CIRCLE_16.m_sin;  break;
+    case 32:  circle.m_cos = UNIT_CIRCLE_32.m_cos;  circle.m_sin = UNIT_CIRCLE_32.m_sin;  break;
+    case 64:  circle.m_cos = UNIT_CIRCLE_64.m_cos;  circle.m_sin = UNIT_CIRCLE_64.m_sin;  break;
+    case 128: circle.m_cos = UNIT_CIRCLE_128.m_cos; circle.m_sin = UNIT_CIRCLE_128.m_sin; break;
+    default:  circle.m_cos = UNIT_CIRCLE_256.m_cos; circle.m_sin = UNIT_CIRCLE_256.m_sin; break;
+    }
+
+    return circle;
+}
+
+//----------------------------------------------------------------------------------------------------
+int GetDiscVertCount(int const segmentCount)
+{
+    return 3 * GetSupportedSegmentCount(segmentCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+int GetRingVertCount(int const segmentCount)
+{
+    return 6 * GetSupportedSegmentCount(segmentCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+int GetBoxRingVertCount()
+{
+    return 24;
+}
+
+//----------------------------------------------------------------------------------------------------
+int GetLineVertCount()
+{
+    return 6;
+}
+
+//----------------------------------------------------------------------------------------------------
+static void WriteVertex(Vertex_PCU& vert, float const x, float const y, Rgba8 const& color)
+{
+    vert = Vertex_PCU(Vec3(x, y, 0.f), color, Vec2(0.f, 0.f));
+}
+
+//----------------------------------------------------------------------------------------------------
+// Scalar segment loops, shared by the Scalar variants and the SIMD kernels' remainder. Each product
+// and sum is done in the same order as the SIMD lanes, so both paths write identical vertices.
+//
+static void EmitFanSegments(Vertex_PCU* verts, sUnitCircle const& circle, int const beginSegment, Vec2 const& center, float const radius,
+                            Rgba8 const& centerColor, Rgba8 const& rimColor)
+{
+    for (int segmentIndex = beginSegment; segmentIndex < circle.m_segmentCount; ++segmentIndex)
+    {
+        Vertex_PCU* segmentVerts = verts + 3 * segmentIndex;
+
+        WriteVertex(segmentVerts[0], center.x, center.y, centerColor);
+        WriteVertex(segmentVerts[1], center.x + radius * circle.m_cos[segmentIndex], center.y + radius * circle.m_sin[segmentIndex], rimColor);
+        WriteVertex(segmentVerts[2], center.x + radius * circle.m_cos[segmentIndex + 1], center.y + radius * circle.m_sin[segmentIndex + 1], rimColor);
+    }
+}
+
+static void EmitRingSegments(Vertex_PCU* verts, sUnitCircle const& circle, int const beginSegment, Vec2 const& center, float const innerRadius,
+                             float const outerRadius, Rgba8 const& color)
+{
+    for (int segmentIndex = beginSegment; segmentIndex < circle.m_segmentCount; ++segmentIndex)
+    {
+        float const cosStart = circle.m_cos[segmentIndex];
+        float const sinStart = circle.m_sin[segmentIndex];
+        float const cosEnd   = circle.m_cos[segmentIndex + 1];
+        float const sinEnd   = circle.m_sin[segmentIndex + 1];
+
+        float const innerStartX = center.x + innerRadius * cosStart;
+        float const innerStartY = center.y + innerRadius * sinStart;
+        float const outerStartX = center.x + outerRadius * cosStart;
+        float const outerStartY = center.y + outerRadius * sinStart;
+        float const innerEndX   = center.x + innerRadius * cosEnd;
+        float const innerEndY   = center.y + innerRadius * sinEnd;
+        float const outerEndX   = center.x + outerRadius * cosEnd;
+        float const outerEndY   = center.y + outerRadius * sinEnd;
+
+        Vertex_PCU* segmentVerts = verts + 6 * segmentIndex;
+
+        WriteVertex(segmentVerts[0], innerStartX, innerStartY, color);
+        WriteVertex(segmentVerts[1], outerStartX, outerStartY, color);
+        WriteVertex(segmentVerts[2], outerEndX, outerEndY, color);
+        WriteVertex(segmentVerts[3], innerStartX, innerStartY, color);
+        WriteVertex(segmentVerts[4], outerEndX, outerEndY, color);
+        WriteVertex(segmentVerts[5], innerEndX, innerEndY, color);
+    }
+}
+
+#if defined(SHAPE_TESSELLATION_SSE)
+//----------------------------------------------------------------------------------------------------
+// Vertices go out in pairs: 48 contiguous bytes as three 16-byte stores, (xA, yA, 0, colorA),
+// (0, 0, xB, yB) and (0, colorB, 0, 0), zero UVs included. The emission loops are bound by stores,
+// and this is one store per two vertices fewer than a 16-byte plus 8-byte store for each.
+//
+static_assert(sizeof(Vertex_PCU) == 24 && offsetof(Vertex_PCU, m_uvTexCoords) == 16, "StoreVertexPairSSE assumes Vertex_PCU is position, color, UV");
+
+static void StoreVertexPairSSE(Vertex_PCU* verts, __m128 const headA, __m128 const headB)
+{
+    float* const destination = reinterpret_cast<float*>(verts);
+    __m128 const zero        = _mm_setzero_ps();
+
+    _mm_storeu_ps(destination + 0, headA);
+    _mm_storeu_ps(destination + 4, _mm_movelh_ps(zero, headB));
+    _mm_storeu_ps(destination + 8, _mm_movehl_ps(zero, headB));
+}
+
+//----------------------------------------------------------------------------------------------------
+static __m128 MakeColorSSE(Rgba8 const& color)
+{
+    int32_t colorBits;
+    memcpy(&colorBits, &color, sizeof(colorBits));
+
+    return _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, colorBits));
+}
+
+//----------------------------------------------------------------------------------------------------
+// Turns four lanes of x and y into four (x, y, 0, color) vertex heads.
+//
+static void SplitLanesSSE(__m128 const x, __m128 const y, __m128 const color4, __m128 out_heads[4])
+{
+    __m128 const zero = _mm_setzero_ps();
+    __m128 const xy01 = _mm_unpacklo_ps(x, y);
+    __m128 const xy23 = _mm_unpackhi_ps(x, y);
+
+    out_heads[0] = _mm_or_ps(_mm_movelh_ps(xy01, zero), color4);
+    out_heads[1] = _mm_or_ps(_mm_movehl_ps(zero, xy01), color4);
+    out_heads[2] = _mm_or_ps(_mm_movelh_ps(xy23, zero), color4);
+    out_heads[3] = _mm_or_ps(_mm_movehl_ps(zero, xy23), color4);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Four segments per iteration; returns the first segment left for the scalar loop.
+//
+static int EmitFanSegmentsSSE(Vertex_PCU* verts, sUnitCircle const& circle, Vec2 const& center, float const radius,
+                              Rgba8 const& centerColor, Rgba8 const& rimColor)
+{
+    __m128 const centerX4  = _mm_set1_ps(center.x);
+    __m128 const centerY4  = _mm_set1_ps(center.y);
+    __m128 const radius4   = _mm_set1_ps(radius);
+    __m128 const rimColor4 = MakeColorSSE(rimColor);
+    __m128 const centerHead = _mm_or_ps(_mm_setr_ps(center.x, center.y, 0.f, 0.f), MakeColorSSE(centerColor));
+
+    int segmentIndex = 0;
+
+    for (; segmentIndex + 4 <= circle.m_segmentCount; segmentIndex += 4)
+    {
+        __m128 const startX = _mm_add_ps(centerX4, _mm_mul_ps(radius4, _mm_loadu_ps(circle.m_cos + segmentIndex)));
+        __m128 const startY = _mm_add_ps(centerY4, _mm_mul_ps(radius4, _mm_loadu_ps(circle.m_sin + segmentIndex)));
+        __m128 const endX   = _mm_add_ps(centerX4, _mm_mul_ps(radius4, _mm_loadu_ps(circle.m_cos + segmentIndex + 1)));
+        __m128 const endY   = _mm_add_ps(centerY4, _mm_mul_ps(radius4, _mm_loadu_ps(circle.m_sin + segmentIndex + 1)));
+
+        __m128 starts[4];
+        __m128 ends[4];
+        SplitLanesSSE(startX, startY, rimColor4, starts);
+        SplitLanesSSE(endX, endY, rimColor4, ends);
+
+        // Three vertices per segment, so the four segments pair up across segment boundaries.
+        Vertex_PCU* segmentVerts = verts + 3 * segmentIndex;
+
+        StoreVertexPairSSE(segmentVerts + 0, centerHead, starts[0]);
+        StoreVertexPairSSE(segmentVerts + 2, ends[0], centerHead);
+        StoreVertexPairSSE(segmentVerts + 4, starts[1], ends[1]);
+        StoreVertexPairSSE(segmentVerts + 6, centerHead, starts[2]);
+        StoreVertexPairSSE(segmentVerts + 8, ends[2], centerHead);
+        StoreVertexPairSSE(segmentVerts + 10, starts[3], ends[3]);
+    }
+
+    return segmentIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int EmitRingSegmentsSSE(Vertex_PCU* verts, sUnitCircle const& circle, Vec2 const& center, float const innerRadius,
+                               float const outerRadius, Rgba8 const& color)
+{
+    __m128 const centerX4     = _mm_set1_ps(center.x);
+    __m128 const centerY4     = _mm_set1_ps(center.y);
+    __m128 const innerRadius4 = _mm_set1_ps(innerRadius);
+    __m128 const outerRadius4 = _mm_set1_ps(outerRadius);
+    __m128 const color4       = MakeColorSSE(color);
+
+    int segmentIndex = 0;
+
+    for (; segmentIndex + 4 <= circle.m_segmentCount; segmentIndex += 4)
+    {
+        __m128 const cosStart = _mm_loadu_ps(circle.m_cos + segmentIndex);
+        __m128 const sinStart = _mm_loadu_ps(circle.m_sin + segmentIndex);
+        __m128 const cosEnd   = _mm_loadu_ps(circle.m_cos + segmentIndex + 1);
+        __m128 const sinEnd   = _mm_loadu_ps(circle.m_sin + segmentIndex + 1);
+
+        __m128 innerStarts[4];
+        __m128 outerStarts[4];
+        __m128 innerEnds[4];
+        __m128 outerEnds[4];
+        SplitLanesSSE(_mm_add_ps(centerX4, _mm_mul_ps(innerRadius4, cosStart)), _mm_add_ps(centerY4, _mm_mul_ps(innerRadius4, sinStart)), color4, innerStarts);
+        SplitLanesSSE(_mm_add_ps(centerX4, _mm_mul_ps(outerRadius4, cosStart)), _mm_add_ps(centerY4, _mm_mul_ps(outerRadius4, sinStart)), color4, outerStarts);
+        SplitLanesSSE(_mm_add_ps(centerX4, _mm_mul_ps(innerRadius4, cosEnd)), _mm_add_ps(centerY4, _mm_mul_ps(innerRadius4, sinEnd)), color4, innerEnds);
+        SplitLanesSSE(_mm_add_ps(centerX4, _mm_mul_ps(outerRadius4, cosEnd)), _mm_add_ps(centerY4, _mm_mul_ps(outerRadius4, sinEnd)), color4, outerEnds);
+
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            Vertex_PCU* segmentVerts = verts + 6 * (segmentIndex + lane);
+
+            StoreVertexPairSSE(segmentVerts + 0, innerStarts[lane], outerStarts[lane]);
+            StoreVertexPairSSE(segmentVerts + 2, outerEnds[lane], innerStarts[lane]);
+            StoreVertexPairSSE(segmentVerts + 4, outerEnds[lane], innerEnds[lane]);
+        }
+    }
+
+    return segmentIndex;
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------
+static Rgba8 GetGlowRimColor(sGlowCircleShape const& shape)
+{
+    Rgba8 rimColor = shape.m_color;
+    rimColor.a     = static_cast<unsigned char>(shape.m_glowIntensity * 255);
+
+    return rimColor;
+}
+
+//----------------------------------------------------------------------------------------------------
+// One shape at a time; isSIMD only changes how the segments of each shape are emitted.
+//
+static int TessellateFans(Vertex_PCU* outVerts, int const maxVertCount, Vec2 const& center, float const radius, Rgba8 const& centerColor,
+                          Rgba8 const& rimColor, int const segmentCount, int const vertCount, bool const isSIMD)
+{
+    sUnitCircle const circle          = GetUnitCircle(segmentCount);
+    int const         shapeVertCount  = 3 * circle.m_segmentCount;
+
+    if (vertCount + shapeVertCount > maxVertCount)
+    {
+        return -1;
+    }
+
+    int beginSegment = 0;
+
+#if defined(SHAPE_TESSELLATION_SSE)
+    if (isSIMD)
+    {
+        beginSegment = EmitFanSegmentsSSE(outVerts + vertCount, circle, center, radius, centerColor, rimColor);
+    }
+#else
+    UNUSED(isSIMD)
+#endif
+
+    EmitFanSegments(outVerts + vertCount, circle, beginSegment, center, radius, centerColor, rimColor);
+
+    return vertCount + shapeVertCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int TessellateDiscsWithKernel(Vertex_PCU* outVerts, int const maxVertCount, sDiscShape const* shapes, int const shapeCount, bool const isSIMD)
+{
+    int vertCount = 0;
+
+    for (int shapeIndex = 0; shapeIndex < shapeCount; ++shapeIndex)
+    {
+        sDiscShape const& shape        = shapes[shapeIndex];
+        int const         newVertCount = TessellateFans(outVerts, maxVertCount, shape.m_center, shape.m_radius, shape.m_color, shape.m_color, shape.m_segmentCount, vertCount, isSIMD);
+
+        if (newVertCount < 0)
+        {
+            break;
+        }
+
+        vertCount = newVertCount;
+    }
+
+    return vertCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int TessellateGlowCirclesWithKernel(Vertex_PCU* outVerts, int const maxVertCount, sGlowCircleShape const* shapes, int const shapeCount, bool const isSIMD)
+{
+    int vertCount = 0;
+
+    for (int shapeIndex = 0; shapeIndex < shapeCount; ++shapeIndex)
+    {
+        sGlowCircleShape const& shape        = shapes[shapeIndex];
+        int const               newVertCount = TessellateFans(outVerts, maxVertCount, shape.m_center, shape.m_radius, shape.m_color, GetGlowRimColor(shape), shape.m_segmentCount, vertCount, isSIMD);
+
+        if (newVertCount < 0)
+        {
+            break;
+        }
+
+        vertCount = newVertCount;
+    }
+
+    return vertCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int TessellateRingsWithKernel(Vertex_PCU* outVerts, int const maxVertCount, sRingShape const* shapes, int const shapeCount, bool const isSIMD)
+{
+    int vertCount = 0;
+
+    for (int shapeIndex = 0; shapeIndex < shapeCount; ++shapeIndex)
+    {
+        sRingShape const& shape          = shapes[shapeIndex];
+        sUnitCircle const circle         = GetUnitCircle(shape.m_segmentCount);
+        int const         shapeVertCount = 6 * circle.m_segmentCount;
+
+        if (vertCount + shapeVertCount > maxVertCount)
+        {
+            break;
+        }
+
+        float const innerRadius  = shape.m_radius - 0.5f * shape.m_thickness;
+        float const outerRadius  = shape.m_radius + 0.5f * shape.m_thickness;
+        int         beginSegment = 0;
+
+#if defined(SHAPE_TESSELLATION_SSE)
+        if (isSIMD)
+        {
+            beginSegment = EmitRingSegmentsSSE(outVerts + vertCount, circle, shape.m_center, innerRadius, outerRadius, shape.m_color);
+        }
+#else
+        UNUSED(isSIMD)
+#endif
+
+        EmitRingSegments(outVerts + vertCount, circle, beginSegment, shape.m_center, innerRadius, outerRadius, shape.m_color);
+        vertCount += shapeVertCount;
+    }
+
+    return vertCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+int TessellateDiscs(Vertex_PCU* outVerts, int const maxVertCount, sDiscShape const* shapes, int const shapeCount)
+{
+    return TessellateDiscsWithKernel(outVerts, maxVertCount, shapes, shapeCount, true);
+}
+
+//----------------------------------------------------------------------------------------------------
+int TessellateGlowCircles(Vertex_PCU* outVerts, int const maxVertCount, sGlowCircleShape const* shapes, int const shapeCount)
+{
+    return TessellateGlowCirclesWithKernel(outVerts, maxVertCount, shapes, shapeCount, true);
+}
+
+//----------------------------------------------------------------------------------------------------
+int TessellateRings(Vertex_PCU* outVerts, int const maxVertCount, sRingShape const* shapes, int const shapeCount)
+{
+    return TessellateRingsWithKernel(outVerts, maxVertCount, shapes, shapeCount, true);
+}
+
+//----------------------------------------------------------------------------------------------------
+int TessellateDiscsScalar(Vertex_PCU* outVerts, int const maxVertCount, sDiscShape const* shapes, int const shapeCount)
+{
+    return TessellateDiscsWithKernel(outVerts, maxVertCount, shapes, shapeCount, false);
+}
+
+//----------------------------------------------------------------------------------------------------
+int TessellateGlowCirclesScalar(Vertex_PCU* outVerts, int const maxVertCount, sGlowCircleShape const* shapes, int const shapeCount)
+{
+    return TessellateGlowCirclesWithKernel(outVerts, maxVertCount, shapes, shapeCount, false);
+}
+
+//----------------------------------------------------------------------------------------------------
+int TessellateRingsScalar(Vertex_PCU* outVerts, int const maxVertCount, sRingShape const* shapes, int const shapeCount)
+{
+    return TessellateRingsWithKernel(outVerts, maxVertCount, shapes, shapeCount, false);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Each side of the box is a quad between the inner and outer squares.
+//
+int TessellateBoxRings(Vertex_PCU* outVerts, int const maxVertCount, sBoxRingShape const* shapes, int const shapeCount)
+{
+    int vertCount = 0;
+
+    for (int shapeIndex = 0; shapeIndex < shapeCount && vertCount + 24 <= maxVertCount; ++shapeIndex)
+    {
+        sBoxRingShape const& shape       = shapes[shapeIndex];
+        float const          innerRadius = shape.m_radius - 0.5f * shape.m_thickness;
+        float const          outerRadius = shape.m_radius + 0.5f * shape.m_thickness;
+
+        float const innerMinX = shape.m_center.x - innerRadius;
+        float const innerMinY = shape.m_center.y - innerRadius;
+        float const innerMaxX = shape.m_center.x + innerRadius;
+        float const innerMaxY = shape.m_center.y + innerRadius;
+        float const outerMinX = shape.m_center.x - outerRadius;
+        float const outerMinY = shape.m_center.y - outerRadius;
+        float const outerMaxX = shape.m_center.x + outerRadius;
+        float const outerMaxY = shape.m_center.y + outerRadius;
+
+        Vertex_PCU*  verts = outVerts + vertCount;
+        Rgba8 const& color = shape.m_color;
+
+        // Bottom
+        WriteVertex(verts[0], outerMinX, outerMinY, color);
+        WriteVertex(verts[1], innerMinX, innerMinY, color);
+        WriteVertex(verts[2], innerMaxX, innerMinY, color);
+        WriteVertex(verts[3], outerMinX, outerMinY, color);
+        WriteVertex(verts[4], innerMaxX, innerMinY, color);
+        WriteVertex(verts[5], outerMaxX, outerMinY, color);
+
+        // Top
+        WriteVertex(verts[6], outerMinX, outerMaxY, color);
+        WriteVertex(verts[7], innerMaxX, innerMaxY, color);
+        WriteVertex(verts[8], innerMinX, innerMaxY, color);
+        WriteVertex(verts[9], outerMinX, outerMaxY, color);
+        WriteVertex(verts[10], innerMaxX, innerMaxY, color);
+        WriteVertex(verts[11], outerMaxX, outerMaxY, color);
+
+        // Left
+        WriteVertex(verts[12], outerMinX, outerMinY, color);
+        WriteVertex(verts[13], innerMinX, innerMinY, color);
+        WriteVertex(verts[14], innerMinX, innerMaxY, color);
+        WriteVertex(verts[15], outerMinX, outerMinY, color);
+        WriteVertex(verts[16], innerMinX, innerMaxY, color);
+        WriteVertex(verts[17], outerMinX, outerMaxY, color);
+
+        // Right
+        WriteVertex(verts[18], outerMaxX, outerMinY, color);
+        WriteVertex(verts[19], innerMaxX, innerMaxY, color);
+        WriteVertex(verts[20], innerMaxX, innerMinY, color);
+        WriteVertex(verts[21], outerMaxX, outerMinY, color);
+        WriteVertex(verts[22], innerMaxX, innerMaxY, color);
+        WriteVertex(verts[23], outerMaxX, outerMaxY, color);
+
+        vertCount += 24;
+    }
+
+    return vertCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// A zero-length line has no direction and collapses to a degenerate quad at its start.
+//
+int TessellateLines(Vertex_PCU* outVerts, int const maxVertCount, sLineShape const* shapes, int const shapeCount)
+{
+    int vertCount = 0;
+
+    for (int shapeIndex = 0; shapeIndex < shapeCount && vertCount + 6 <= maxVertCount; ++shapeIndex)
+    {
+        sLineShape const& shape    = shapes[shapeIndex];
+        float const       forwardX = shape.m_end.x - shape.m_start.x;
+        float const       forwardY = shape.m_end.y - shape.m_start.y;
+        float const       length   = sqrtf(forwardX * forwardX + forwardY * forwardY);
+        float const       scale    = length > 0.f ? 0.5f * shape.m_thickness / length : 0.f;
+        float const       offsetX  = -forwardY * scale;
+        float const       offsetY  = forwardX * scale;
+
+        Vertex_PCU* verts = outVerts + vertCount;
+
+        WriteVertex(verts[0], shape.m_start.x - offsetX, shape.m_start.y - offsetY, shape.m_color);
+        WriteVertex(verts[1], shape.m_start.x + offsetX, shape.m_start.y + offsetY, shape.m_color);
+        WriteVertex(verts[2], shape.m_end.x + offsetX, shape.m_end.y + offsetY, shape.m_color);
+        WriteVertex(verts[3], shape.m_start.x - offsetX, shape.m_start.y - offsetY, shape.m_color);
+        WriteVertex(verts[4], shape.m_end.x + offsetX, shape.m_end.y + offsetY, shape.m_color);
+        WriteVertex(verts[5], shape.m_end.x - offsetX, shape.m_end.y - offsetY, shape.m_color);
+
+        vertCount += 6;
+    }
+
+    return vertCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+char const* GetShapeTessellationKernelName()
+{
+#if defined(SHAPE_TESSELLATION_SSE)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+// Stand-ins for the old DebugDrawRing / DebugDrawGlowCircle bodies: four trig calls per segment.
+//
+static void TessellateRingWithTrig(Vertex_PCU* verts, Vec2 const& center, float const radius, float const thickness, Rgba8 const& color)
+{
+    int constexpr   NUM_SIDES        = 32;
+    float constexpr DEGREES_PER_SIDE = 360.f / static_cast<float>(NUM_SIDES);
+
+    float const innerRadius = radius - 0.5f * thickness;
+    float const outerRadius = radius + 0.5f * thickness;
+
+    for (int sideNum = 0; sideNum < NUM_SIDES; ++sideNum)
+    {
+        float const cosStart = CosDegrees(DEGREES_PER_SIDE * static_cast<float>(sideNum));
+        float const sinStart = SinDegrees(DEGREES_PER_SIDE * static_cast<float>(sideNum));
+        float const cosEnd   = CosDegrees(DEGREES_PER_SIDE * static_cast<float>(sideNum + 1));
+        float const sinEnd   = SinDegrees(DEGREES_PER_SIDE * static_cast<float>(sideNum + 1));
+
+        Vec3 const innerStart(center.x + innerRadius * cosStart, center.y + innerRadius * sinStart, 0.f);
+        Vec3 const outerStart(center.x + outerRadius * cosStart, center.y + outerRadius * sinStart, 0.f);
+        Vec3 const innerEnd(center.x + innerRadius * cosEnd, center.y + innerRadius * sinEnd, 0.f);
+        Vec3 const outerEnd(center.x + outerRadius * cosEnd, center.y + outerRadius * sinEnd, 0.f);
+
+        Vertex_PCU* sideVerts = verts + 6 * sideNum;
+
+        sideVerts[0] = Vertex_PCU(innerStart, color, Vec2(0.f, 0.f));
+        sideVerts[1] = Vertex_PCU(outerStart, color, Vec2(0.f, 0.f));
+        sideVerts[2] = Vertex_PCU(outerEnd, color, Vec2(0.f, 0.f));
+        sideVerts[3] = Vertex_PCU(innerStart, color, Vec2(0.f, 0.f));
+        sideVerts[4] = Vertex_PCU(outerEnd, color, Vec2(0.f, 0.f));
+        sideVerts[5] = Vertex_PCU(innerEnd, color, Vec2(0.f, 0.f));
+    }
+}
+
+static void TessellateGlowCircleWithTrig(Vertex_PCU* verts, Vec2 const& center, float const radius, Rgba8 const& color, float const glowIntensity)
+{
+    int constexpr   NUM_SIDES        = 32;
+    float constexpr DEGREES_PER_SIDE = 360.f / static_cast<float>(NUM_SIDES);
+
+    for (int sideNum = 0; sideNum < NUM_SIDES; ++sideNum)
+    {
+        float const cosStart = CosDegrees(DEGREES_PER_SIDE * static_cast<float>(sideNum));
+        float const sinStart = SinDegrees(DEGREES_PER_SIDE * static_cast<float>(sideNum));
+        float const cosEnd   = CosDegrees(DEGREES_PER_SIDE * static_cast<float>(sideNum + 1));
+        float const sinEnd   = SinDegrees(DEGREES_PER_SIDE * static_cast<float>(sideNum + 1));
+
+        Rgba8 glowColor = color;
+        glowColor.a     = static_cast<unsigned char>(glowIntensity * 255);
+
+        Vertex_PCU* sideVerts = verts + 3 * sideNum;
+
+        sideVerts[0] = Vertex_PCU(Vec3(center.x, center.y, 0.f), color, Vec2(0.f, 0.f));
+        sideVerts[1] = Vertex_PCU(Vec3(center.x + radius * cosStart, center.y + radius * sinStart, 0.f), glowColor, Vec2(0.f, 0.f));
+        sideVerts[2] = Vertex_PCU(Vec3(center.x + radius * cosEnd, center.y + radius * sinEnd, 0.f), glowColor, Vec2(0.f, 0.f));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void RunShapeTessellationBenchmark(std::vector<sShapeTessellationBenchmarkResult>& out_results)
+{
+    using BenchmarkClock = std::chrono::steady_clock;
+
+    int constexpr SHAPE_COUNT              = 10000;
+    int constexpr SEGMENT_COUNT            = 32;
+    int constexpr CHUNK_SHAPE_COUNT        = 128;          // 590 KB of ring verts: stays in L2
+    int constexpr TARGET_VERTS_PER_VARIANT = 50000000;
+
+    std::vector<sRingShape>       rings(SHAPE_COUNT);
+    std::vector<sGlowCircleShape> glowCircles(SHAPE_COUNT);
+
+    for (int shapeIndex = 0; shapeIndex < SHAPE_COUNT; ++shapeIndex)
+    {
+        float const seed = static_cast<float>(shapeIndex);
+        Vec2 const  center(fmodf(seed * 37.f, 1920.f), fmodf(seed * 53.f, 1200.f));
+
+        rings[shapeIndex].m_center       = center;
+        rings[shapeIndex].m_radius       = 10.f + fmodf(seed * 7.f, 90.f);
+        rings[shapeIndex].m_thickness    = 2.f;
+        rings[shapeIndex].m_color        = Rgba8(255, 200, 0);
+        rings[shapeIndex].m_segmentCount = SEGMENT_COUNT;
+
+        glowCircles[shapeIndex].m_center        = center;
+        glowCircles[shapeIndex].m_radius        = rings[shapeIndex].m_radius;
+        glowCircles[shapeIndex].m_color         = Rgba8(0, 200, 255);
+        glowCircles[shapeIndex].m_glowIntensity = 0.25f;
+        glowCircles[shapeIndex].m_segmentCount  = SEGMENT_COUNT;
+    }
+
+    int const ringVertsPerShape = GetRingVertCount(SEGMENT_COUNT);
+    int const glowVertsPerShape = GetDiscVertCount(SEGMENT_COUNT);
+    int const chunkVertCount    = CHUNK_SHAPE_COUNT * ringVertsPerShape;
+
+    std::vector<Vertex_PCU> verts(static_cast<size_t>(chunkVertCount));
+
+    // Anything the timed loops write feeds this sink, so the optimizer cannot drop them.
+    volatile float sink = 0.f;
+
+    auto const secondsSince = [](BenchmarkClock::time_point const start) { return std::chrono::duration<double>(BenchmarkClock::now() - start).count(); };
+
+    // Rings
+    {
+        sShapeTessellationBenchmarkResult result;
+        result.m_shapeName      = "ring";
+        result.m_shapeCount     = SHAPE_COUNT;
+        result.m_segmentCount   = SEGMENT_COUNT;
+        result.m_iterationCount = TARGET_VERTS_PER_VARIANT / (SHAPE_COUNT * ringVertsPerShape) + 1;
+
+        double const totalVertCount = static_cast<double>(SHAPE_COUNT) * ringVertsPerShape * result.m_iterationCount;
+
+        auto const trigStart = BenchmarkClock::now();
+        for (int iteration = 0; iteration < result.m_iterationCount; ++iteration)
+        {
+            for (int shapeIndex = 0; shapeIndex < SHAPE_COUNT; ++shapeIndex)
+            {
+                sRingShape const& ring = rings[shapeIndex];
+                TessellateRingWithTrig(verts.data() + (shapeIndex % CHUNK_SHAPE_COUNT) * ringVertsPerShape, ring.m_center, ring.m_radius, ring.m_thickness, ring.m_color);
+            }
+        }
+        result.m_trigVertsPerSecond = totalVertCount / secondsSince(trigStart);
+        sink = sink + verts.back().m_position.x;
+
+        auto const scalarStart = BenchmarkClock::now();
+        for (int iteration = 0; iteration < result.m_iterationCount; ++iteration)
+        {
+            for (int chunkStart = 0; chunkStart < SHAPE_COUNT; chunkStart += CHUNK_SHAPE_COUNT)
+            {
+                TessellateRingsScalar(verts.data(), chunkVertCount, rings.data() + chunkStart, std::min(CHUNK_SHAPE_COUNT, SHAPE_COUNT - chunkStart));
+            }
+        }
+        result.m_tableScalarVertsPerSecond = totalVertCount / secondsSince(scalarStart);
+        sink = sink + verts.back().m_position.x;
+
+        auto const simdStart = BenchmarkClock::now();
+        for (int iteration = 0; iteration < result.m_iterationCount; ++iteration)
+        {
+            for (int chunkStart = 0; chunkStart < SHAPE_COUNT; chunkStart += CHUNK_SHAPE_COUNT)
+            {
+                TessellateRings(verts.data(), chunkVertCount, rings.data() + chunkStart, std::min(CHUNK_SHAPE_COUNT, SHAPE_COUNT - chunkStart));
+            }
+        }
+        result.m_tableSIMDVertsPerSecond = totalVertCount / secondsSince(simdStart);
+        sink = sink + verts.back().m_position.x;
+
+        out_results.push_back(result);
+    }
+
+    // Glow circles
+    {
+        sShapeTessellationBenchmarkResult result;
+        result.m_shapeName      = "glow";
+        result.m_shapeCount     = SHAPE_COUNT;
+        result.m_segmentCount   = SEGMENT_COUNT;
+        result.m_iterationCount = TARGET_VERTS_PER_VARIANT / (SHAPE_COUNT * glowVertsPerShape) + 1;
+
+        double const totalVertCount = static_cast<double>(SHAPE_COUNT) * glowVertsPerShape * result.m_iterationCount;
+
+        auto const trigStart = BenchmarkClock::now();
+        for (int iteration = 0; iteration < result.m_iterationCount; ++iteration)
+        {
+            for (int shapeIndex = 0; shapeIndex < SHAPE_COUNT; ++shapeIndex)
+            {
+                sGlowCircleShape const& glow = glowCircles[shapeIndex];
+                TessellateGlowCircleWithTrig(verts.data() + (shapeIndex % CHUNK_SHAPE_COUNT) * glowVertsPerShape, glow.m_center, glow.m_radius, glow.m_color, glow.m_glowIntensity);
+            }
+        }
+        result.m_trigVertsPerSecond = totalVertCount / secondsSince(trigStart);
+        sink = sink + verts.front().m_position.x;
+
+        auto const scalarStart = BenchmarkClock::now();
+        for (int iteration = 0; iteration < result.m_iterationCount; ++iteration)
+        {
+            for (int chunkStart = 0; chunkStart < SHAPE_COUNT; chunkStart += CHUNK_SHAPE_COUNT)
+            {
+                TessellateGlowCirclesScalar(verts.data(), chunkVertCount, glowCircles.data() + chunkStart, std::min(CHUNK_SHAPE_COUNT, SHAPE_COUNT - chunkStart));
+            }
+        }
+        result.m_tableScalarVertsPerSecond = totalVertCount / secondsSince(scalarStart);
+        sink = sink + verts.front().m_position.x;
+
+        auto const simdStart = BenchmarkClock::now();
+        for (int iteration = 0; iteration < result.m_iterationCount; ++iteration)
+        {
+            for (int chunkStart = 0; chunkStart < SHAPE_COUNT; chunkStart += CHUNK_SHAPE_COUNT)
+            {
+                TessellateGlowCircles(verts.data(), chunkVertCount, glowCircles.data() + chunkStart, std::min(CHUNK_SHAPE_COUNT, SHAPE_COUNT - chunkStart));
+            }
+        }
+        result.m_tableSIMDVertsPerSecond = totalVertCount / secondsSince(simdStart);
+        sink = sink + verts.front().m_position.x;
+
+        out_results.push_back(result);
+    }
+}
@@ -0,0 +1,143 @@
+//----------------------------------------------------------------------------------------------------
+// ShapeTessellation.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/Vec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Round shapes use a unit-circle table built at compile time for each power-of-two segment count in
+// this range; a requested count is rounded up to the next table.
+//
+int constexpr SHAPE_MIN_SEGMENT_COUNT = 4;
+int constexpr SHAPE_MAX_SEGMENT_COUNT = 256;
+
+//----------------------------------------------------------------------------------------------------
+// cos / sin of every segment boundary, starting at 0 degrees and running counter-clockwise. Entries
+// past m_segmentCount wrap around, so m_cos[i + 1] is valid for every segment i (and 4-wide loads
+// starting at any segment stay inside the table).
+//
+struct sUnitCircle
+{
+    float const* m_cos          = nullptr;
+    float const* m_sin          = nullptr;
+    int          m_segmentCount = 0;
+};
+
+sUnitCircle GetUnitCircle(int segmentCount);
+int         GetSupportedSegmentCount(int segmentCount);
+
+//----------------------------------------------------------------------------------------------------
+// Level of detail. A circle of projected radius r drawn with n segments strays from the true curve by
+// at most the sagitta r * (1 - cos(pi / n)); a shape gets the fewest segments that keep this within
+// maxChordError pixels, rounded up to a table. Every table is one LOD bucket, so a caller caching
+// geometry per bucket needs at most SHAPE_LOD_BUCKET_COUNT versions of a shape.
+//
+int constexpr   SHAPE_LOD_BUCKET_COUNT        = 7;        // 4, 8, ..., 256 segments
+float constexpr SHAPE_DEFAULT_MAX_CHORD_ERROR = 0.5f;     // Pixels
+
+int GetSegmentCountForProjectedRadius(float projectedRadius, float maxChordError = SHAPE_DEFAULT_MAX_CHORD_ERROR);
+int GetShapeLODBucket(int segmentCount);
+int GetShapeLODBucketSegmentCount(int lodBucket);
+
+//----------------------------------------------------------------------------------------------------
+struct sDiscShape
+{
+    Vec2  m_center;
+    float m_radius       = 1.f;
+    Rgba8 m_color        = Rgba8::WHITE;
+    int   m_segmentCount = 32;
+};
+
+//----------------------------------------------------------------------------------------------------
+// A disc whose rim fades to glowIntensity alpha.
+//
+struct sGlowCircleShape
+{
+    Vec2  m_center;
+    float m_radius        = 1.f;
+    Rgba8 m_color         = Rgba8::WHITE;
+    float m_glowIntensity = 0.f;
+    int   m_segmentCount  = 32;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sRingShape
+{
+    Vec2  m_center;
+    float m_radius       = 1.f;     // Middle of the band
+    float m_thickness    = 1.f;
+    Rgba8 m_color        = Rgba8::WHITE;
+    int   m_segmentCount = 32;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sBoxRingShape
+{
+    Vec2  m_center;
+    float m_radius    = 1.f;     // Half the side of the box, measured to the middle of the band
+    float m_thickness = 1.f;
+    Rgba8 m_color     = Rgba8::WHITE;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sLineShape
+{
+    Vec2  m_start;
+    Vec2  m_end;
+    float m_thickness = 1.f;
+    Rgba8 m_color     = Rgba8::WHITE;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Exact vertex counts, so a caller can size one span for a whole array of shapes.
+//
+int GetDiscVertCount(int segmentCount);     // Also glow circles
+int GetRingVertCount(int segmentCount);
+int GetBoxRingVertCount();
+int GetLineVertCount();
+
+//----------------------------------------------------------------------------------------------------
+// Bulk entry points: tessellate every shape in the array into outVerts, untextured, in the same
+// triangle order the DebugDraw* helpers have always produced. Each returns the vertex count written
+// and stops after the last shape that fits in maxVertCount.
+// Round shapes read their segment boundaries from the unit-circle tables and emit four segments per
+// SSE2 iteration; the Scalar variants do the same work one segment at a time and produce identical
+// vertices. Box rings and lines need no trig and are emitted the same way by both.
+//
+int TessellateDiscs(Vertex_PCU* outVerts, int maxVertCount, sDiscShape const* shapes, int shapeCount);
+int TessellateGlowCircles(Vertex_PCU* outVerts, int maxVertCount, sGlowCircleShape const* shapes, int shapeCount);
+int TessellateRings(Vertex_PCU* outVerts, int maxVertCount, sRingShape const* shapes, int shapeCount);
+int TessellateBoxRings(Vertex_PCU* outVerts, int maxVertCount, sBoxRingShape const* shapes, int shapeCount);
+int TessellateLines(Vertex_PCU* outVerts, int maxVertCount, sLineShape const* shapes, int shapeCount);
+
+int TessellateDiscsScalar(Vertex_PCU* outVerts, int maxVertCount, sDiscShape const* shapes, int shapeCount);
+int TessellateGlowCirclesScalar(Vertex_PCU* outVerts, int maxVertCount, sGlowCircleShape const* shapes, int shapeCount);
+int TessellateRingsScalar(Vertex_PCU* outVerts, int maxVertCount, sRingShape const* shapes, int shapeCount);
+
+char const* GetShapeTessellationKernelName();
+
+//----------------------------------------------------------------------------------------------------
+struct sShapeTessellationBenchmarkResult
+{
+    char const* m_shapeName                 = "";
+    int         m_shapeCount                = 0;
+    int         m_segmentCount              = 0;
+    int         m_iterationCount            = 0;
+    double      m_trigVertsPerSecond        = 0.0;     // The old per-call CosDegrees / SinDegrees loops
+    double      m_tableScalarVertsPerSecond = 0.0;
+    double      m_tableSIMDVertsPerSecond   = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Tessellates 10k rings and 10k glow circles of 32 segments the way DebugDrawRing and
+// DebugDrawGlowCircle used to (trig for every segment boundary, twice) and through the tables. Shapes
+// go through one reused buffer 128 at a time so the vertex writes stay in cache and the numbers
+// measure tessellation; one flat span for all 10k shapes is bound by memory bandwidth instead.
+//
+void RunShapeTessellationBenchmark(std::vector<sShapeTessellationBenchmarkResult>& out_results);
@@ -0,0 +1,1286 @@
+//----------------------------------------------------------------------------------------------------
+// SoftwareRasterizer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/SoftwareRasterizer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+#include "Game/Framework/ShapeTessellation.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define SOFTWARE_RASTERIZER_SSE
+#endif
+
+//----------------------------------------------------------------------------------------------------
+// Vertices snap to 1/16 pixel before setup, as D3D snaps to its subpixel grid; it keeps slivers from
+// producing edge functions that are all rounding error.
+//
+float constexpr SUBPIXEL_STEPS = 16.f;
+float constexpr INV_255        = 1.f / 255.f;
+float constexpr DISCARD_ALPHA  = 0.001f;     // Default.hlsl discards at finalColor.a <= 0.001
+
+//----------------------------------------------------------------------------------------------------
+// Written to match _mm_min_ps / _mm_max_ps operand for operand, so the scalar kernel rounds and
+// clamps exactly as the SIMD one does.
+//
+static float MinF(float const a, float const b) { return a < b ? a : b; }
+static float MaxF(float const a, float const b) { return a > b ? a : b; }
+
+//----------------------------------------------------------------------------------------------------
+static unsigned char ToUnorm8(float const value)
+{
+    return static_cast<unsigned char>(static_cast<int>(MinF(MaxF(value, 0.f), 1.f) * 255.f + 0.5f));
+}
+
+//----------------------------------------------------------------------------------------------------
+// Channels stay in [0, 255] until the caller scales them, so a filtered sample is scaled once rather
+// than once per tap.
+//
+static void UnpackTexel(Rgba8 const& texel, float out_rgba[4])
+{
+    out_rgba[0] = static_cast<float>(texel.r);
+    out_rgba[1] = static_cast<float>(texel.g);
+    out_rgba[2] = static_cast<float>(texel.b);
+    out_rgba[3] = static_cast<float>(texel.a);
+}
+
+//----------------------------------------------------------------------------------------------------
+static void SamplePointClamp(sRasterTexture const& texture, float const u, float const v, float out_rgba[4])
+{
+    float const width  = static_cast<float>(texture.m_dimensions.x);
+    float const height = static_cast<float>(texture.m_dimensions.y);
+    int const   texelX = static_cast<int>(MinF(MinF(MaxF(u, 0.f), 1.f) * width, width - 1.f));
+    int const   texelY = static_cast<int>(MinF(MinF(MaxF(v, 0.f), 1.f) * height, height - 1.f));
+
+    UnpackTexel(texture.m_texels[static_cast<size_t>(texelY) * texture.m_dimensions.x + texelX], out_rgba);
+
+    for (int channel = 0; channel < 4; ++channel)
+    {
+        out_rgba[channel] *= INV_255;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Texel centers sit at (i + 0.5) / size. Clamping the texel-space coordinate to [0, size - 1] gives
+// the same result as clamp-addressed taps past the edge, which would only fetch the edge texel twice.
+//
+static void SampleBilinearClamp(sRasterTexture const& texture, float const u, float const v, float out_rgba[4])
+{
+    float const width  = static_cast<float>(texture.m_dimensions.x);
+    float const height = static_cast<float>(texture.m_dimensions.y);
+    float const x      = MinF(MaxF(MinF(MaxF(u, 0.f), 1.f) * width - 0.5f, 0.f), width - 1.f);
+    float const y      = MinF(MaxF(MinF(MaxF(v, 0.f), 1.f) * height - 0.5f, 0.f), height - 1.f);
+    int const   x0     = static_cast<int>(x);
+    int const   y0     = static_cast<int>(y);
+    int const   x1     = static_cast<int>(MinF(static_cast<float>(x0) + 1.f, width - 1.f));
+    int const   y1     = static_cast<int>(MinF(static_cast<float>(y0) + 1.f, height - 1.f));
+    float const fracX  = x - static_cast<float>(x0);
+    float const fracY  = y - static_cast<float>(y0);
+
+    Rgba8 const* row0 = &texture.m_texels[static_cast<size_t>(y0) * texture.m_dimensions.x];
+    Rgba8 const* row1 = &texture.m_texels[static_cast<size_t>(y1) * texture.m_dimensions.x];
+
+    float texel00[4], texel10[4], texel01[4], texel11[4];
+    UnpackTexel(row0[x0], texel00);
+    UnpackTexel(row0[x1], texel10);
+    UnpackTexel(row1[x0], texel01);
+    UnpackTexel(row1[x1], texel11);
+
+    for (int channel = 0; channel < 4; ++channel)
+    {
+        float const bottom = texel00[channel] + (texel10[channel] - texel00[channel]) * fracX;
+        float const top    = texel01[channel] + (texel11[channel] - texel01[channel]) * fracX;
+
+        out_rgba[channel] = (bottom + (top - bottom) * fracY) * INV_255;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+SoftwareRasterizer::SoftwareRasterizer(sSoftwareRasterizerConfig const& config)
+    : m_config(config)
+{
+    if (m_config.m_threadCount <= 0)
+    {
+        m_config.m_threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    StartWorkers();
+}
+
+//----------------------------------------------------------------------------------------------------
+SoftwareRasterizer::~SoftwareRasterizer()
+{
+    StopWorkers();
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRasterizer::SetTarget(Rgba8* const pixels, IntVec2 const& dimensions)
+{
+    Flush();
+
+    m_targetPixels     = pixels;
+    m_targetDimensions = dimensions;
+    m_tileCounts       = IntVec2((dimensions.x + SOFTWARE_RASTER_TILE_SIZE - 1) / SOFTWARE_RASTER_TILE_SIZE,
+                                 (dimensions.y + SOFTWARE_RASTER_TILE_SIZE - 1) / SOFTWARE_RASTER_TILE_SIZE);
+
+    m_tileBins.resize(static_cast<size_t>(std::max(0, m_tileCounts.x * m_tileCounts.y)));
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRasterizer::SetViewBounds(AABB2 const& viewBounds)
+{
+    m_viewBounds = viewBounds;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Nothing drawn before a clear can survive it, so those triangles are dropped instead of shaded.
+//
+void SoftwareRasterizer::ClearScreen(Rgba8 const& clearColor)
+{
+    m_triangles.clear();
+    m_draws.clear();
+
+    for (std::vector<int>& tileBin : m_tileBins)
+    {
+        tileBin.clear();
+    }
+
+    m_clearColor       = clearColor;
+    m_isClearPending   = true;
+    m_isDrawStateDirty = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRasterizer::SetModelConstants(Mat44 const& modelToWorldTransform, Rgba8 const& modelColor)
+{
+    m_modelToWorldTransform = modelToWorldTransform;
+    m_modelColor            = modelColor;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRasterizer::SetBlendMode(eBlendMode const blendMode)
+{
+    m_isDrawStateDirty        = m_isDrawStateDirty || blendMode != m_currentDraw.m_blendMode;
+    m_currentDraw.m_blendMode = blendMode;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Culling is applied while triangles are submitted, so it needs no per-draw record.
+//
+void SoftwareRasterizer::SetRasterizerMode(eRasterizerMode const rasterizerMode)
+{
+    m_isCullingBackFaces = rasterizerMode == eRasterizerMode::SOLID_CULL_BACK;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRasterizer::SetSamplerMode(eSamplerMode const samplerMode)
+{
+    bool const isPointSampled = samplerMode == eSamplerMode::POINT_CLAMP;
+
+    m_isDrawStateDirty             = m_isDrawStateDirty || isPointSampled != m_currentDraw.m_isPointSampled;
+    m_currentDraw.m_isPointSampled = isPointSampled;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The SIMD kernel addresses texels with float math, which is exact up to 2^24 texels (4096x4096).
+//
+void SoftwareRasterizer::BindTexture(sRasterTexture const* const texture)
+{
+    bool const                  isValid      = texture != nullptr && !texture->m_texels.empty() && texture->m_texels.size() <= (size_t(1) << 24);
+    sRasterTexture const* const validTexture = isValid ? texture : nullptr;
+
+    m_isDrawStateDirty      = m_isDrawStateDirty || validTexture != m_currentDraw.m_texture;
+    m_currentDraw.m_texture = validTexture;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The model matrix and the orthographic camera collapse into one 2D affine map from model space to
+// target pixels (Y down), so each vertex costs two dot products.
+//
+void SoftwareRasterizer::DrawVertexArray(int const vertCount, Vertex_PCU const* const verts)
+{
+    ++m_frameStats.m_drawCount;
+
+    float const viewWidth  = m_viewBounds.m_maxs.x - m_viewBounds.m_mins.x;
+    float const viewHeight = m_viewBounds.m_maxs.y - m_viewBounds.m_mins.y;
+
+    if (m_targetPixels == nullptr || vertCount < 3 || viewWidth <= 0.f || viewHeight <= 0.f)
+    {
+        return;
+    }
+
+    if (m_isDrawStateDirty)
+    {
+        m_draws.push_back(m_currentDraw);
+        m_isDrawStateDirty = false;
+    }
+
+    float const  pixelsPerUnitX = static_cast<float>(m_targetDimensions.x) / viewWidth;
+    float const  pixelsPerUnitY = static_cast<float>(m_targetDimensions.y) / viewHeight;
+    float const* model          = m_modelToWorldTransform.m_values;
+
+    float const affine[8] =
+    {
+        model[Mat44::Ix] * pixelsPerUnitX, model[Mat44::Jx] * pixelsPerUnitX, model[Mat44::Kx] * pixelsPerUnitX, (model[Mat44::Tx] - m_viewBounds.m_mins.x) * pixelsPerUnitX,
+        -model[Mat44::Iy] * pixelsPerUnitY, -model[Mat44::Jy] * pixelsPerUnitY, -model[Mat44::Ky] * pixelsPerUnitY, (m_viewBounds.m_maxs.y - model[Mat44::Ty]) * pixelsPerUnitY
+    };
+
+    float const tint[4] =
+    {
+        static_cast<float>(m_modelColor.r) * INV_255, static_cast<float>(m_modelColor.g) * INV_255,
+        static_cast<float>(m_modelColor.b) * INV_255, static_cast<float>(m_modelColor.a) * INV_255
+    };
+
+    int const drawIndex = static_cast<int>(m_draws.size()) - 1;
+
+    for (int vertIndex = 0; vertIndex + 2 < vertCount; vertIndex += 3)
+    {
+        SubmitTriangle(verts[vertIndex], verts[vertIndex + 1], verts[vertIndex + 2], affine, tint, drawIndex);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRasterizer::SubmitTriangle(Vertex_PCU const& v0, Vertex_PCU const& v1, Vertex_PCU const& v2, float const affine[8], float const tint[4], int const drawIndex)
+{
+    ++m_frameStats.m_triangleCount;
+
+    Vertex_PCU const* const verts[3] = { &v0, &v1, &v2 };
+    float                   x[3];
+    float                   y[3];
+
+    for (int vertIndex = 0; vertIndex < 3; ++vertIndex)
+    {
+        Vec3 const& position = verts[vertIndex]->m_position;
+        float const pixelX   = affine[0] * position.x + affine[1] * position.y + affine[2] * position.z + affine[3];
+        float const pixelY   = affine[4] * position.x + affine[5] * position.y + affine[6] * position.z + affine[7];
+
+        x[vertIndex] = std::floor(pixelX * SUBPIXEL_STEPS + 0.5f) / SUBPIXEL_STEPS;
+        y[vertIndex] = std::floor(pixelY * SUBPIXEL_STEPS + 0.5f) / SUBPIXEL_STEPS;
+    }
+
+    // Y is down here, so a counter-clockwise (front-facing) triangle in the scene has negative area.
+    float const area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+
+    if (area == 0.f || !std::isfinite(area) || (m_isCullingBackFaces && area > 0.f))
+    {
+        ++m_frameStats.m_culledTriangleCount;
+        return;
+    }
+
+    float const minX = MaxF(std::floor(std::min({ x[0], x[1], x[2] })), 0.f);
+    float const minY = MaxF(std::floor(std::min({ y[0], y[1], y[2] })), 0.f);
+    float const maxX = MinF(std::ceil(std::max({ x[0], x[1], x[2] })), static_cast<float>(m_targetDimensions.x));
+    float const maxY = MinF(std::ceil(std::max({ y[0], y[1], y[2] })), static_cast<float>(m_targetDimensions.y));
+
+    if (!(minX < maxX) || !(minY < maxY))
+    {
+        ++m_frameStats.m_culledTriangleCount;
+        return;
+    }
+
+    sTriangle triangle;
+    triangle.m_minX      = static_cast<int>(minX);
+    triangle.m_minY      = static_cast<int>(minY);
+    triangle.m_maxX      = static_cast<int>(maxX);
+    triangle.m_maxY      = static_cast<int>(maxY);
+    triangle.m_originX   = x[0];
+    triangle.m_originY   = y[0];
+    triangle.m_drawIndex = drawIndex;
+
+    float const insideSign = area > 0.f ? 1.f : -1.f;
+
+    for (int edgeIndex = 0; edgeIndex < 3; ++edgeIndex)
+    {
+        int const   startIndex   = (edgeIndex + 1) % 3;
+        int const   endIndex     = (edgeIndex + 2) % 3;
+        bool const  isStartLower = y[startIndex] < y[endIndex] || (y[startIndex] == y[endIndex] && x[startIndex] < x[endIndex]);
+        int const   lowerIndex   = isStartLower ? startIndex : endIndex;
+        int const   upperIndex   = isStartLower ? endIndex : startIndex;
+        float const edgeSign     = isStartLower ? insideSign : -insideSign;
+
+        // Negating a product is exact, so folding the sign into the steps leaves the shared edge's
+        // value exactly negated between its two triangles.
+        triangle.m_edgeOriginX[edgeIndex] = x[lowerIndex];
+        triangle.m_edgeOriginY[edgeIndex] = y[lowerIndex];
+        triangle.m_edgeStepX[edgeIndex]   = -edgeSign * (y[upperIndex] - y[lowerIndex]);
+        triangle.m_edgeStepY[edgeIndex]   = edgeSign * (x[upperIndex] - x[lowerIndex]);
+
+        float const stepX = triangle.m_edgeStepX[edgeIndex];
+        triangle.m_edgeInverseStepX[edgeIndex] = stepX != 0.f ? 1.f / stepX : 0.f;
+
+        // Walking the edge with the inside on the positive side: a left edge heads up the target, a
+        // top edge heads right along it. Its neighbour walks it the other way, so exactly one owns it.
+        float const directionX = insideSign * (x[endIndex] - x[startIndex]);
+        float const directionY = insideSign * (y[endIndex] - y[startIndex]);
+
+        triangle.m_isEdgeOwned[edgeIndex] = directionY < 0.f || (directionY == 0.f && directionX > 0.f);
+    }
+
+    float attributes[ATTRIBUTE_COUNT][3];
+
+    for (int vertIndex = 0; vertIndex < 3; ++vertIndex)
+    {
+        Rgba8 const& color = verts[vertIndex]->m_color;
+
+        attributes[0][vertIndex] = static_cast<float>(color.r) * INV_255 * tint[0];
+        attributes[1][vertIndex] = static_cast<float>(color.g) * INV_255 * tint[1];
+        attributes[2][vertIndex] = static_cast<float>(color.b) * INV_255 * tint[2];
+        attributes[3][vertIndex] = static_cast<float>(color.a) * INV_255 * tint[3];
+        attributes[4][vertIndex] = verts[vertIndex]->m_uvTexCoords.x;
+        attributes[5][vertIndex] = verts[vertIndex]->m_uvTexCoords.y;
+    }
+
+    float const inverseArea = 1.f / area;
+
+    for (int attributeIndex = 0; attributeIndex < ATTRIBUTE_COUNT; ++attributeIndex)
+    {
+        float const delta1 = attributes[attributeIndex][1] - attributes[attributeIndex][0];
+        float const delta2 = attributes[attributeIndex][2] - attributes[attributeIndex][0];
+
+        triangle.m_attributeValues[attributeIndex] = attributes[attributeIndex][0];
+        triangle.m_attributeStepsX[attributeIndex] = (delta1 * (y[2] - y[0]) - delta2 * (y[1] - y[0])) * inverseArea;
+        triangle.m_attributeStepsY[attributeIndex] = (delta2 * (x[1] - x[0]) - delta1 * (x[2] - x[0])) * inverseArea;
+    }
+
+    int const triangleIndex = static_cast<int>(m_triangles.size());
+    m_triangles.push_back(triangle);
+
+    int const firstTileX = triangle.m_minX / SOFTWARE_RASTER_TILE_SIZE;
+    int const firstTileY = triangle.m_minY / SOFTWARE_RASTER_TILE_SIZE;
+    int const lastTileX  = (triangle.m_maxX - 1) / SOFTWARE_RASTER_TILE_SIZE;
+    int const lastTileY  = (triangle.m_maxY - 1) / SOFTWARE_RASTER_TILE_SIZE;
+
+    for (int tileY = firstTileY; tileY <= lastTileY; ++tileY)
+    {
+        for (int tileX = firstTileX; tileX <= lastTileX; ++tileX)
+        {
+            m_tileBins[static_cast<size_t>(tileY) * m_tileCounts.x + tileX].push_back(triangleIndex);
+        }
+    }
+
+    m_frameStats.m_binEntryCount += static_cast<uint32_t>((lastTileX - firstTileX + 1) * (lastTileY - firstTileY + 1));
+}
+
+//----------------------------------------------------------------------------------------------------
+// Shades every tile that was cleared or binned since the last flush, then forgets the recorded draws.
+// Returns once every pixel is in the target.
+//
+void SoftwareRasterizer::Flush()
+{
+    if (!m_isClearPending && m_triangles.empty())
+    {
+        return;
+    }
+
+    double const startSeconds = GetSchedulerTimeSeconds();
+
+    if (m_targetPixels != nullptr)
+    {
+        m_nextTileIndex.store(0);
+        m_shadedPixelCount.store(0);
+        m_shadedTileCount.store(0);
+
+        if (!m_workers.empty())
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_workMutex);
+                m_finishedWorkerCount = 0;
+                ++m_workGeneration;
+            }
+
+            m_workCondition.notify_all();
+        }
+
+        ShadeTiles();
+
+        if (!m_workers.empty())
+        {
+            std::unique_lock<std::mutex> lock(m_workMutex);
+            m_doneCondition.wait(lock, [this] { return m_finishedWorkerCount == static_cast<int>(m_workers.size()); });
+        }
+
+        m_frameStats.m_pixelCount += m_shadedPixelCount.load();
+        m_frameStats.m_tileCount += m_shadedTileCount.load();
+    }
+
+    m_triangles.clear();
+    m_draws.clear();
+
+    for (std::vector<int>& tileBin : m_tileBins)
+    {
+        tileBin.clear();
+    }
+
+    m_isClearPending   = false;
+    m_isDrawStateDirty = true;
+
+    ++m_frameStats.m_flushCount;
+    m_frameStats.m_flushSeconds += GetSchedulerTimeSeconds() - startSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRasterizer::BeginFrame()
+{
+    m_lastFrameStats = m_frameStats;
+    m_frameStats     = sSoftwareRasterizerStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+sSoftwareRasterizerStats const& SoftwareRasterizer::GetLastFrameStats() const
+{
+    return m_lastFrameStats;
+}
+
+//----------------------------------------------------------------------------------------------------
+int SoftwareRasterizer::GetThreadCount() const
+{
+    return m_config.m_threadCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool SoftwareRasterizer::IsSIMDEnabled() const
+{
+    return m_config.m_isSIMDEnabled;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The calling thread shades tiles too, so a pool of threadCount - 1 workers keeps every core busy.
+//
+void SoftwareRasterizer::StartWorkers()
+{
+    for (int workerIndex = 1; workerIndex < m_config.m_threadCount; ++workerIndex)
+    {
+        m_workers.emplace_back(&SoftwareRasterizer::RunWorker, this);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRasterizer::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_workMutex);
+        m_isShuttingDown = true;
+    }
+
+    m_workCondition.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+
+    m_workers.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Flush waits for every worker to report before it returns, so each worker sees each generation once.
+//
+void SoftwareRasterizer::RunWorker()
+{
+    uint64_t seenGeneration = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_workMutex);
+            m_workCondition.wait(lock, [this, seenGeneration] { return m_isShuttingDown || m_workGeneration != seenGeneration; });
+
+            if (m_isShuttingDown)
+            {
+                return;
+            }
+
+            seenGeneration = m_workGeneration;
+        }
+
+        ShadeTiles();
+
+        {
+            std::lock_guard<std::mutex> lock(m_workMutex);
+            ++m_finishedWorkerCount;
+        }
+
+        m_doneCondition.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRasterizer::ShadeTiles()
+{
+    int const                tileCount = static_cast<int>(m_tileBins.size());
+    sSoftwareRasterizerStats stats;
+
+    for (int tileIndex = m_nextTileIndex.fetch_add(1); tileIndex < tileCount; tileIndex = m_nextTileIndex.fetch_add(1))
+    {
+        ShadeTile(tileIndex, stats);
+    }
+
+    m_shadedPixelCount.fetch_add(stats.m_pixelCount);
+    m_shadedTileCount.fetch_add(stats.m_tileCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRasterizer::ShadeTile(int const tileIndex, sSoftwareRasterizerStats& out_stats) const
+{
+    std::vector<int> const& tileBin = m_tileBins[tileIndex];
+
+    if (!m_isClearPending && tileBin.empty())
+    {
+        return;
+    }
+
+    IntVec2 const tileMins((tileIndex % m_tileCounts.x) * SOFTWARE_RASTER_TILE_SIZE, (tileIndex / m_tileCounts.x) * SOFTWARE_RASTER_TILE_SIZE);
+    IntVec2 const tileMaxs(std::min(tileMins.x + SOFTWARE_RASTER_TILE_SIZE, m_targetDimensions.x), std::min(tileMins.y + SOFTWARE_RASTER_TILE_SIZE, m_targetDimensions.y));
+
+    if (m_isClearPending)
+    {
+        ClearTile(tileMins, tileMaxs);
+    }
+
+    for (int const triangleIndex : tileBin)
+    {
+        sTriangle const& triangle = m_triangles[triangleIndex];
+
+#if defined(SOFTWARE_RASTERIZER_SSE)
+        if (m_config.m_isSIMDEnabled)
+        {
+            out_stats.m_pixelCount += static_cast<uint64_t>(ShadeTriangleSIMD(triangle, tileMins, tileMaxs));
+            continue;
+        }
+#endif
+
+        out_stats.m_pixelCount += static_cast<uint64_t>(ShadeTriangleScalar(triangle, tileMins, tileMaxs));
+    }
+
+    ++out_stats.m_tileCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRasterizer::ClearTile(IntVec2 const& tileMins, IntVec2 const& tileMaxs) const
+{
+    for (int y = tileMins.y; y < tileMaxs.y; ++y)
+    {
+        Rgba8* const row = m_targetPixels + static_cast<size_t>(y) * m_targetDimensions.x;
+        std::fill(row + tileMins.x, row + tileMaxs.x, m_clearColor);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Narrows [inout_minX, inout_maxX) to the pixels of one row that can be inside the triangle, so thin
+// and diagonal triangles don't test their whole bounding box. Each edge with a horizontal step bounds
+// the row where it crosses zero. The span only has to be conservative: the margin covers the rounding
+// of the crossing against the edge function itself, and the exact per-pixel test still decides.
+//
+void SoftwareRasterizer::ClipRowToEdges(sTriangle const& triangle, float const edgeRowTerms[3], int& inout_minX, int& inout_maxX) const
+{
+    float spanMinX = static_cast<float>(inout_minX);
+    float spanMaxX = static_cast<float>(inout_maxX);
+
+    for (int edgeIndex = 0; edgeIndex < 3; ++edgeIndex)
+    {
+        float const stepX = triangle.m_edgeStepX[edgeIndex];
+
+        if (stepX == 0.f)
+        {
+            continue;
+        }
+
+        float const distance = edgeRowTerms[edgeIndex] * triangle.m_edgeInverseStepX[edgeIndex];
+        float const crossing = triangle.m_edgeOriginX[edgeIndex] - distance - 0.5f;     // In pixel indices, not centers
+        float const margin   = 1.f + std::fabs(distance) * (1.f / 1048576.f);
+
+        if (stepX > 0.f)
+        {
+            spanMinX = MaxF(std::floor(crossing - margin), spanMinX);
+        }
+        else
+        {
+            spanMaxX = MinF(std::ceil(crossing + margin) + 1.f, spanMaxX);
+        }
+    }
+
+    if (!(spanMinX < spanMaxX))
+    {
+        inout_maxX = inout_minX;
+        return;
+    }
+
+    inout_minX = static_cast<int>(spanMinX);
+    inout_maxX = static_cast<int>(spanMaxX);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Reference kernel: Default.hlsl's pixel shader and the Output Merger's blend, one pixel at a time.
+//
+int SoftwareRasterizer::ShadeTriangleScalar(sTriangle const& triangle, IntVec2 const& tileMins, IntVec2 const& tileMaxs) const
+{
+    sDraw const&                draw    = m_draws[triangle.m_drawIndex];
+    sRasterTexture const* const texture = draw.m_texture;
+
+    int const minX = std::max(triangle.m_minX, tileMins.x);
+    int const minY = std::max(triangle.m_minY, tileMins.y);
+    int const maxX = std::min(triangle.m_maxX, tileMaxs.x);
+    int const maxY = std::min(triangle.m_maxY, tileMaxs.y);
+
+    int writtenCount = 0;
+
+    for (int y = minY; y < maxY; ++y)
+    {
+        float const  pixelY = static_cast<float>(y) + 0.5f;
+        Rgba8* const row    = m_targetPixels + static_cast<size_t>(y) * m_targetDimensions.x;
+
+        float edgeRowTerms[3];
+        float attributeRowValues[ATTRIBUTE_COUNT];
+
+        for (int edgeIndex = 0; edgeIndex < 3; ++edgeIndex)
+        {
+            edgeRowTerms[edgeIndex] = triangle.m_edgeStepY[edgeIndex] * (pixelY - triangle.m_edgeOriginY[edgeIndex]);
+        }
+
+        for (int attributeIndex = 0; attributeIndex < ATTRIBUTE_COUNT; ++attributeIndex)
+        {
+            attributeRowValues[attributeIndex] = triangle.m_attributeValues[attributeIndex] + triangle.m_attributeStepsY[attributeIndex] * (pixelY - triangle.m_originY);
+        }
+
+        int spanMinX = minX;
+        int spanMaxX = maxX;
+        ClipRowToEdges(triangle, edgeRowTerms, spanMinX, spanMaxX);
+
+        for (int x = spanMinX; x < spanMaxX; ++x)
+        {
+            float const pixelX   = static_cast<float>(x) + 0.5f;
+            bool        isInside = true;
+
+            for (int edgeIndex = 0; edgeIndex < 3; ++edgeIndex)
+            {
+                float const edge = edgeRowTerms[edgeIndex] + triangle.m_edgeStepX[edgeIndex] * (pixelX - triangle.m_edgeOriginX[edgeIndex]);
+
+                isInside = isInside && (edge > 0.f || (edge == 0.f && triangle.m_isEdgeOwned[edgeIndex]));
+            }
+
+            if (!isInside)
+            {
+                continue;
+            }
+
+            float const offsetX = pixelX - triangle.m_originX;
+            float       attributes[ATTRIBUTE_COUNT];
+
+            for (int attributeIndex = 0; attributeIndex < ATTRIBUTE_COUNT; ++attributeIndex)
+            {
+                attributes[attributeIndex] = attributeRowValues[attributeIndex] + triangle.m_attributeStepsX[attributeIndex] * offsetX;
+            }
+
+            float source[4];
+            std::copy_n(attributes, 4, source);
+
+            if (texture != nullptr)
+            {
+                float texel[4];
+
+                if (draw.m_isPointSampled)
+                {
+                    SamplePointClamp(*texture, attributes[4], attributes[5], texel);
+                }
+                else
+                {
+                    SampleBilinearClamp(*texture, attributes[4], attributes[5], texel);
+                }
+
+                for (int channel = 0; channel < 4; ++channel)
+                {
+                    source[channel] = texel[channel] * source[channel];
+                }
+            }
+
+            if (!(source[3] > DISCARD_ALPHA))
+            {
+                continue;
+            }
+
+            float result[4];
+
+            if (draw.m_blendMode == eBlendMode::ALPHA || draw.m_blendMode == eBlendMode::ADDITIVE)
+            {
+                float destination[4];
+                UnpackTexel(row[x], destination);
+
+                bool const  isAlpha           = draw.m_blendMode == eBlendMode::ALPHA;
+                float const destinationFactor = isAlpha ? 1.f - source[3] : 1.f;
+
+                for (int channel = 0; channel < 4; ++channel)
+                {
+                    destination[channel] *= INV_255;
+
+                    if (isAlpha)
+                    {
+                        destination[channel] *= destinationFactor;
+                    }
+                }
+
+                for (int channel = 0; channel < 3; ++channel)
+                {
+                    result[channel] = source[channel] * source[3] + destination[channel];
+                }
+
+                result[3] = source[3] + destination[3];
+            }
+            else
+            {
+                std::copy_n(source, 4, result);
+            }
+
+            row[x] = Rgba8(ToUnorm8(result[0]), ToUnorm8(result[1]), ToUnorm8(result[2]), ToUnorm8(result[3]));
+            ++writtenCount;
+        }
+    }
+
+    return writtenCount;
+}
+
+#if defined(SOFTWARE_RASTERIZER_SSE)
+
+//----------------------------------------------------------------------------------------------------
+static_assert(sizeof(Rgba8) == 4, "The SIMD kernel loads and stores four Rgba8 pixels as one __m128i");
+
+//----------------------------------------------------------------------------------------------------
+// Four packed RGBA8 pixels (r in the low byte) to one float vector per channel, each in [0, 255].
+//
+static void UnpackPixelsSSE(__m128i const pixels, __m128 out_channels[4])
+{
+    __m128i const byteMask = _mm_set1_epi32(0xFF);
+
+    out_channels[0] = _mm_cvtepi32_ps(_mm_and_si128(pixels, byteMask));
+    out_channels[1] = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 8), byteMask));
+    out_channels[2] = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 16), byteMask));
+    out_channels[3] = _mm_cvtepi32_ps(_mm_srli_epi32(pixels, 24));
+}
+
+//----------------------------------------------------------------------------------------------------
+static __m128i PackPixelsSSE(__m128 const r, __m128 const g, __m128 const b, __m128 const a)
+{
+    __m128 const zero = _mm_setzero_ps();
+    __m128 const one  = _mm_set1_ps(1.f);
+    __m128 const s255 = _mm_set1_ps(255.f);
+    __m128 const half = _mm_set1_ps(0.5f);
+
+    auto const toBytes = [&](__m128 const channel) { return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(channel, zero), one), s255), half)); };
+
+    return _mm_or_si128(_mm_or_si128(toBytes(r), _mm_slli_epi32(toBytes(g), 8)), _mm_or_si128(_mm_slli_epi32(toBytes(b), 16), _mm_slli_epi32(toBytes(a), 24)));
+}
+
+//----------------------------------------------------------------------------------------------------
+// Linear texel index y * width + x for four lanes. SSE2 has no 32-bit multiply, but the float product
+// is exact for every texture BindTexture accepts.
+//
+static __m128i GetTexelIndicesSSE(__m128 const texelX, __m128 const texelY, __m128 const width)
+{
+    return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(texelY, width), texelX));
+}
+
+//----------------------------------------------------------------------------------------------------
+// SSE2 has no gather, so the fetches are scalar, into one packed vector per tap.
+//
+static __m128i GatherTexelsSSE(Rgba8 const* texels, int32_t const indices[4])
+{
+    alignas(16) uint32_t packed[4];
+
+    for (int lane = 0; lane < 4; ++lane)
+    {
+        memcpy(&packed[lane], &texels[indices[lane]], sizeof(uint32_t));
+    }
+
+    return _mm_load_si128(reinterpret_cast<__m128i const*>(packed));
+}
+
+//----------------------------------------------------------------------------------------------------
+static void SamplePointClampSSE(sRasterTexture const& texture, __m128 const u, __m128 const v, __m128 out_channels[4])
+{
+    __m128 const zero   = _mm_setzero_ps();
+    __m128 const one    = _mm_set1_ps(1.f);
+    __m128 const inv255 = _mm_set1_ps(INV_255);
+    __m128 const width  = _mm_set1_ps(static_cast<float>(texture.m_dimensions.x));
+    __m128 const height = _mm_set1_ps(static_cast<float>(texture.m_dimensions.y));
+
+    __m128i const texelX = _mm_cvttps_epi32(_mm_min_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(u, zero), one), width), _mm_sub_ps(width, one)));
+    __m128i const texelY = _mm_cvttps_epi32(_mm_min_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(v, zero), one), height), _mm_sub_ps(height, one)));
+
+    alignas(16) int32_t indices[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(indices), GetTexelIndicesSSE(_mm_cvtepi32_ps(texelX), _mm_cvtepi32_ps(texelY), width));
+
+    UnpackPixelsSSE(GatherTexelsSSE(texture.m_texels.data(), indices), out_channels);
+
+    for (int channel = 0; channel < 4; ++channel)
+    {
+        out_channels[channel] = _mm_mul_ps(out_channels[channel], inv255);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// The four taps are the base index plus a step right (0 or 1) and a step up (0 or width), both zero
+// where the coordinate is clamped to the last texel.
+//
+static void SampleBilinearClampSSE(sRasterTexture const& texture, __m128 const u, __m128 const v, __m128 out_channels[4])
+{
+    __m128 const zero      = _mm_setzero_ps();
+    __m128 const one       = _mm_set1_ps(1.f);
+    __m128 const half      = _mm_set1_ps(0.5f);
+    __m128 const inv255    = _mm_set1_ps(INV_255);
+    __m128 const width     = _mm_set1_ps(static_cast<float>(texture.m_dimensions.x));
+    __m128 const height    = _mm_set1_ps(static_cast<float>(texture.m_dimensions.y));
+    __m128 const maxTexelX = _mm_sub_ps(width, one);
+    __m128 const maxTexelY = _mm_sub_ps(height, one);
+
+    __m128 const x     = _mm_min_ps(_mm_max_ps(_mm_sub_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(u, zero), one), width), half), zero), maxTexelX);
+    __m128 const y     = _mm_min_ps(_mm_max_ps(_mm_sub_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(v, zero), one), height), half), zero), maxTexelY);
+    __m128 const x0    = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+    __m128 const y0    = _mm_cvtepi32_ps(_mm_cvttps_epi32(y));
+    __m128 const x1    = _mm_min_ps(_mm_add_ps(x0, one), maxTexelX);
+    __m128 const y1    = _mm_min_ps(_mm_add_ps(y0, one), maxTexelY);
+    __m128 const fracX = _mm_sub_ps(x, x0);
+    __m128 const fracY = _mm_sub_ps(y, y0);
+
+    alignas(16) int32_t baseIndices[4];
+    alignas(16) int32_t rightSteps[4];
+    alignas(16) int32_t upSteps[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(baseIndices), GetTexelIndicesSSE(x0, y0, width));
+    _mm_store_si128(reinterpret_cast<__m128i*>(rightSteps), _mm_cvttps_epi32(_mm_sub_ps(x1, x0)));
+    _mm_store_si128(reinterpret_cast<__m128i*>(upSteps), _mm_cvttps_epi32(_mm_mul_ps(_mm_sub_ps(y1, y0), width)));
+
+    Rgba8 const* const  texels = texture.m_texels.data();
+    alignas(16) int32_t tapIndices[4][4];
+
+    for (int lane = 0; lane < 4; ++lane)
+    {
+        tapIndices[0][lane] = baseIndices[lane];
+        tapIndices[1][lane] = baseIndices[lane] + rightSteps[lane];
+        tapIndices[2][lane] = baseIndices[lane] + upSteps[lane];
+        tapIndices[3][lane] = baseIndices[lane] + upSteps[lane] + rightSteps[lane];
+    }
+
+    __m128 texel00[4], texel10[4], texel01[4], texel11[4];
+    UnpackPixelsSSE(GatherTexelsSSE(texels, tapIndices[0]), texel00);
+    UnpackPixelsSSE(GatherTexelsSSE(texels, tapIndices[1]), texel10);
+    UnpackPixelsSSE(GatherTexelsSSE(texels, tapIndices[2]), texel01);
+    UnpackPixelsSSE(GatherTexelsSSE(texels, tapIndices[3]), texel11);
+
+    for (int channel = 0; channel < 4; ++channel)
+    {
+        __m128 const bottom = _mm_add_ps(texel00[channel], _mm_mul_ps(_mm_sub_ps(texel10[channel], texel00[channel]), fracX));
+        __m128 const top    = _mm_add_ps(texel01[channel], _mm_mul_ps(_mm_sub_ps(texel11[channel], texel01[channel]), fracX));
+
+        out_channels[channel] = _mm_mul_ps(_mm_add_ps(bottom, _mm_mul_ps(_mm_sub_ps(top, bottom), fracY)), inv255);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Four horizontally adjacent pixels per iteration, starting on a multiple of four so blocks never
+// straddle a tile. Lanes outside the row's span are masked, which keeps the pixel set identical
+// to the scalar kernel's. A block that runs off the right of the target (only possible in the last
+// tile column) is read and written lane by lane.
+//
+int SoftwareRasterizer::ShadeTriangleSIMD(sTriangle const& triangle, IntVec2 const& tileMins, IntVec2 const& tileMaxs) const
+{
+    sDraw const&                draw    = m_draws[triangle.m_drawIndex];
+    sRasterTexture const* const texture = draw.m_texture;
+    bool const                  isAlpha = draw.m_blendMode == eBlendMode::ALPHA;
+    bool const                  isBlend = isAlpha || draw.m_blendMode == eBlendMode::ADDITIVE;
+
+    int const minX = std::max(triangle.m_minX, tileMins.x);
+    int const minY = std::max(triangle.m_minY, tileMins.y);
+    int const maxX = std::min(triangle.m_maxX, tileMaxs.x);
+    int const maxY = std::min(triangle.m_maxY, tileMaxs.y);
+
+    __m128 const  zero         = _mm_setzero_ps();
+    __m128 const  one          = _mm_set1_ps(1.f);
+    __m128 const  inv255       = _mm_set1_ps(INV_255);
+    __m128 const  discardAlpha = _mm_set1_ps(DISCARD_ALPHA);
+    __m128 const  laneCenters  = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    __m128i const laneOffsets  = _mm_setr_epi32(0, 1, 2, 3);
+    __m128 const  originX      = _mm_set1_ps(triangle.m_originX);
+
+    // Broadcast once per triangle: the blocks below only ever read these registers, never the triangle.
+    __m128 edgeOriginX[3], edgeStepX[3], edgeOwned[3];
+    __m128 attributeStepsX[ATTRIBUTE_COUNT];
+
+    for (int edgeIndex = 0; edgeIndex < 3; ++edgeIndex)
+    {
+        edgeOriginX[edgeIndex] = _mm_set1_ps(triangle.m_edgeOriginX[edgeIndex]);
+        edgeStepX[edgeIndex]   = _mm_set1_ps(triangle.m_edgeStepX[edgeIndex]);
+        edgeOwned[edgeIndex]   = _mm_castsi128_ps(_mm_set1_epi32(triangle.m_isEdgeOwned[edgeIndex] ? -1 : 0));
+    }
+
+    for (int attributeIndex = 0; attributeIndex < ATTRIBUTE_COUNT; ++attributeIndex)
+    {
+        attributeStepsX[attributeIndex] = _mm_set1_ps(triangle.m_attributeStepsX[attributeIndex]);
+    }
+
+    int writtenCount = 0;
+
+    for (int y = minY; y < maxY; ++y)
+    {
+        float const  pixelY = static_cast<float>(y) + 0.5f;
+        Rgba8* const row    = m_targetPixels + static_cast<size_t>(y) * m_targetDimensions.x;
+
+        float edgeRowTermValues[3];
+
+        for (int edgeIndex = 0; edgeIndex < 3; ++edgeIndex)
+        {
+            edgeRowTermValues[edgeIndex] = triangle.m_edgeStepY[edgeIndex] * (pixelY - triangle.m_edgeOriginY[edgeIndex]);
+        }
+
+        int spanMinX = minX;
+        int spanMaxX = maxX;
+        ClipRowToEdges(triangle, edgeRowTermValues, spanMinX, spanMaxX);
+
+        if (spanMinX >= spanMaxX)
+        {
+            continue;
+        }
+
+        __m128 edgeRowTerms[3];
+        __m128 attributeRowValues[ATTRIBUTE_COUNT];
+
+        for (int edgeIndex = 0; edgeIndex < 3; ++edgeIndex)
+        {
+            edgeRowTerms[edgeIndex] = _mm_set1_ps(edgeRowTermValues[edgeIndex]);
+        }
+
+        for (int attributeIndex = 0; attributeIndex < ATTRIBUTE_COUNT; ++attributeIndex)
+        {
+            attributeRowValues[attributeIndex] = _mm_set1_ps(triangle.m_attributeValues[attributeIndex] + triangle.m_attributeStepsY[attributeIndex] * (pixelY - triangle.m_originY));
+        }
+
+        __m128i const spanMinX4 = _mm_set1_epi32(spanMinX - 1);
+        __m128i const spanMaxX4 = _mm_set1_epi32(spanMaxX);
+
+        for (int blockX = spanMinX & ~3; blockX < spanMaxX; blockX += 4)
+        {
+            __m128 const  pixelX  = _mm_add_ps(_mm_set1_ps(static_cast<float>(blockX)), laneCenters);
+            __m128i const laneX   = _mm_add_epi32(_mm_set1_epi32(blockX), laneOffsets);
+            __m128        covered = _mm_castsi128_ps(_mm_and_si128(_mm_cmpgt_epi32(laneX, spanMinX4), _mm_cmplt_epi32(laneX, spanMaxX4)));
+
+            for (int edgeIndex = 0; edgeIndex < 3; ++edgeIndex)
+            {
+                __m128 const edge = _mm_add_ps(edgeRowTerms[edgeIndex], _mm_mul_ps(edgeStepX[edgeIndex], _mm_sub_ps(pixelX, edgeOriginX[edgeIndex])));
+
+                covered = _mm_and_ps(covered, _mm_or_ps(_mm_cmpgt_ps(edge, zero), _mm_and_ps(_mm_cmpeq_ps(edge, zero), edgeOwned[edgeIndex])));
+            }
+
+            if (_mm_movemask_ps(covered) == 0)
+            {
+                continue;
+            }
+
+            __m128 const offsetX = _mm_sub_ps(pixelX, originX);
+            __m128       source[4];
+
+            for (int channel = 0; channel < 4; ++channel)
+            {
+                source[channel] = _mm_add_ps(attributeRowValues[channel], _mm_mul_ps(attributeStepsX[channel], offsetX));
+            }
+
+            if (texture != nullptr)
+            {
+                __m128 const u = _mm_add_ps(attributeRowValues[4], _mm_mul_ps(attributeStepsX[4], offsetX));
+                __m128 const v = _mm_add_ps(attributeRowValues[5], _mm_mul_ps(attributeStepsX[5], offsetX));
+                __m128       texel[4];
+
+                if (draw.m_isPointSampled)
+                {
+                    SamplePointClampSSE(*texture, u, v, texel);
+                }
+                else
+                {
+                    SampleBilinearClampSSE(*texture, u, v, texel);
+                }
+
+                for (int channel = 0; channel < 4; ++channel)
+                {
+                    source[channel] = _mm_mul_ps(texel[channel], source[channel]);
+                }
+            }
+
+            covered = _mm_and_ps(covered, _mm_cmpgt_ps(source[3], discardAlpha));
+
+            int const coveredMask = _mm_movemask_ps(covered);
+
+            if (coveredMask == 0)
+            {
+                continue;
+            }
+
+            bool const isBlockInside = blockX + 4 <= tileMaxs.x;
+
+            // An opaque block covering all four lanes replaces the destination without reading it.
+            if (!isBlend && coveredMask == 0xF && isBlockInside)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(row + blockX), PackPixelsSSE(source[0], source[1], source[2], source[3]));
+                writtenCount += 4;
+                continue;
+            }
+
+            __m128i destinationPixels;
+
+            if (isBlockInside)
+            {
+                destinationPixels = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row + blockX));
+            }
+            else
+            {
+                alignas(16) uint32_t lanePixels[4] = {};
+                memcpy(lanePixels, row + blockX, sizeof(Rgba8) * static_cast<size_t>(tileMaxs.x - blockX));
+                destinationPixels = _mm_load_si128(reinterpret_cast<__m128i const*>(lanePixels));
+            }
+
+            __m128 result[4];
+
+            if (isBlend)
+            {
+                __m128 destination[4];
+                UnpackPixelsSSE(destinationPixels, destination);
+
+                __m128 const destinationFactor = isAlpha ? _mm_sub_ps(one, source[3]) : one;
+
+                for (int channel = 0; channel < 4; ++channel)
+                {
+                    destination[channel] = _mm_mul_ps(destination[channel], inv255);
+
+                    if (isAlpha)
+                    {
+                        destination[channel] = _mm_mul_ps(destination[channel], destinationFactor);
+                    }
+                }
+
+                for (int channel = 0; channel < 3; ++channel)
+                {
+                    result[channel] = _mm_add_ps(_mm_mul_ps(source[channel], source[3]), destination[channel]);
+                }
+
+                result[3] = _mm_add_ps(source[3], destination[3]);
+            }
+            else
+            {
+                std::copy_n(source, 4, result);
+            }
+
+            __m128i const coveredBits = _mm_castps_si128(covered);
+            __m128i const blended     = _mm_or_si128(_mm_and_si128(coveredBits, PackPixelsSSE(result[0], result[1], result[2], result[3])), _mm_andnot_si128(coveredBits, destinationPixels));
+
+            if (isBlockInside)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(row + blockX), blended);
+            }
+            else
+            {
+                alignas(16) uint32_t lanePixels[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanePixels), blended);
+                memcpy(row + blockX, lanePixels, sizeof(Rgba8) * static_cast<size_t>(tileMaxs.x - blockX));
+            }
+
+            writtenCount += (coveredMask & 1) + ((coveredMask >> 1) & 1) + ((coveredMask >> 2) & 1) + ((coveredMask >> 3) & 1);
+        }
+    }
+
+    return writtenCount;
+}
+
+#else
+
+//----------------------------------------------------------------------------------------------------
+int SoftwareRasterizer::ShadeTriangleSIMD(sTriangle const& triangle, IntVec2 const& tileMins, IntVec2 const& tileMaxs) const
+{
+    return ShadeTriangleScalar(triangle, tileMins, tileMaxs);
+}
+
+#endif // defined(SOFTWARE_RASTERIZER_SSE)
+
+//----------------------------------------------------------------------------------------------------
+char const* GetSoftwareRasterizerKernelName()
+{
+#if defined(SOFTWARE_RASTERIZER_SSE)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+// Quad covering bounds, counter-clockwise, so it survives SOLID_CULL_BACK.
+//
+static void AddBenchmarkQuad(std::vector<Vertex_PCU>& verts, AABB2 const& bounds, Rgba8 const& color)
+{
+    Vertex_PCU const bottomLeft(Vec3(bounds.m_mins.x, bounds.m_mins.y, 0.f), color, Vec2(0.f, 0.f));
+    Vertex_PCU const bottomRight(Vec3(bounds.m_maxs.x, bounds.m_mins.y, 0.f), color, Vec2(1.f, 0.f));
+    Vertex_PCU const topRight(Vec3(bounds.m_maxs.x, bounds.m_maxs.y, 0.f), color, Vec2(1.f, 1.f));
+    Vertex_PCU const topLeft(Vec3(bounds.m_mins.x, bounds.m_maxs.y, 0.f), color, Vec2(0.f, 1.f));
+
+    verts.insert(verts.end(), { bottomLeft, bottomRight, topRight, bottomLeft, topRight, topLeft });
+}
+
+//----------------------------------------------------------------------------------------------------
+void RunSoftwareRasterizerBenchmark(std::vector<sSoftwareRasterizerBenchmarkResult>& out_results)
+{
+    using BenchmarkClock = std::chrono::steady_clock;
+
+    int constexpr FRAME_COUNT       = 20;
+    int constexpr DEBUG_SHAPE_COUNT = 1000;     // Of each kind
+
+    IntVec2 const targetDimensions(1920, 1200);
+    AABB2 const   sceneBounds(Vec2::ZERO, Vec2(static_cast<float>(targetDimensions.x), static_cast<float>(targetDimensions.y)));
+
+    // A 256x256 checkerboard with a gradient, so both samplers have something to filter.
+    sRasterTexture texture;
+    texture.m_dimensions = IntVec2(256, 256);
+    texture.m_texels.resize(256 * 256);
+
+    for (int texelY = 0; texelY < 256; ++texelY)
+    {
+        for (int texelX = 0; texelX < 256; ++texelX)
+        {
+            unsigned char const checker = ((texelX / 16) + (texelY / 16)) % 2 == 0 ? 255 : 96;
+            texture.m_texels[static_cast<size_t>(texelY) * 256 + texelX] = Rgba8(checker, static_cast<unsigned char>(texelX), static_cast<unsigned char>(texelY), 255);
+        }
+    }
+
+    std::vector<Vertex_PCU> backgroundVerts;
+    AddBenchmarkQuad(backgroundVerts, sceneBounds, Rgba8::WHITE);
+
+    sDiscShape disc;
+    disc.m_radius       = 300.f;
+    disc.m_color        = Rgba8::YELLOW;
+    disc.m_segmentCount = SHAPE_MAX_SEGMENT_COUNT;
+
+    std::vector<Vertex_PCU> discVerts(static_cast<size_t>(GetDiscVertCount(disc.m_segmentCount)));
+    TessellateDiscs(discVerts.data(), static_cast<int>(discVerts.size()), &disc, 1);
+
+    sLineShape crossLines[2];
+    crossLines[0].m_start     = Vec2(100.f, 100.f);
+    crossLines[0].m_end       = sceneBounds.m_maxs - Vec2(100.f, 100.f);
+    crossLines[1].m_start     = Vec2(100.f, sceneBounds.m_maxs.y - 100.f);
+    crossLines[1].m_end       = Vec2(sceneBounds.m_maxs.x - 100.f, 100.f);
+    crossLines[0].m_thickness = crossLines[1].m_thickness = 10.f;
+    crossLines[0].m_color     = crossLines[1].m_color     = Rgba8::GREEN;
+
+    std::vector<Vertex_PCU> crossVerts(static_cast<size_t>(2 * GetLineVertCount()));
+    TessellateLines(crossVerts.data(), static_cast<int>(crossVerts.size()), crossLines, 2);
+
+    std::vector<sGlowCircleShape> glowCircles(DEBUG_SHAPE_COUNT);
+    std::vector<sRingShape>       rings(DEBUG_SHAPE_COUNT);
+
+    for (int shapeIndex = 0; shapeIndex < DEBUG_SHAPE_COUNT; ++shapeIndex)
+    {
+        float const seed = static_cast<float>(shapeIndex);
+        Vec2 const  center(fmodf(seed * 37.f, sceneBounds.m_maxs.x), fmodf(seed * 53.f, sceneBounds.m_maxs.y));
+
+        glowCircles[shapeIndex].m_center        = center;
+        glowCircles[shapeIndex].m_radius        = 8.f + fmodf(seed * 7.f, 32.f);
+        glowCircles[shapeIndex].m_color         = Rgba8(0, 200, 255, 160);
+        glowCircles[shapeIndex].m_glowIntensity = 0.f;
+        glowCircles[shapeIndex].m_segmentCount  = 32;
+
+        rings[shapeIndex].m_center       = center;
+        rings[shapeIndex].m_radius       = glowCircles[shapeIndex].m_radius + 4.f;
+        rings[shapeIndex].m_thickness    = 2.f;
+        rings[shapeIndex].m_color        = Rgba8(255, 200, 0, 200);
+        rings[shapeIndex].m_segmentCount = 32;
+    }
+
+    std::vector<Vertex_PCU> debugVerts(static_cast<size_t>(DEBUG_SHAPE_COUNT * (GetDiscVertCount(32) + GetRingVertCount(32))));
+    int debugVertCount = TessellateGlowCircles(debugVerts.data(), static_cast<int>(debugVerts.size()), glowCircles.data(), DEBUG_SHAPE_COUNT);
+    debugVertCount += TessellateRings(debugVerts.data() + debugVertCount, static_cast<int>(debugVerts.size()) - debugVertCount, rings.data(), DEBUG_SHAPE_COUNT);
+
+    auto const drawAttractScene = [&](SoftwareRasterizer& rasterizer)
+    {
+        rasterizer.SetViewBounds(sceneBounds);
+        rasterizer.ClearScreen(Rgba8::BLUE);
+        rasterizer.SetBlendMode(eBlendMode::OPAQUE);
+        rasterizer.SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
+        rasterizer.SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
+        rasterizer.SetModelConstants();
+        rasterizer.BindTexture(&texture);
+        rasterizer.DrawVertexArray(static_cast<int>(backgroundVerts.size()), backgroundVerts.data());
+        rasterizer.BindTexture(nullptr);
+        rasterizer.SetModelConstants(Mat44::MakeTranslation2D(sceneBounds.m_maxs * 0.5f));
+        rasterizer.DrawVertexArray(static_cast<int>(discVerts.size()), discVerts.data());
+        rasterizer.SetModelConstants();
+        rasterizer.DrawVertexArray(static_cast<int>(crossVerts.size()), crossVerts.data());
+        rasterizer.Flush();
+    };
+
+    auto const drawDebugScene = [&](SoftwareRasterizer& rasterizer)
+    {
+        rasterizer.SetViewBounds(sceneBounds);
+        rasterizer.ClearScreen(Rgba8::BLUE);
+        rasterizer.SetBlendMode(eBlendMode::OPAQUE);
+        rasterizer.SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
+        rasterizer.SetSamplerMode(eSamplerMode::POINT_CLAMP);
+        rasterizer.SetModelConstants();
+        rasterizer.BindTexture(&texture);
+        rasterizer.DrawVertexArray(static_cast<int>(backgroundVerts.size()), backgroundVerts.data());
+        rasterizer.SetBlendMode(eBlendMode::ALPHA);
+        rasterizer.SetRasterizerMode(eRasterizerMode::SOLID_CULL_NONE);
+        rasterizer.BindTexture(nullptr);
+        rasterizer.DrawVertexArray(debugVertCount, debugVerts.data());
+        rasterizer.Flush();
+    };
+
+    auto const secondsSince = [](BenchmarkClock::time_point const start) { return std::chrono::duration<double>(BenchmarkClock::now() - start).count(); };
+
+    auto const runScene = [&](char const* sceneName, int const triangleCount, auto const& drawScene)
+    {
+        sSoftwareRasterizerBenchmarkResult result;
+        result.m_sceneName        = sceneName;
+        result.m_targetDimensions = targetDimensions;
+        result.m_triangleCount    = triangleCount;
+        result.m_frameCount       = FRAME_COUNT;
+
+        std::vector<Rgba8> pixels[3];
+
+        auto const timeRun = [&](int const runIndex, int const threadCount, bool const isSIMDEnabled)
+        {
+            sSoftwareRasterizerConfig config;
+            config.m_threadCount   = threadCount;
+            config.m_isSIMDEnabled = isSIMDEnabled;
+
+            SoftwareRasterizer rasterizer(config);
+            pixels[runIndex].resize(static_cast<size_t>(targetDimensions.x) * targetDimensions.y);
+            rasterizer.SetTarget(pixels[runIndex].data(), targetDimensions);
+
+            drawScene(rasterizer);     // Warm-up: faults in the target and the pool's threads
+
+            auto const start = BenchmarkClock::now();
+            for (int frameIndex = 0; frameIndex < FRAME_COUNT; ++frameIndex)
+            {
+                drawScene(rasterizer);
+            }
+            double const millisecondsPerFrame = 1000.0 * secondsSince(start) / FRAME_COUNT;
+
+            result.m_threadCount = rasterizer.GetThreadCount();
+            return millisecondsPerFrame;
+        };
+
+        result.m_scalarMillisecondsPerFrame   = timeRun(0, 1, false);
+        result.m_simdMillisecondsPerFrame     = timeRun(1, 1, true);
+        result.m_threadedMillisecondsPerFrame = timeRun(2, 0, true);
+
+        size_t const byteCount = pixels[0].size() * sizeof(Rgba8);
+        result.m_isOutputIdentical = memcmp(pixels[0].data(), pixels[1].data(), byteCount) == 0 && memcmp(pixels[0].data(), pixels[2].data(), byteCount) == 0;
+
+        out_results.push_back(result);
+    };
+
+    runScene("attract", static_cast<int>(backgroundVerts.size() + discVerts.size() + crossVerts.size()) / 3, drawAttractScene);
+    runScene("debugdraw", static_cast<int>(backgroundVerts.size() + debugVertCount) / 3, drawDebugScene);
+}
@@ -0,0 +1,195 @@
+//----------------------------------------------------------------------------------------------------
+// SoftwareRasterizer.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+
+//----------------------------------------------------------------------------------------------------
+int constexpr SOFTWARE_RASTER_TILE_SIZE = 64;     // Pixels per side; each tile is shaded by one thread
+
+//----------------------------------------------------------------------------------------------------
+// CPU copy of a texture. Row 0 is v = 0, the same way round the Engine uploads an Image.
+//
+struct sRasterTexture
+{
+    IntVec2            m_dimensions = IntVec2::ZERO;
+    std::vector<Rgba8> m_texels;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sSoftwareRasterizerConfig
+{
+    int  m_threadCount   = 0;        // Including the calling thread; 0 uses every hardware thread
+    bool m_isSIMDEnabled = true;     // false runs the scalar reference kernel, which writes identical pixels
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sSoftwareRasterizerStats
+{
+    uint32_t m_flushCount          = 0;
+    uint32_t m_drawCount           = 0;     // DrawVertexArray calls
+    uint32_t m_triangleCount       = 0;     // Submitted, before culling
+    uint32_t m_culledTriangleCount = 0;     // Back-facing, degenerate or off-target
+    uint32_t m_binEntryCount       = 0;     // Triangle-tile pairs
+    uint32_t m_tileCount           = 0;     // Tiles shaded (cleared or covered by at least one triangle)
+    uint64_t m_pixelCount          = 0;     // Pixels written by triangles, after coverage and discard
+    double   m_flushSeconds        = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Draws Vertex_PCU triangles into an RGBA8 surface on the CPU with the semantics of Default.hlsl:
+/// model and orthographic camera transforms, texel * vertex color * model tint, discard at alpha
+/// <= 0.001, then the bound blend mode. State is set with the same calls the Renderer takes.
+/// Draws only record triangles: each one is transformed and set up as it is submitted and binned into
+/// SOFTWARE_RASTER_TILE_SIZE tiles. Flush then shades the tiles on a pool of worker threads (the
+/// caller works too); a tile belongs to one thread and takes its triangles in submission order, so
+/// blending matches the GPU's draw order and no pixel is shared between threads.
+/// Coverage uses edge functions evaluated the same way for both triangles sharing an edge, with a
+/// top-left fill rule, so meshes have no gaps or double-blended seams. The SIMD kernel shades four
+/// pixels per SSE2 iteration and writes exactly what the scalar kernel does.
+/// Rasterizer modes other than SOLID_CULL_BACK draw both faces, filled; sampler modes other than
+/// POINT_CLAMP sample bilinear with clamped UVs; depth is ignored (every Game state disables it).
+class SoftwareRasterizer
+{
+public:
+    explicit SoftwareRasterizer(sSoftwareRasterizerConfig const& config = sSoftwareRasterizerConfig());
+    ~SoftwareRasterizer();
+    SoftwareRasterizer(SoftwareRasterizer const&)            = delete;
+    SoftwareRasterizer& operator=(SoftwareRasterizer const&) = delete;
+
+    void SetTarget(Rgba8* pixels, IntVec2 const& dimensions);     // Row 0 is the top of the view; flushes first
+    void SetViewBounds(AABB2 const& viewBounds);                  // Orthographic camera bounds mapped onto the whole target
+
+    void ClearScreen(Rgba8 const& clearColor);     // Drops every draw recorded since the last Flush
+    void SetModelConstants(Mat44 const& modelToWorldTransform = Mat44(), Rgba8 const& modelColor = Rgba8::WHITE);
+    void SetBlendMode(eBlendMode blendMode);
+    void SetRasterizerMode(eRasterizerMode rasterizerMode);
+    void SetSamplerMode(eSamplerMode samplerMode);
+    void BindTexture(sRasterTexture const* texture);     // nullptr samples opaque white, like the Engine's default texture
+    void DrawVertexArray(int vertCount, Vertex_PCU const* verts);
+    void Flush();
+
+    void BeginFrame();
+
+    sSoftwareRasterizerStats const& GetLastFrameStats() const;
+    int                             GetThreadCount() const;
+    bool                            IsSIMDEnabled() const;
+
+private:
+    struct sDraw
+    {
+        eBlendMode            m_blendMode      = eBlendMode::OPAQUE;
+        bool                  m_isPointSampled = false;
+        sRasterTexture const* m_texture        = nullptr;
+    };
+
+    // Edge k is the one opposite vertex k. Each edge is stored from its lower endpoint (by y, then x)
+    // to its higher one, so a neighbour sharing it computes the same value; the steps carry this
+    // triangle's sign, so the edge function is positive inside.
+    // Color and UV are planes anchored at vertex 0: value + stepX * (x - x0) + stepY * (y - y0).
+    static int constexpr ATTRIBUTE_COUNT = 6;     // r, g, b, a, u, v
+
+    struct sTriangle
+    {
+        float m_edgeOriginX[3]                   = {};
+        float m_edgeOriginY[3]                   = {};
+        float m_edgeStepX[3]                     = {};
+        float m_edgeStepY[3]                     = {};
+        float m_edgeInverseStepX[3]              = {};     // 0 for horizontal edges
+        bool  m_isEdgeOwned[3]                   = {};     // Top-left rule: pixels exactly on the edge belong to this triangle
+        float m_originX                          = 0.f;
+        float m_originY                          = 0.f;
+        float m_attributeValues[ATTRIBUTE_COUNT] = {};     // At vertex 0; color already multiplied by the model tint
+        float m_attributeStepsX[ATTRIBUTE_COUNT] = {};
+        float m_attributeStepsY[ATTRIBUTE_COUNT] = {};
+        int   m_minX                             = 0;      // Pixel bounds, clipped to the target; max is exclusive
+        int   m_minY                             = 0;
+        int   m_maxX                             = 0;
+        int   m_maxY                             = 0;
+        int   m_drawIndex                        = 0;
+    };
+
+    void SubmitTriangle(Vertex_PCU const& v0, Vertex_PCU const& v1, Vertex_PCU const& v2, float const affine[8], float const tint[4], int drawIndex);
+    void StartWorkers();
+    void StopWorkers();
+    void RunWorker();
+    void ShadeTiles();
+    void ShadeTile(int tileIndex, sSoftwareRasterizerStats& out_stats) const;
+    void ClearTile(IntVec2 const& tileMins, IntVec2 const& tileMaxs) const;
+    void ClipRowToEdges(sTriangle const& triangle, float const edgeRowTerms[3], int& inout_minX, int& inout_maxX) const;
+    int  ShadeTriangleScalar(sTriangle const& triangle, IntVec2 const& tileMins, IntVec2 const& tileMaxs) const;
+    int  ShadeTriangleSIMD(sTriangle const& triangle, IntVec2 const& tileMins, IntVec2 const& tileMaxs) const;
+
+    sSoftwareRasterizerConfig m_config;
+
+    // Target and recorded state; touched by the calling thread only, and read-only during Flush.
+    Rgba8*                        m_targetPixels     = nullptr;
+    IntVec2                       m_targetDimensions = IntVec2::ZERO;
+    IntVec2                       m_tileCounts       = IntVec2::ZERO;
+    AABB2                         m_viewBounds;
+    Mat44                         m_modelToWorldTransform;
+    Rgba8                         m_modelColor;
+    sDraw                         m_currentDraw;
+    bool                          m_isCullingBackFaces = true;
+    bool                          m_isDrawStateDirty   = true;     // The next draw needs a new sDraw
+    bool                          m_isClearPending     = false;
+    Rgba8                         m_clearColor;
+    std::vector<sDraw>            m_draws;
+    std::vector<sTriangle>        m_triangles;
+    std::vector<std::vector<int>> m_tileBins;     // Triangle indices per tile, in submission order
+
+    // Worker pool. Workers sleep between flushes and claim tiles from m_nextTileIndex.
+    std::vector<std::thread> m_workers;
+    std::mutex               m_workMutex;
+    std::condition_variable  m_workCondition;
+    std::condition_variable  m_doneCondition;
+    uint64_t                 m_workGeneration      = 0;         // Guarded by m_workMutex
+    int                      m_finishedWorkerCount = 0;         // Guarded by m_workMutex
+    bool                     m_isShuttingDown      = false;     // Guarded by m_workMutex
+    std::atomic<int>         m_nextTileIndex{0};
+    std::atomic<uint64_t>    m_shadedPixelCount{0};
+    std::atomic<uint32_t>    m_shadedTileCount{0};
+
+    sSoftwareRasterizerStats m_frameStats;
+    sSoftwareRasterizerStats m_lastFrameStats;
+};
+
+//----------------------------------------------------------------------------------------------------
+char const* GetSoftwareRasterizerKernelName();
+
+//----------------------------------------------------------------------------------------------------
+struct sSoftwareRasterizerBenchmarkResult
+{
+    char const* m_sceneName                    = "";
+    IntVec2     m_targetDimensions             = IntVec2::ZERO;
+    int         m_triangleCount                = 0;         // Per frame
+    int         m_frameCount                   = 0;
+    int         m_threadCount                  = 0;         // Used by the threaded run
+    double      m_scalarMillisecondsPerFrame   = 0.0;       // One thread
+    double      m_simdMillisecondsPerFrame     = 0.0;       // One thread
+    double      m_threadedMillisecondsPerFrame = 0.0;       // SIMD on every thread
+    bool        m_isOutputIdentical            = false;     // All three runs wrote the same pixels
+};
+
+//----------------------------------------------------------------------------------------------------
+// Renders two 1920x1200 scenes the way the game builds them: the attract screen (textured bilinear
+// background, opaque disc, cross) and a debug-draw load (2000 alpha-blended glow circles and rings
+// over a point-sampled backdrop), with the scalar kernel on one thread, the SIMD kernel on one
+// thread and the SIMD kernel on every thread.
+//
+void RunSoftwareRasterizerBenchmark(std::vector<sSoftwareRasterizerBenchmarkResult>& out_results);
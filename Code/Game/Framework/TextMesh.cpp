@@ -0,0 +1,444 @@
+//----------------------------------------------------------------------------------------------------
+// TextMesh.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/TextMesh.hpp"
+
+#include <cfloat>
+#include <cstddef>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Renderer/BitmapFont.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define TEXT_MESH_SSE
+#endif
+
+//----------------------------------------------------------------------------------------------------
+float constexpr GLYPH_U_SIZE = 1.f / static_cast<float>(FIXED_FONT_GLYPH_COLUMNS);
+float constexpr GLYPH_V_SIZE = 1.f / static_cast<float>(FIXED_FONT_GLYPH_ROWS);
+
+//----------------------------------------------------------------------------------------------------
+// Everything a kernel needs for one line, already clipped vertically. The insets are how much of the
+// glyph's V range the clip box cut off its bottom and top.
+//
+struct sTextLine
+{
+    unsigned char const* m_text         = nullptr;
+    float                m_originX      = 0.f;
+    float                m_minY         = 0.f;
+    float                m_maxY         = 0.f;
+    float                m_vBottomInset = 0.f;
+    float                m_vTopInset    = 0.f;
+    float                m_cellWidth    = 0.f;
+    float                m_uPerUnit     = 0.f;     // U covered by one unit of screen X
+    float                m_clipMinX     = 0.f;
+    float                m_clipMaxX     = 0.f;
+    Rgba8                m_color;
+};
+
+//----------------------------------------------------------------------------------------------------
+static void WriteGlyphQuad(Vertex_PCU* verts, float const minX, float const minY, float const maxX, float const maxY,
+                           float const minU, float const minV, float const maxU, float const maxV, Rgba8 const& color)
+{
+    verts[0] = Vertex_PCU(Vec3(minX, minY, 0.f), color, Vec2(minU, minV));
+    verts[1] = Vertex_PCU(Vec3(maxX, minY, 0.f), color, Vec2(maxU, minV));
+    verts[2] = Vertex_PCU(Vec3(maxX, maxY, 0.f), color, Vec2(maxU, maxV));
+    verts[3] = Vertex_PCU(Vec3(minX, minY, 0.f), color, Vec2(minU, minV));
+    verts[4] = Vertex_PCU(Vec3(maxX, maxY, 0.f), color, Vec2(maxU, maxV));
+    verts[5] = Vertex_PCU(Vec3(minX, maxY, 0.f), color, Vec2(minU, maxV));
+}
+
+#if defined(TEXT_MESH_SSE)
+//----------------------------------------------------------------------------------------------------
+// Writes each vertex as one 16-byte store of position and color plus one 8-byte store of UVs,
+// instead of a field at a time; the quad is built from its four distinct corners.
+//
+static_assert(sizeof(Vertex_PCU) == 24 && offsetof(Vertex_PCU, m_uvTexCoords) == 16, "WriteGlyphQuadSSE assumes Vertex_PCU is position, color, UV");
+
+static void WriteGlyphQuadSSE(Vertex_PCU* verts, __m128 const minXminYmaxXmaxY, __m128 const minUminVmaxUmaxV, __m128 const color4)
+{
+    // (x, y, 0, color) for each corner: the shuffle zeroes the top two lanes, then the color is OR-ed in.
+    __m128 const bottomLeft  = _mm_or_ps(_mm_shuffle_ps(minXminYmaxXmaxY, _mm_setzero_ps(), _MM_SHUFFLE(0, 0, 1, 0)), color4);
+    __m128 const bottomRight = _mm_or_ps(_mm_shuffle_ps(minXminYmaxXmaxY, _mm_setzero_ps(), _MM_SHUFFLE(0, 0, 1, 2)), color4);
+    __m128 const topRight    = _mm_or_ps(_mm_shuffle_ps(minXminYmaxXmaxY, _mm_setzero_ps(), _MM_SHUFFLE(0, 0, 3, 2)), color4);
+    __m128 const topLeft     = _mm_or_ps(_mm_shuffle_ps(minXminYmaxXmaxY, _mm_setzero_ps(), _MM_SHUFFLE(0, 0, 3, 0)), color4);
+
+    __m128 const uvBottomLeft  = minUminVmaxUmaxV;
+    __m128 const uvBottomRight = _mm_shuffle_ps(minUminVmaxUmaxV, minUminVmaxUmaxV, _MM_SHUFFLE(0, 0, 1, 2));
+    __m128 const uvTopRight    = _mm_shuffle_ps(minUminVmaxUmaxV, minUminVmaxUmaxV, _MM_SHUFFLE(0, 0, 3, 2));
+    __m128 const uvTopLeft     = _mm_shuffle_ps(minUminVmaxUmaxV, minUminVmaxUmaxV, _MM_SHUFFLE(0, 0, 3, 0));
+
+    float* vert = reinterpret_cast<float*>(verts);
+
+    _mm_storeu_ps(vert + 0, bottomLeft);
+    _mm_storel_pi(reinterpret_cast<__m64*>(vert + 4), uvBottomLeft);
+    _mm_storeu_ps(vert + 6, bottomRight);
+    _mm_storel_pi(reinterpret_cast<__m64*>(vert + 10), uvBottomRight);
+    _mm_storeu_ps(vert + 12, topRight);
+    _mm_storel_pi(reinterpret_cast<__m64*>(vert + 16), uvTopRight);
+    _mm_storeu_ps(vert + 18, bottomLeft);
+    _mm_storel_pi(reinterpret_cast<__m64*>(vert + 22), uvBottomLeft);
+    _mm_storeu_ps(vert + 24, topRight);
+    _mm_storel_pi(reinterpret_cast<__m64*>(vert + 28), uvTopRight);
+    _mm_storeu_ps(vert + 30, topLeft);
+    _mm_storel_pi(reinterpret_cast<__m64*>(vert + 34), uvTopLeft);
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------
+// Shared by the scalar kernel and the SIMD kernel's remainder loop. Every operation matches the SIMD
+// lanes one for one (the selects are written the way _mm_max_ps / _mm_min_ps evaluate), so both paths
+// produce the same vertices bit for bit.
+//
+static int BuildGlyphRange(sTextLine const& line, int const beginColumn, int const endColumn, Vertex_PCU* outVerts, int vertCount, int const maxVertCount)
+{
+    for (int column = beginColumn; column < endColumn; ++column)
+    {
+        if (vertCount + 6 > maxVertCount)
+        {
+            break;
+        }
+
+        unsigned char const glyph = line.m_text[column];
+
+        float const minX        = line.m_originX + line.m_cellWidth * static_cast<float>(column);
+        float const maxX        = minX + line.m_cellWidth;
+        float const clippedMinX = minX > line.m_clipMinX ? minX : line.m_clipMinX;
+        float const clippedMaxX = maxX < line.m_clipMaxX ? maxX : line.m_clipMaxX;
+
+        if (!(clippedMaxX > clippedMinX))
+        {
+            continue;
+        }
+
+        float const minU = static_cast<float>(glyph & 15) * GLYPH_U_SIZE;
+        float const maxV = 1.f - static_cast<float>(glyph >> 4) * GLYPH_V_SIZE;
+
+        WriteGlyphQuad(outVerts + vertCount, clippedMinX, line.m_minY, clippedMaxX, line.m_maxY,
+                       minU + (clippedMinX - minX) * line.m_uPerUnit,
+                       (maxV - GLYPH_V_SIZE) + line.m_vBottomInset,
+                       (minU + GLYPH_U_SIZE) - (maxX - clippedMaxX) * line.m_uPerUnit,
+                       maxV - line.m_vTopInset,
+                       line.m_color);
+
+        vertCount += 6;
+    }
+
+    return vertCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Four glyphs per iteration: positions, clipping and UVs are computed across lanes, then each visible
+// lane's quad is written out.
+//
+static int BuildGlyphRangeSIMD(sTextLine const& line, int const beginColumn, int const endColumn, Vertex_PCU* outVerts, int vertCount, int const maxVertCount)
+{
+    int column = beginColumn;
+
+#if defined(TEXT_MESH_SSE)
+    {
+        __m128 const  laneOffsets4  = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+        __m128 const  originX4      = _mm_set1_ps(line.m_originX);
+        __m128 const  cellWidth4    = _mm_set1_ps(line.m_cellWidth);
+        __m128 const  clipMinX4     = _mm_set1_ps(line.m_clipMinX);
+        __m128 const  clipMaxX4     = _mm_set1_ps(line.m_clipMaxX);
+        __m128 const  uPerUnit4     = _mm_set1_ps(line.m_uPerUnit);
+        __m128 const  vBottomInset4 = _mm_set1_ps(line.m_vBottomInset);
+        __m128 const  vTopInset4    = _mm_set1_ps(line.m_vTopInset);
+        __m128 const  glyphU4       = _mm_set1_ps(GLYPH_U_SIZE);
+        __m128 const  glyphV4       = _mm_set1_ps(GLYPH_V_SIZE);
+        __m128 const  one4          = _mm_set1_ps(1.f);
+        __m128 const  minY4         = _mm_set1_ps(line.m_minY);
+        __m128 const  maxY4         = _mm_set1_ps(line.m_maxY);
+        __m128i const columnMask4   = _mm_set1_epi32(FIXED_FONT_GLYPH_COLUMNS - 1);
+        __m128i const zero4         = _mm_setzero_si128();
+
+        int32_t colorBits;
+        memcpy(&colorBits, &line.m_color, sizeof(colorBits));
+        __m128 const color4 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, colorBits));
+
+        for (; column + 4 <= endColumn && vertCount + 24 <= maxVertCount; column += 4)
+        {
+            // Widen four glyph bytes to four int lanes, then split each into its grid column and row.
+            int32_t packedGlyphs;
+            memcpy(&packedGlyphs, line.m_text + column, sizeof(packedGlyphs));
+
+            __m128i glyphs = _mm_cvtsi32_si128(packedGlyphs);
+            glyphs         = _mm_unpacklo_epi8(glyphs, zero4);
+            glyphs         = _mm_unpacklo_epi16(glyphs, zero4);
+
+            __m128 const glyphColumn = _mm_cvtepi32_ps(_mm_and_si128(glyphs, columnMask4));
+            __m128 const glyphRow    = _mm_cvtepi32_ps(_mm_srli_epi32(glyphs, 4));
+
+            __m128 const columns  = _mm_add_ps(_mm_set1_ps(static_cast<float>(column)), laneOffsets4);
+            __m128 const minX     = _mm_add_ps(originX4, _mm_mul_ps(cellWidth4, columns));
+            __m128 const maxX     = _mm_add_ps(minX, cellWidth4);
+            __m128 const clipMinX = _mm_max_ps(minX, clipMinX4);
+            __m128 const clipMaxX = _mm_min_ps(maxX, clipMaxX4);
+
+            __m128 const glyphMinU = _mm_mul_ps(glyphColumn, glyphU4);
+            __m128 const glyphMaxV = _mm_sub_ps(one4, _mm_mul_ps(glyphRow, glyphV4));
+
+            // Transposed, each register holds one glyph's (minX, minY, maxX, maxY) and (minU, minV, maxU, maxV).
+            __m128 bounds0 = clipMinX;
+            __m128 bounds1 = minY4;
+            __m128 bounds2 = clipMaxX;
+            __m128 bounds3 = maxY4;
+            __m128 uvs0    = _mm_add_ps(glyphMinU, _mm_mul_ps(_mm_sub_ps(clipMinX, minX), uPerUnit4));
+            __m128 uvs1    = _mm_add_ps(_mm_sub_ps(glyphMaxV, glyphV4), vBottomInset4);
+            __m128 uvs2    = _mm_sub_ps(_mm_add_ps(glyphMinU, glyphU4), _mm_mul_ps(_mm_sub_ps(maxX, clipMaxX), uPerUnit4));
+            __m128 uvs3    = _mm_sub_ps(glyphMaxV, vTopInset4);
+
+            _MM_TRANSPOSE4_PS(bounds0, bounds1, bounds2, bounds3);
+            _MM_TRANSPOSE4_PS(uvs0, uvs1, uvs2, uvs3);
+
+            __m128 const bounds[4] = {bounds0, bounds1, bounds2, bounds3};
+            __m128 const uvs[4]    = {uvs0, uvs1, uvs2, uvs3};
+
+            int visibleLanes = _mm_movemask_ps(_mm_cmpgt_ps(clipMaxX, clipMinX));
+
+            for (int lane = 0; visibleLanes != 0; ++lane, visibleLanes >>= 1)
+            {
+                if ((visibleLanes & 1) != 0)
+                {
+                    WriteGlyphQuadSSE(outVerts + vertCount, bounds[lane], uvs[lane], color4);
+                    vertCount += 6;
+                }
+            }
+        }
+    }
+#endif
+
+    return BuildGlyphRange(line, column, endColumn, outVerts, vertCount, maxVertCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Splits the text into lines, clips each line against the box once, and hands the range of columns
+// that can touch the box to the kernel. Lines run downward, so the first line below the box ends it.
+//
+static int BuildTextVertsWithKernel(Vertex_PCU* outVerts, int const maxVertCount, sTextMeshDesc const& desc, char const* text, int const textLength, bool const isSIMD)
+{
+    float const cellHeight = desc.m_cellHeight;
+    float const cellWidth  = desc.m_cellHeight * desc.m_cellAspect;
+
+    if (cellHeight <= 0.f || cellWidth <= 0.f || textLength <= 0)
+    {
+        return 0;
+    }
+
+    float const clipMinX = desc.m_clipBox != nullptr ? desc.m_clipBox->m_mins.x : -FLT_MAX;
+    float const clipMinY = desc.m_clipBox != nullptr ? desc.m_clipBox->m_mins.y : -FLT_MAX;
+    float const clipMaxX = desc.m_clipBox != nullptr ? desc.m_clipBox->m_maxs.x : FLT_MAX;
+    float const clipMaxY = desc.m_clipBox != nullptr ? desc.m_clipBox->m_maxs.y : FLT_MAX;
+
+    sTextLine line;
+    line.m_originX   = desc.m_textMins.x;
+    line.m_cellWidth = cellWidth;
+    line.m_uPerUnit  = GLYPH_U_SIZE / cellWidth;
+    line.m_clipMinX  = clipMinX;
+    line.m_clipMaxX  = clipMaxX;
+    line.m_color     = desc.m_color;
+
+    float const vPerUnit  = GLYPH_V_SIZE / cellHeight;
+    int         vertCount = 0;
+    int         lineIndex = 0;
+    int         lineBegin = 0;
+
+    for (; lineBegin <= textLength && vertCount + 6 <= maxVertCount; ++lineIndex)
+    {
+        void const* newline    = memchr(text + lineBegin, '\n', static_cast<size_t>(textLength - lineBegin));
+        int const   lineEnd    = newline != nullptr ? static_cast<int>(static_cast<char const*>(newline) - text) : textLength;
+        float const lineMinY   = desc.m_textMins.y - cellHeight * static_cast<float>(lineIndex);
+        float const lineMaxY   = lineMinY + cellHeight;
+        int const   lineLength = lineEnd - lineBegin;
+
+        if (lineMaxY <= clipMinY)
+        {
+            break;
+        }
+
+        float const visibleColumns = (clipMaxX - line.m_originX) / cellWidth;
+
+        if (lineMinY < clipMaxY && lineLength > 0 && visibleColumns > 0.f)
+        {
+            line.m_text         = reinterpret_cast<unsigned char const*>(text + lineBegin);
+            line.m_minY         = lineMinY > clipMinY ? lineMinY : clipMinY;
+            line.m_maxY         = lineMaxY < clipMaxY ? lineMaxY : clipMaxY;
+            line.m_vBottomInset = (line.m_minY - lineMinY) * vPerUnit;
+            line.m_vTopInset    = (lineMaxY - line.m_maxY) * vPerUnit;
+
+            int const beginColumn = clipMinX > line.m_originX ? static_cast<int>((clipMinX - line.m_originX) / cellWidth) : 0;
+            int const endColumn   = visibleColumns < static_cast<float>(lineLength) ? static_cast<int>(ceilf(visibleColumns)) : lineLength;
+
+            vertCount = isSIMD ? BuildGlyphRangeSIMD(line, beginColumn, endColumn, outVerts, vertCount, maxVertCount)
+                               : BuildGlyphRange(line, beginColumn, endColumn, outVerts, vertCount, maxVertCount);
+        }
+
+        lineBegin = lineEnd + 1;
+    }
+
+    return vertCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+int BuildTextVertsScalar(Vertex_PCU* outVerts, int const maxVertCount, sTextMeshDesc const& desc, char const* text, int const textLength)
+{
+    return BuildTextVertsWithKernel(outVerts, maxVertCount, desc, text, textLength, false);
+}
+
+//----------------------------------------------------------------------------------------------------
+int BuildTextVertsSIMD(Vertex_PCU* outVerts, int const maxVertCount, sTextMeshDesc const& desc, char const* text, int const textLength)
+{
+    return BuildTextVertsWithKernel(outVerts, maxVertCount, desc, text, textLength, true);
+}
+
+//----------------------------------------------------------------------------------------------------
+int BuildTextVerts(Vertex_PCU* outVerts, int const maxVertCount, sTextMeshDesc const& desc, char const* text, int const textLength)
+{
+#if defined(TEXT_MESH_SSE)
+    return BuildTextVertsSIMD(outVerts, maxVertCount, desc, text, textLength);
+#else
+    return BuildTextVertsScalar(outVerts, maxVertCount, desc, text, textLength);
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+int GetMaxTextVertCount(int const textLength)
+{
+    return textLength * 6;
+}
+
+//----------------------------------------------------------------------------------------------------
+char const* GetTextMeshKernelName()
+{
+#if defined(TEXT_MESH_SSE)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+void RunTextMeshBenchmark(BitmapFont* font, std::vector<sTextMeshBenchmarkResult>& out_results)
+{
+    using BenchmarkClock = std::chrono::steady_clock;
+
+    int constexpr   LINE_COUNT                = 2000;
+    int constexpr   LINE_LENGTH               = 96;
+    int constexpr   TARGET_GLYPHS_PER_VARIANT = 20000000;
+    float constexpr CELL_HEIGHT               = 16.f;
+    AABB2 const     consoleBox(0.f, 0.f, 1600.f, 900.f);
+
+    // The newest line sits at the bottom of the console, as the dev console draws its log.
+    std::vector<std::string> lines(LINE_COUNT);
+    std::string              block;
+    block.reserve(static_cast<size_t>(LINE_COUNT) * (LINE_LENGTH + 1));
+
+    for (int lineIndex = 0; lineIndex < LINE_COUNT; ++lineIndex)
+    {
+        char buffer[LINE_LENGTH + 1];
+        snprintf(buffer, sizeof(buffer), "[%06d] LogWindow: window %d moved to (%d, %d), velocity (%.2f, %.2f), frame %d",
+                 lineIndex, lineIndex % 37, lineIndex * 13 % 2560, lineIndex * 7 % 1440, lineIndex * 0.37f, -lineIndex * 0.21f, lineIndex * 3);
+
+        lines[lineIndex] = buffer;
+        lines[lineIndex].resize(LINE_LENGTH, ' ');
+
+        block += lines[lineIndex];
+
+        if (lineIndex + 1 < LINE_COUNT)
+        {
+            block += '\n';
+        }
+    }
+
+    int const   glyphCount     = LINE_COUNT * LINE_LENGTH;
+    int const   iterationCount = TARGET_GLYPHS_PER_VARIANT / glyphCount;
+    int const   blockLength    = static_cast<int>(block.size());
+    float const firstLineMinY  = CELL_HEIGHT * static_cast<float>(LINE_COUNT - 1);
+
+    std::vector<Vertex_PCU> verts(static_cast<size_t>(GetMaxTextVertCount(blockLength)));
+    std::vector<Vertex_PCU> fontVerts;
+
+    // Anything the timed loops write feeds this sink, so the optimizer cannot drop them.
+    volatile float sink = 0.f;
+
+    struct sBenchmarkCase
+    {
+        char const*  m_name;
+        AABB2 const* m_clipBox;
+    };
+
+    sBenchmarkCase const benchmarkCases[] = {{"full", nullptr}, {"console", &consoleBox}};
+
+    for (sBenchmarkCase const& benchmarkCase : benchmarkCases)
+    {
+        sTextMeshDesc desc;
+        desc.m_textMins   = Vec2(0.f, firstLineMinY);
+        desc.m_cellHeight = CELL_HEIGHT;
+        desc.m_clipBox    = benchmarkCase.m_clipBox;
+
+        sTextMeshBenchmarkResult result;
+        result.m_caseName       = benchmarkCase.m_name;
+        result.m_glyphCount     = glyphCount;
+        result.m_iterationCount = iterationCount;
+
+        double const submittedGlyphCount = static_cast<double>(glyphCount) * iterationCount;
+
+        if (font != nullptr)
+        {
+            auto const fontStart = BenchmarkClock::now();
+            for (int iteration = 0; iteration < iterationCount; ++iteration)
+            {
+                fontVerts.clear();
+
+                for (int lineIndex = 0; lineIndex < LINE_COUNT; ++lineIndex)
+                {
+                    float const lineMinY = firstLineMinY - CELL_HEIGHT * static_cast<float>(lineIndex);
+
+                    if (benchmarkCase.m_clipBox != nullptr && (lineMinY + CELL_HEIGHT <= consoleBox.m_mins.y || lineMinY >= consoleBox.m_maxs.y))
+                    {
+                        continue;
+                    }
+
+                    font->AddVertsForText2D(fontVerts, Vec2(0.f, lineMinY), CELL_HEIGHT, lines[lineIndex]);
+                }
+            }
+            auto const fontEnd = BenchmarkClock::now();
+            sink = sink + (fontVerts.empty() ? 0.f : fontVerts.back().m_position.x);
+
+            result.m_bitmapFontGlyphsPerSecond = submittedGlyphCount / std::chrono::duration<double>(fontEnd - fontStart).count();
+        }
+
+        int vertCount = 0;
+
+        auto const scalarStart = BenchmarkClock::now();
+        for (int iteration = 0; iteration < iterationCount; ++iteration)
+        {
+            vertCount = BuildTextVertsScalar(verts.data(), static_cast<int>(verts.size()), desc, block.data(), blockLength);
+        }
+        auto const scalarEnd = BenchmarkClock::now();
+        sink = sink + (vertCount > 0 ? verts[vertCount - 1].m_position.x : 0.f);
+
+        auto const simdStart = BenchmarkClock::now();
+        for (int iteration = 0; iteration < iterationCount; ++iteration)
+        {
+            vertCount = BuildTextVertsSIMD(verts.data(), static_cast<int>(verts.size()), desc, block.data(), blockLength);
+        }
+        auto const simdEnd = BenchmarkClock::now();
+        sink = sink + (vertCount > 0 ? verts[vertCount - 1].m_position.x : 0.f);
+
+        result.m_scalarGlyphsPerSecond = submittedGlyphCount / std::chrono::duration<double>(scalarEnd - scalarStart).count();
+        result.m_simdGlyphsPerSecond   = submittedGlyphCount / std::chrono::duration<double>(simdEnd - simdStart).count();
+
+        out_results.push_back(result);
+    }
+}
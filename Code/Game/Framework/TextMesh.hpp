@@ -0,0 +1,67 @@
+//----------------------------------------------------------------------------------------------------
+// TextMesh.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vec2.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class BitmapFont;
+
+//----------------------------------------------------------------------------------------------------
+// SquirrelFixedFont (and every fixed-width font BitmapFont loads) is a 16 x 16 grid of glyphs, one
+// per byte value, with glyph 0 in the top-left cell.
+//
+int constexpr FIXED_FONT_GLYPH_COLUMNS = 16;
+int constexpr FIXED_FONT_GLYPH_ROWS    = 16;
+
+//----------------------------------------------------------------------------------------------------
+struct sTextMeshDesc
+{
+    Vec2         m_textMins;                  // Bottom-left of the first line; each '\n' moves down one cell
+    float        m_cellHeight = 20.f;
+    float        m_cellAspect = 1.f;
+    Rgba8        m_color      = Rgba8::WHITE;
+    AABB2 const* m_clipBox    = nullptr;      // Glyphs are cut to this box (UVs included); nullptr clips nothing
+};
+
+//----------------------------------------------------------------------------------------------------
+// Lays out a fixed-width string and writes 6 vertices per visible glyph straight into outVerts, with
+// the cell size and quad order of BitmapFont::AddVertsForText2D. Lines and columns entirely outside the
+// clip box are skipped without being visited, so only the glyphs on its edges pay for clipping.
+// Returns the vertex count written; when outVerts fills up, it stops after the last whole glyph.
+// BuildTextVerts picks the SSE2 kernel when this build targets x86; the explicit variants exist for the
+// benchmark and produce identical vertices.
+//
+int BuildTextVerts(Vertex_PCU* outVerts, int maxVertCount, sTextMeshDesc const& desc, char const* text, int textLength);
+int BuildTextVertsScalar(Vertex_PCU* outVerts, int maxVertCount, sTextMeshDesc const& desc, char const* text, int textLength);
+int BuildTextVertsSIMD(Vertex_PCU* outVerts, int maxVertCount, sTextMeshDesc const& desc, char const* text, int textLength);
+
+int         GetMaxTextVertCount(int textLength);     // Enough for any text of this length, unclipped
+char const* GetTextMeshKernelName();
+
+//----------------------------------------------------------------------------------------------------
+struct sTextMeshBenchmarkResult
+{
+    char const* m_caseName                  = "";
+    int         m_glyphCount                = 0;      // Glyphs submitted per pass, clipped or not
+    int         m_iterationCount            = 0;
+    double      m_bitmapFontGlyphsPerSecond = 0.0;    // 0 when no font was given
+    double      m_scalarGlyphsPerSecond     = 0.0;
+    double      m_simdGlyphsPerSecond       = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Builds a console's worth of log lines (2000 lines of 96 characters) as one unclipped block and as a
+// 1600 x 900 console window that shows only the last few dozen lines. The BitmapFont path, which has
+// no clipping, is timed per line into a std::vector the way the dev console feeds it today, and in the
+// console case is handed only the lines that overlap the window. Pass nullptr for font when none is
+// loaded (headless) to time only the builder.
+//
+void RunTextMeshBenchmark(BitmapFont* font, std::vector<sTextMeshBenchmarkResult>& out_results);
@@ -0,0 +1,332 @@
+//----------------------------------------------------------------------------------------------------
+// TextureAtlas.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/TextureAtlas.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Image.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/AssetRegistry.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Lookup file format, one record per line:
+//   page   <pageIndex> <pageImagePath> <width> <height>
+//   region <imagePath> <pageIndex> <x> <y> <width> <height>
+// Pages are listed before the regions that use them.
+//
+bool TextureAtlas::LoadLookup(char const* lookupFilePath)
+{
+    std::ifstream lookupFile(lookupFilePath);
+
+    if (!lookupFile.is_open())
+    {
+        return false;
+    }
+
+    std::string line;
+
+    while (std::getline(lookupFile, line))
+    {
+        std::istringstream lineStream(line);
+        std::string        recordType;
+
+        if (!(lineStream >> recordType) || recordType[0] == '#')
+        {
+            continue;
+        }
+
+        if (recordType == "page")
+        {
+            int               pageIndex = 0;
+            sTextureAtlasPage page;
+            lineStream >> pageIndex >> page.m_imagePath >> page.m_dimensions.x >> page.m_dimensions.y;
+
+            if (pageIndex != static_cast<int>(m_pages.size()) || page.m_dimensions.x <= 0 || page.m_dimensions.y <= 0)
+            {
+                DebuggerPrintf("TextureAtlas: bad page record \"%s\" in %s\n", line.c_str(), lookupFilePath);
+                return false;
+            }
+
+            m_pages.push_back(page);
+        }
+        else if (recordType == "region")
+        {
+            sTextureAtlasRegion region;
+            lineStream >> region.m_imagePath >> region.m_pageIndex >> region.m_texelMins.x >> region.m_texelMins.y >> region.m_texelDims.x >> region.m_texelDims.y;
+
+            if (region.m_pageIndex < 0 || region.m_pageIndex >= static_cast<int>(m_pages.size()))
+            {
+                DebuggerPrintf("TextureAtlas: region \"%s\" names missing page %d\n", region.m_imagePath.c_str(), region.m_pageIndex);
+                return false;
+            }
+
+            IntVec2 const pageDimensions = m_pages[region.m_pageIndex].m_dimensions;
+            float const   pageWidth      = static_cast<float>(pageDimensions.x);
+            float const   pageHeight     = static_cast<float>(pageDimensions.y);
+
+            region.m_uvs = AABB2(static_cast<float>(region.m_texelMins.x) / pageWidth,
+                                 static_cast<float>(region.m_texelMins.y) / pageHeight,
+                                 static_cast<float>(region.m_texelMins.x + region.m_texelDims.x) / pageWidth,
+                                 static_cast<float>(region.m_texelMins.y + region.m_texelDims.y) / pageHeight);
+
+            m_regionIndexByHash[HashAssetPath(region.m_imagePath.c_str())] = static_cast<uint32_t>(m_regions.size());
+            m_regions.push_back(region);
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+sTextureAtlasRegion const* TextureAtlas::FindRegion(uint64_t const imagePathHash) const
+{
+    auto const found = m_regionIndexByHash.find(imagePathHash);
+
+    return found != m_regionIndexByHash.end() ? &m_regions[found->second] : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+sTextureAtlasPage const& TextureAtlas::GetPage(int const pageIndex) const
+{
+    return m_pages[pageIndex];
+}
+
+//----------------------------------------------------------------------------------------------------
+int TextureAtlas::GetPageCount() const
+{
+    return static_cast<int>(m_pages.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+int TextureAtlas::GetRegionCount() const
+{
+    return static_cast<int>(m_regions.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+static int RoundUpToPowerOfTwo(int const value)
+{
+    int powerOfTwo = 1;
+
+    while (powerOfTwo < value)
+    {
+        powerOfTwo <<= 1;
+    }
+
+    return powerOfTwo;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Uncompressed 32-bit TGA, bottom-left origin, so the rows go out in Image texel order (Y-up) and
+// the Engine's loader reads them back the same way it reads a PNG. No encoder dependency needed.
+//
+static bool WriteTGA(std::string const& filePath, IntVec2 const& dimensions, std::vector<Rgba8> const& texels)
+{
+    std::ofstream file(filePath, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    uint8_t header[18] = {};
+    header[2]          = 2;     // Uncompressed true-color
+    header[12]         = static_cast<uint8_t>(dimensions.x & 0xFF);
+    header[13]         = static_cast<uint8_t>(dimensions.x >> 8);
+    header[14]         = static_cast<uint8_t>(dimensions.y & 0xFF);
+    header[15]         = static_cast<uint8_t>(dimensions.y >> 8);
+    header[16]         = 32;
+    header[17]         = 8;     // 8 alpha bits, bottom-left origin
+
+    file.write(reinterpret_cast<char const*>(header), sizeof(header));
+
+    std::vector<uint8_t> bgra(texels.size() * 4);
+
+    for (size_t texelIndex = 0; texelIndex < texels.size(); ++texelIndex)
+    {
+        bgra[texelIndex * 4 + 0] = texels[texelIndex].b;
+        bgra[texelIndex * 4 + 1] = texels[texelIndex].g;
+        bgra[texelIndex * 4 + 2] = texels[texelIndex].r;
+        bgra[texelIndex * 4 + 3] = texels[texelIndex].a;
+    }
+
+    file.write(reinterpret_cast<char const*>(bgra.data()), static_cast<std::streamsize>(bgra.size()));
+
+    return file.good();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Shelf packing: images go tallest first, left to right along a shelf as tall as its first image,
+// then onto a new shelf above, then onto a new page. Good enough for a handful of large images;
+// each image's padded cell is filled by clamping into the image, which extrudes its border texels.
+//
+int BakeTextureAtlas(char const* sourceListFilePath, char const* outputPrefix, sTextureAtlasBakeConfig const& config)
+{
+    std::ifstream sourceList(sourceListFilePath);
+
+    if (!sourceList.is_open())
+    {
+        DebuggerPrintf("BakeTextureAtlas: cannot open source list %s\n", sourceListFilePath);
+        return -1;
+    }
+
+    std::vector<std::string>            imagePaths;
+    std::vector<std::unique_ptr<Image>> images;
+    std::string                         line;
+
+    while (std::getline(sourceList, line))
+    {
+        std::istringstream lineStream(line);
+        std::string        imagePath;
+
+        if (!(lineStream >> imagePath) || imagePath[0] == '#')
+        {
+            continue;
+        }
+
+        imagePaths.push_back(imagePath);
+        images.push_back(std::make_unique<Image>(imagePath.c_str()));
+    }
+
+    int const imageCount = static_cast<int>(images.size());
+    int const padding    = config.m_paddingTexels;
+
+    std::vector<int> packOrder(static_cast<size_t>(imageCount));
+
+    for (int imageIndex = 0; imageIndex < imageCount; ++imageIndex)
+    {
+        packOrder[imageIndex] = imageIndex;
+    }
+
+    std::stable_sort(packOrder.begin(), packOrder.end(), [&images](int const a, int const b)
+    {
+        return images[a]->GetDimensions().y > images[b]->GetDimensions().y;
+    });
+
+    std::vector<sTextureAtlasRegion> regions;
+    std::vector<int>                 regionImageIndices;
+    std::vector<IntVec2>             pageUsedDimensions;
+    int                              cursorX     = 0;
+    int                              shelfY      = 0;
+    int                              shelfHeight = 0;
+
+    for (int const imageIndex : packOrder)
+    {
+        IntVec2 const dimensions = images[imageIndex]->GetDimensions();
+        int const     cellWidth  = dimensions.x + 2 * padding;
+        int const     cellHeight = dimensions.y + 2 * padding;
+
+        if (cellWidth > config.m_maxPageSize || cellHeight > config.m_maxPageSize)
+        {
+            DebuggerPrintf("BakeTextureAtlas: %s (%dx%d) exceeds the page size; left as a standalone texture\n", imagePaths[imageIndex].c_str(), dimensions.x, dimensions.y);
+            continue;
+        }
+
+        if (pageUsedDimensions.empty())
+        {
+            pageUsedDimensions.push_back(IntVec2::ZERO);
+        }
+
+        if (cursorX + cellWidth > config.m_maxPageSize)
+        {
+            shelfY      += shelfHeight;
+            cursorX     = 0;
+            shelfHeight = 0;
+        }
+
+        if (shelfY + cellHeight > config.m_maxPageSize)
+        {
+            pageUsedDimensions.push_back(IntVec2::ZERO);
+            cursorX     = 0;
+            shelfY      = 0;
+            shelfHeight = 0;
+        }
+
+        sTextureAtlasRegion region;
+        region.m_imagePath = imagePaths[imageIndex];
+        region.m_pageIndex = static_cast<int>(pageUsedDimensions.size()) - 1;
+        region.m_texelMins = IntVec2(cursorX + padding, shelfY + padding);
+        region.m_texelDims = dimensions;
+        regions.push_back(region);
+        regionImageIndices.push_back(imageIndex);
+
+        cursorX     += cellWidth;
+        shelfHeight = std::max(shelfHeight, cellHeight);
+
+        IntVec2& usedDimensions = pageUsedDimensions.back();
+        usedDimensions.x        = std::max(usedDimensions.x, cursorX);
+        usedDimensions.y        = std::max(usedDimensions.y, shelfY + shelfHeight);
+    }
+
+    int const                       pageCount = static_cast<int>(pageUsedDimensions.size());
+    std::vector<IntVec2>            pageDimensions(static_cast<size_t>(pageCount));
+    std::vector<std::vector<Rgba8>> pageTexels(static_cast<size_t>(pageCount));
+
+    for (int pageIndex = 0; pageIndex < pageCount; ++pageIndex)
+    {
+        pageDimensions[pageIndex] = IntVec2(RoundUpToPowerOfTwo(pageUsedDimensions[pageIndex].x), RoundUpToPowerOfTwo(pageUsedDimensions[pageIndex].y));
+        pageTexels[pageIndex].assign(static_cast<size_t>(pageDimensions[pageIndex].x) * pageDimensions[pageIndex].y, Rgba8(0, 0, 0, 0));
+    }
+
+    for (size_t regionIndex = 0; regionIndex < regions.size(); ++regionIndex)
+    {
+        sTextureAtlasRegion const& region    = regions[regionIndex];
+        Image const*               image     = images[regionImageIndices[regionIndex]].get();
+        IntVec2 const              pageDims  = pageDimensions[region.m_pageIndex];
+        std::vector<Rgba8>&        texels    = pageTexels[region.m_pageIndex];
+        int const                  maxImageX = region.m_texelDims.x - 1;
+        int const                  maxImageY = region.m_texelDims.y - 1;
+
+        for (int cellY = -padding; cellY <= maxImageY + padding; ++cellY)
+        {
+            for (int cellX = -padding; cellX <= maxImageX + padding; ++cellX)
+            {
+                IntVec2 const imageTexel(std::clamp(cellX, 0, maxImageX), std::clamp(cellY, 0, maxImageY));
+                int const     pageX = region.m_texelMins.x + cellX;
+                int const     pageY = region.m_texelMins.y + cellY;
+
+                texels[static_cast<size_t>(pageY) * pageDims.x + pageX] = image->GetTexelColor(imageTexel);
+            }
+        }
+    }
+
+    std::ofstream lookupFile(Stringf("%s.txt", outputPrefix));
+
+    if (!lookupFile.is_open())
+    {
+        DebuggerPrintf("BakeTextureAtlas: cannot write %s.txt\n", outputPrefix);
+        return -1;
+    }
+
+    lookupFile << "# Generated by BakeTextureAtlas from " << sourceListFilePath << "; do not edit.\n";
+
+    for (int pageIndex = 0; pageIndex < pageCount; ++pageIndex)
+    {
+        std::string const pagePath = Stringf("%s_%d.tga", outputPrefix, pageIndex);
+
+        if (!WriteTGA(pagePath, pageDimensions[pageIndex], pageTexels[pageIndex]))
+        {
+            DebuggerPrintf("BakeTextureAtlas: cannot write %s\n", pagePath.c_str());
+            return -1;
+        }
+
+        lookupFile << "page " << pageIndex << ' ' << pagePath << ' ' << pageDimensions[pageIndex].x << ' ' << pageDimensions[pageIndex].y << '\n';
+    }
+
+    for (sTextureAtlasRegion const& region : regions)
+    {
+        lookupFile << "region " << region.m_imagePath << ' ' << region.m_pageIndex << ' '
+                   << region.m_texelMins.x << ' ' << region.m_texelMins.y << ' '
+                   << region.m_texelDims.x << ' ' << region.m_texelDims.y << '\n';
+    }
+
+    return pageCount;
+}
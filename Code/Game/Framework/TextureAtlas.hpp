@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------------------------------
+// TextureAtlas.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/IntVec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sTextureAtlasBakeConfig
+{
+    int m_maxPageSize   = 4096;     // Square limit; baked pages shrink to the next power of two in Y
+    int m_paddingTexels = 2;        // Edge texels are extruded into the padding so bilinear taps stay inside
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sTextureAtlasRegion
+{
+    std::string m_imagePath;
+    int         m_pageIndex = 0;
+    IntVec2     m_texelMins = IntVec2::ZERO;     // Y-up, matching Image texel coordinates
+    IntVec2     m_texelDims = IntVec2::ZERO;
+    AABB2       m_uvs;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sTextureAtlasPage
+{
+    std::string m_imagePath;
+    IntVec2     m_dimensions = IntVec2::ZERO;
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Runtime side of the atlas: which source image lives on which page, and where.
+/// Lookups are keyed by HashAssetPath of the original image path, so an sAssetPath finds its region
+/// without touching the string. The lookup file is produced offline by BakeTextureAtlas.
+class TextureAtlas
+{
+public:
+    bool LoadLookup(char const* lookupFilePath);
+
+    sTextureAtlasRegion const* FindRegion(uint64_t imagePathHash) const;
+    sTextureAtlasPage const&   GetPage(int pageIndex) const;
+    int                        GetPageCount() const;
+    int                        GetRegionCount() const;
+
+private:
+    std::vector<sTextureAtlasPage>         m_pages;
+    std::vector<sTextureAtlasRegion>       m_regions;
+    std::unordered_map<uint64_t, uint32_t> m_regionIndexByHash;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Offline: packs the images listed in sourceListFilePath (one path per line) into pages written as
+// "<outputPrefix>_<n>.tga", and writes the lookup table to "<outputPrefix>.txt".
+// Returns the number of pages written, or -1 on failure.
+//
+int BakeTextureAtlas(char const* sourceListFilePath, char const* outputPrefix, sTextureAtlasBakeConfig const& config = sTextureAtlasBakeConfig());
@@ -0,0 +1,96 @@
+//----------------------------------------------------------------------------------------------------
+// WindowBackend.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/WindowBackend.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+#include "Game/Framework/WindowBackend_Headless.hpp"
+#include "Game/Framework/WindowBackend_Win32.hpp"
+
+//----------------------------------------------------------------------------------------------------
+WindowBackend* g_theWindowBackend = nullptr;       // Created and owned by the App
+
+//----------------------------------------------------------------------------------------------------
+void WindowBackend::SetPresentMode(eWindowPresentMode const presentMode)
+{
+    m_presentMode = presentMode;
+}
+
+//----------------------------------------------------------------------------------------------------
+eWindowPresentMode WindowBackend::GetPresentMode() const
+{
+    return m_presentMode;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool WindowBackend::PollWindowEvent(sWindowEvent& outEvent)
+{
+    if (!m_windowEvents.TryPop(outEvent))
+    {
+        return false;
+    }
+
+    double const latencySeconds = GetSchedulerTimeSeconds() - outEvent.m_timeSeconds;
+
+    ++m_drainedWindowEventCount;
+    m_totalWindowEventLatency += latencySeconds;
+
+    if (latencySeconds > m_maxWindowEventLatency)
+    {
+        m_maxWindowEventLatency = latencySeconds;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+sWindowEventStats WindowBackend::GetWindowEventStats() const
+{
+    sWindowEventStats stats;
+    stats.m_postedCount         = m_postedWindowEventCount.load(std::memory_order_relaxed);
+    stats.m_droppedCount        = m_droppedWindowEventCount.load(std::memory_order_relaxed);
+    stats.m_drainedCount        = m_drainedWindowEventCount;
+    stats.m_maxLatencySeconds   = m_maxWindowEventLatency;
+    stats.m_totalLatencySeconds = m_totalWindowEventLatency;
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+// A dropped event is lost input, not a stall: the message thread must never wait on the game thread.
+//
+bool WindowBackend::PostWindowEvent(sWindowEvent const& event)
+{
+    if (!m_windowEvents.TryPush(event))
+    {
+        m_droppedWindowEventCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    m_postedWindowEventCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC WindowBackend* WindowBackend::Create(eWindowBackendType const type, void* applicationInstanceHandle)
+{
+    switch (type)
+    {
+    case eWindowBackendType::WIN32_NATIVE:
+#if defined(_WIN32) && !defined(GAME_HEADLESS)
+        return new Win32WindowBackend(applicationInstanceHandle);
+#else
+        ERROR_AND_DIE("WindowBackend::Create: WIN32_NATIVE backend is not available in this build")
+#endif
+
+    case eWindowBackendType::HEADLESS:
+        UNUSED(applicationInstanceHandle)
+        return new HeadlessWindowBackend();
+    }
+
+    return nullptr;
+}
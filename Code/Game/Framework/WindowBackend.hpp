@@ -0,0 +1,104 @@
+//----------------------------------------------------------------------------------------------------
+// WindowBackend.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include "Game/Framework/WindowEvents.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Window;
+class WindowSlotMap;
+
+//----------------------------------------------------------------------------------------------------
+enum class eWindowBackendType : int8_t
+{
+    WIN32_NATIVE,
+    HEADLESS
+};
+
+//----------------------------------------------------------------------------------------------------
+// RENDER_PER_WINDOW: every child window presents through its own swap chain each frame.
+// COMPOSITE_SCENE:   the scene is drawn once per frame and each child window receives only the
+//                    sub-rectangle of it that lies underneath the child.
+//
+enum class eWindowPresentMode : int8_t
+{
+    RENDER_PER_WINDOW,
+    COMPOSITE_SCENE
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sChildWindowDesc
+{
+    std::string m_title;
+    IntVec2     m_position   = IntVec2::ZERO;
+    IntVec2     m_dimensions = IntVec2::ZERO;
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Platform layer for the child windows owned by App.
+/// The App only ever talks to child windows through this interface, so the same frame loop can run
+/// against real OS windows or against virtual windows backed by in-memory surfaces.
+/// Input and window-manager changes come back as sWindowEvents through one lock-free ring, produced
+/// on whatever thread the backend handles OS messages on and drained by the game thread.
+class WindowBackend
+{
+public:
+    virtual ~WindowBackend() = default;
+
+    virtual void Startup() = 0;
+    virtual void Shutdown() = 0;
+    virtual void BeginFrame() = 0;
+    virtual void EndFrame() = 0;
+
+    virtual void* CreateChildWindow(sChildWindowDesc const& desc) = 0;
+    virtual void  DestroyChildWindow(Window& window) = 0;
+    virtual bool  AttachChildWindow(Window& window) = 0;
+    virtual bool  ResizeChildWindow(Window& window) = 0;
+    virtual void  PresentChildWindow(Window const& window) = 0;
+
+    // Applies every window flagged WINDOW_DIRTY_* in one batch; returns the window-manager commits issued.
+    virtual int CommitChildWindowTransforms(WindowSlotMap& windows) = 0;
+
+    virtual void BeginComposite() = 0;
+    virtual void CompositeChildWindow(Window const& window) = 0;
+    virtual void EndComposite() = 0;
+
+    // Where a child whose frame is at framePosition (desktop pixels, as in sWindowKinematics) lands in
+    // the main window's client area, normalized and Y-up; computed, so it need not be committed yet.
+    virtual AABB2              GetChildWindowNormalizedBounds(Vec2 const& framePosition, Vec2 const& clientDimensions) const = 0;
+    virtual AABB2              GetDesktopBounds() const = 0;     // Desktop pixels, Y-down: mins is top-left
+    virtual bool               IsMainWindowFocused() const = 0;
+    virtual eWindowBackendType GetType() const = 0;
+
+    void               SetPresentMode(eWindowPresentMode presentMode);
+    eWindowPresentMode GetPresentMode() const;
+
+    bool              PollWindowEvent(sWindowEvent& outEvent);     // Game thread only; oldest first
+    sWindowEventStats GetWindowEventStats() const;
+
+    static WindowBackend* Create(eWindowBackendType type, void* applicationInstanceHandle);
+
+protected:
+    bool PostWindowEvent(sWindowEvent const& event);     // Producer thread only; false if the ring is full
+
+    eWindowPresentMode m_presentMode = eWindowPresentMode::RENDER_PER_WINDOW;
+
+    WindowEventQueue      m_windowEvents;
+    std::atomic<uint64_t> m_postedWindowEventCount{0};
+    std::atomic<uint64_t> m_droppedWindowEventCount{0};
+    uint64_t              m_drainedWindowEventCount = 0;       // Game thread only, like the two below
+    double                m_maxWindowEventLatency   = 0.0;
+    double                m_totalWindowEventLatency = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+extern WindowBackend* g_theWindowBackend;
@@ -0,0 +1,310 @@
+//----------------------------------------------------------------------------------------------------
+// WindowBackend_Headless.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/WindowBackend_Headless.hpp"
+
+#include <algorithm>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Platform/Window.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/WindowSlotMap.hpp"
+
+//----------------------------------------------------------------------------------------------------
+void HeadlessWindowBackend::Startup()
+{
+    m_sceneDimensions = IntVec2(static_cast<int>(SCREEN_SIZE_X), static_cast<int>(SCREEN_SIZE_Y));
+}
+
+//----------------------------------------------------------------------------------------------------
+void HeadlessWindowBackend::Shutdown()
+{
+    m_surfaces.clear();
+    m_scenePixels.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+// There is no OS message queue to pump; virtual windows never receive input.
+//
+void HeadlessWindowBackend::BeginFrame()
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void HeadlessWindowBackend::EndFrame()
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void* HeadlessWindowBackend::CreateChildWindow(sChildWindowDesc const& desc)
+{
+    sHeadlessSurface surface;
+    surface.m_title      = desc.m_title;
+    surface.m_position   = desc.m_position;
+    surface.m_dimensions = desc.m_dimensions;
+    surface.m_isAlive    = true;
+
+    m_surfaces.push_back(surface);
+
+    return reinterpret_cast<void*>(static_cast<uintptr_t>(m_surfaces.size()));
+}
+
+//----------------------------------------------------------------------------------------------------
+void HeadlessWindowBackend::DestroyChildWindow(Window& window)
+{
+    sHeadlessSurface* surface = GetSurface(window.m_windowHandle);
+
+    if (surface != nullptr)
+    {
+        surface->m_isAlive = false;
+        surface->m_pixels.clear();
+        surface->m_pixels.shrink_to_fit();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool HeadlessWindowBackend::AttachChildWindow(Window& window)
+{
+    sHeadlessSurface* surface = GetSurface(window.m_windowHandle);
+
+    if (surface == nullptr)
+    {
+        return false;
+    }
+
+    surface->m_pixels.assign(static_cast<size_t>(surface->m_dimensions.x) * surface->m_dimensions.y, m_clearColor);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool HeadlessWindowBackend::ResizeChildWindow(Window& window)
+{
+    return AttachChildWindow(window);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Virtual windows have no window manager; the batch is one pass over the surface rects, reported as
+// a single commit so the counters line up with the Win32 backend.
+//
+int HeadlessWindowBackend::CommitChildWindowTransforms(WindowSlotMap& windows)
+{
+    sWindowKinematics const kinematics  = windows.GetKinematics();
+    int const               windowCount = kinematics.m_count;
+    uint8_t const*          dirtyFlags  = kinematics.m_dirtyFlags;
+    bool           isCommitted = false;
+
+    for (int windowIndex = 0; windowIndex < windowCount; ++windowIndex)
+    {
+        uint8_t const dirtyFlag = dirtyFlags[windowIndex];
+
+        if (dirtyFlag == WINDOW_DIRTY_NONE)
+        {
+            continue;
+        }
+
+        Window&           window  = windows.GetWindowAt(windowIndex);
+        sHeadlessSurface* surface = GetSurface(window.m_windowHandle);
+
+        if (surface == nullptr)
+        {
+            continue;
+        }
+
+        if ((dirtyFlag & WINDOW_DIRTY_POSITION) != 0)
+        {
+            surface->m_position = IntVec2(static_cast<int>(kinematics.m_positionX[windowIndex]), static_cast<int>(kinematics.m_positionY[windowIndex]));
+        }
+
+        IntVec2 const dimensions(static_cast<int>(kinematics.m_width[windowIndex]), static_cast<int>(kinematics.m_height[windowIndex]));
+
+        if ((dirtyFlag & WINDOW_DIRTY_SIZE) != 0 && surface->m_dimensions != dimensions)
+        {
+            surface->m_dimensions = dimensions;
+            window.needsResize    = true;
+        }
+
+        isCommitted = true;
+    }
+
+    return isCommitted ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+void HeadlessWindowBackend::PresentChildWindow(Window const& window)
+{
+    sHeadlessSurface* surface = GetSurface(window.m_windowHandle);
+
+    if (surface == nullptr)
+    {
+        return;
+    }
+
+    if (!m_areSurfacesRendered)
+    {
+        std::fill(surface->m_pixels.begin(), surface->m_pixels.end(), m_clearColor);
+    }
+
+    ++surface->m_presentCount;
+    ++m_totalPresentCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Stand-in for drawing the scene once: the whole scene surface is written exactly once per frame.
+// When the surfaces are rendered, the App draws the scene into GetScenePixels() after this instead.
+//
+void HeadlessWindowBackend::BeginComposite()
+{
+    m_scenePixels.resize(static_cast<size_t>(m_sceneDimensions.x) * m_sceneDimensions.y);
+
+    if (!m_areSurfacesRendered)
+    {
+        std::fill(m_scenePixels.begin(), m_scenePixels.end(), m_clearColor);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void HeadlessWindowBackend::CompositeChildWindow(Window const& window)
+{
+    sHeadlessSurface* surface = GetSurface(window.m_windowHandle);
+
+    if (surface == nullptr || surface->m_pixels.empty())
+    {
+        return;
+    }
+
+    // Clip the window's rect against the scene; the scene origin is the desktop origin.
+    int const sourceMinX = std::max(surface->m_position.x, 0);
+    int const sourceMinY = std::max(surface->m_position.y, 0);
+    int const sourceMaxX = std::min(surface->m_position.x + surface->m_dimensions.x, m_sceneDimensions.x);
+    int const sourceMaxY = std::min(surface->m_position.y + surface->m_dimensions.y, m_sceneDimensions.y);
+
+    if (sourceMinX < sourceMaxX && sourceMinY < sourceMaxY)
+    {
+        size_t const rowLength = static_cast<size_t>(sourceMaxX - sourceMinX);
+
+        for (int sourceY = sourceMinY; sourceY < sourceMaxY; ++sourceY)
+        {
+            Rgba8 const* sourceRow      = &m_scenePixels[static_cast<size_t>(sourceY) * m_sceneDimensions.x + sourceMinX];
+            int const    destinationX   = sourceMinX - surface->m_position.x;
+            int const    destinationY   = sourceY - surface->m_position.y;
+            Rgba8*       destinationRow = &surface->m_pixels[static_cast<size_t>(destinationY) * surface->m_dimensions.x + destinationX];
+
+            std::copy_n(sourceRow, rowLength, destinationRow);
+        }
+    }
+
+    ++surface->m_presentCount;
+    ++m_totalPresentCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void HeadlessWindowBackend::EndComposite()
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+// The virtual desktop and the scene share an origin and a size, so this is a plain rescale (Y-up).
+//
+AABB2 HeadlessWindowBackend::GetChildWindowNormalizedBounds(Vec2 const& framePosition, Vec2 const& clientDimensions) const
+{
+    if (m_sceneDimensions.x <= 0 || m_sceneDimensions.y <= 0)
+    {
+        return AABB2(0.f, 0.f, 0.f, 0.f);
+    }
+
+    // Virtual windows have no frame, so the frame position is the surface's position; both are
+    // truncated to whole pixels the same way CommitChildWindowTransforms does.
+    float const sceneWidth  = static_cast<float>(m_sceneDimensions.x);
+    float const sceneHeight = static_cast<float>(m_sceneDimensions.y);
+    float const positionX   = static_cast<float>(static_cast<int>(framePosition.x));
+    float const positionY   = static_cast<float>(static_cast<int>(framePosition.y));
+
+    float const left   = positionX / sceneWidth;
+    float const top    = positionY / sceneHeight;
+    float const right  = (positionX + static_cast<float>(static_cast<int>(clientDimensions.x))) / sceneWidth;
+    float const bottom = (positionY + static_cast<float>(static_cast<int>(clientDimensions.y))) / sceneHeight;
+
+    return AABB2(left, 1.f - bottom, right, 1.f - top);
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 HeadlessWindowBackend::GetDesktopBounds() const
+{
+    return AABB2(0.f, 0.f, static_cast<float>(m_sceneDimensions.x), static_cast<float>(m_sceneDimensions.y));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool HeadlessWindowBackend::IsMainWindowFocused() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+eWindowBackendType HeadlessWindowBackend::GetType() const
+{
+    return eWindowBackendType::HEADLESS;
+}
+
+//----------------------------------------------------------------------------------------------------
+sHeadlessSurface const* HeadlessWindowBackend::GetSurface(void const* windowHandle) const
+{
+    uintptr_t const index = reinterpret_cast<uintptr_t>(windowHandle);
+
+    if (index == 0 || index > m_surfaces.size())
+    {
+        return nullptr;
+    }
+
+    sHeadlessSurface const& surface = m_surfaces[index - 1];
+
+    return surface.m_isAlive ? &surface : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+sHeadlessSurface* HeadlessWindowBackend::GetSurface(void const* windowHandle)
+{
+    return const_cast<sHeadlessSurface*>(static_cast<HeadlessWindowBackend const*>(this)->GetSurface(windowHandle));
+}
+
+//----------------------------------------------------------------------------------------------------
+int HeadlessWindowBackend::GetLiveSurfaceCount() const
+{
+    return static_cast<int>(std::count_if(m_surfaces.begin(), m_surfaces.end(), [](sHeadlessSurface const& surface) { return surface.m_isAlive; }));
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t HeadlessWindowBackend::GetTotalPresentCount() const
+{
+    return m_totalPresentCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+Rgba8* HeadlessWindowBackend::GetSurfacePixels(void const* windowHandle, IntVec2& out_dimensions)
+{
+    sHeadlessSurface* surface = GetSurface(windowHandle);
+
+    if (surface == nullptr || surface->m_pixels.empty())
+    {
+        out_dimensions = IntVec2::ZERO;
+        return nullptr;
+    }
+
+    out_dimensions = surface->m_dimensions;
+
+    return surface->m_pixels.data();
+}
+
+//----------------------------------------------------------------------------------------------------
+Rgba8* HeadlessWindowBackend::GetScenePixels()
+{
+    return m_scenePixels.empty() ? nullptr : m_scenePixels.data();
+}
+
+//----------------------------------------------------------------------------------------------------
+IntVec2 HeadlessWindowBackend::GetSceneDimensions() const
+{
+    return m_sceneDimensions;
+}
@@ -0,0 +1,75 @@
+//----------------------------------------------------------------------------------------------------
+// WindowBackend_Headless.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Game/Framework/WindowBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sHeadlessSurface
+{
+    std::string        m_title;
+    IntVec2            m_position     = IntVec2::ZERO;
+    IntVec2            m_dimensions   = IntVec2::ZERO;
+    std::vector<Rgba8> m_pixels;
+    uint64_t           m_presentCount = 0;
+    bool               m_isAlive      = false;
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Virtual child windows for machines without a display server.
+/// Each window is an in-memory RGBA8 surface; the native handle stored in Window::m_windowHandle is
+/// an opaque 1-based index into m_surfaces, never a real OS handle.
+/// In COMPOSITE_SCENE mode a single scene surface is produced per frame and each window copies the
+/// rows of it that lie under the window's desktop position.
+/// With m_areSurfacesRendered set, a software RenderDevice draws the real frame into the writable
+/// surface and scene pixels, and Present/BeginComposite no longer fill them with m_clearColor.
+class HeadlessWindowBackend : public WindowBackend
+{
+public:
+    void Startup() override;
+    void Shutdown() override;
+    void BeginFrame() override;
+    void EndFrame() override;
+
+    void* CreateChildWindow(sChildWindowDesc const& desc) override;
+    void  DestroyChildWindow(Window& window) override;
+    bool  AttachChildWindow(Window& window) override;
+    bool  ResizeChildWindow(Window& window) override;
+    void  PresentChildWindow(Window const& window) override;
+
+    int CommitChildWindowTransforms(WindowSlotMap& windows) override;
+
+    void BeginComposite() override;
+    void CompositeChildWindow(Window const& window) override;
+    void EndComposite() override;
+
+    AABB2              GetChildWindowNormalizedBounds(Vec2 const& framePosition, Vec2 const& clientDimensions) const override;
+    AABB2              GetDesktopBounds() const override;
+    bool               IsMainWindowFocused() const override;
+    eWindowBackendType GetType() const override;
+
+    sHeadlessSurface const* GetSurface(void const* windowHandle) const;
+    int                     GetLiveSurfaceCount() const;
+    uint64_t                GetTotalPresentCount() const;
+
+    Rgba8*  GetSurfacePixels(void const* windowHandle, IntVec2& out_dimensions);     // nullptr when the window has no surface
+    Rgba8*  GetScenePixels();                                                      // Valid between BeginComposite and EndComposite
+    IntVec2 GetSceneDimensions() const;
+
+    Rgba8 m_clearColor          = Rgba8::BLUE;
+    bool  m_areSurfacesRendered = false;
+
+private:
+    sHeadlessSurface* GetSurface(void const* windowHandle);
+
+    std::vector<sHeadlessSurface> m_surfaces;
+    uint64_t                      m_totalPresentCount = 0;
+    std::vector<Rgba8>            m_scenePixels;
+    IntVec2                       m_sceneDimensions   = IntVec2::ZERO;
+};
@@ -0,0 +1,538 @@
+//----------------------------------------------------------------------------------------------------
+// WindowBackend_Win32.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/WindowBackend_Win32.hpp"
+
+#if defined(_WIN32) && !defined(GAME_HEADLESS)
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Input/InputSystem.hpp"
+#include "Engine/Platform/Window.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/WindowSlotMap.hpp"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <dxgi.h>
+
+//----------------------------------------------------------------------------------------------------
+// Sent by the game thread to the control window; SendMessage blocks until the message thread has
+// handled them, so a returned handle is ready to use. Only window creation and destruction go this
+// way, since a window belongs to the thread that creates it. Swap chains are the Renderer's, and the
+// game thread creates, resizes and presents them itself, so a frame makes no cross-thread calls.
+//
+UINT constexpr WM_CREATE_CHILD_WINDOW  = WM_APP + 1;     // lParam: sChildWindowDesc const*; returns the HWND
+UINT constexpr WM_DESTROY_CHILD_WINDOW = WM_APP + 2;     // lParam: HWND
+
+//----------------------------------------------------------------------------------------------------
+// GAME_SAFE_RELEASE for reference-counted DXGI objects, which are Released rather than deleted.
+//
+template <typename T>
+static void DX_SAFE_RELEASE(T*& dxObject)
+{
+    if (dxObject != nullptr)
+    {
+        dxObject->Release();
+        dxObject = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Both window classes carry the backend in GWLP_USERDATA, set from CreateWindowEx's lpParam.
+//
+static Win32WindowBackend* GetWindowBackend(HWND const hwnd, UINT const message, LPARAM const lParam)
+{
+    if (message == WM_NCCREATE)
+    {
+        CREATESTRUCT const* createStruct = reinterpret_cast<CREATESTRUCT const*>(lParam);
+        SetWindowLongPtr(hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(createStruct->lpCreateParams));
+    }
+
+    return reinterpret_cast<Win32WindowBackend*>(GetWindowLongPtr(hwnd, GWLP_USERDATA));
+}
+
+//----------------------------------------------------------------------------------------------------
+static LRESULT CALLBACK ChildWindowProc(HWND const hwnd, UINT const message, WPARAM const wParam, LPARAM const lParam)
+{
+    Win32WindowBackend* backend = GetWindowBackend(hwnd, message, lParam);
+
+    if (backend != nullptr && backend->TranslateChildWindowMessage(hwnd, message, wParam, lParam))
+    {
+        return 0;
+    }
+
+    return DefWindowProc(hwnd, message, wParam, lParam);
+}
+
+//----------------------------------------------------------------------------------------------------
+static LRESULT CALLBACK ControlWindowProc(HWND const hwnd, UINT const message, WPARAM const wParam, LPARAM const lParam)
+{
+    Win32WindowBackend* backend = GetWindowBackend(hwnd, message, lParam);
+
+    switch (message)
+    {
+    case WM_CREATE_CHILD_WINDOW:
+        return reinterpret_cast<LRESULT>(backend->CreateChildWindowOnMessageThread(*reinterpret_cast<sChildWindowDesc const*>(lParam)));
+
+    case WM_DESTROY_CHILD_WINDOW:
+        DestroyWindow(reinterpret_cast<HWND>(lParam));
+        return 0;
+
+    case WM_CLOSE:
+        DestroyWindow(hwnd);
+        PostQuitMessage(0);
+        return 0;
+
+    default:
+        return DefWindowProc(hwnd, message, wParam, lParam);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+Win32WindowBackend::Win32WindowBackend(void* applicationInstanceHandle)
+    : m_applicationInstanceHandle(applicationInstanceHandle)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+// Returns once the message thread's control window exists, so CreateChildWindow can follow at once.
+//
+void Win32WindowBackend::Startup()
+{
+    std::promise<void*> controlWindowPromise;
+    std::future<void*>  controlWindowFuture = controlWindowPromise.get_future();
+
+    m_messageThread       = std::thread(&Win32WindowBackend::RunMessageThread, this, &controlWindowPromise);
+    m_controlWindowHandle = controlWindowFuture.get();
+
+    if (m_controlWindowHandle == nullptr)
+    {
+        ERROR_AND_DIE("Win32WindowBackend: could not create the message thread's control window")
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// WM_CLOSE rather than a thread message: a thread message posted while the message thread sits in a
+// modal size/move loop would be dropped by that loop's pump.
+//
+void Win32WindowBackend::Shutdown()
+{
+    if (m_messageThread.joinable())
+    {
+        PostMessage(static_cast<HWND>(m_controlWindowHandle), WM_CLOSE, 0, 0);
+        m_messageThread.join();
+        m_controlWindowHandle = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Child window messages are pumped on the message thread; App drains the resulting events.
+//
+void Win32WindowBackend::BeginFrame()
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void Win32WindowBackend::EndFrame()
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+// Windows belong to the thread that creates them, and only that thread receives their messages.
+//
+void* Win32WindowBackend::CreateChildWindow(sChildWindowDesc const& desc)
+{
+    return reinterpret_cast<void*>(SendToMessageThread(WM_CREATE_CHILD_WINDOW, &desc));
+}
+
+//----------------------------------------------------------------------------------------------------
+void* Win32WindowBackend::CreateChildWindowOnMessageThread(sChildWindowDesc const& desc)
+{
+    // 調整視窗大小，確保客戶區域是指定的 width 和 height
+    RECT rect = {0, 0, desc.m_dimensions.x, desc.m_dimensions.y};
+    AdjustWindowRectEx(&rect, WS_OVERLAPPEDWINDOW, FALSE, 0);
+
+    int const adjustedWidth  = rect.right - rect.left;
+    int const adjustedHeight = rect.bottom - rect.top;
+
+    WCHAR windowTitle[256];
+    MultiByteToWideChar(CP_UTF8, 0, desc.m_title.c_str(), -1, windowTitle, sizeof(windowTitle) / sizeof(windowTitle[0]));
+
+    HWND const hwnd = CreateWindowEx(
+        0,
+        L"GameWindow",
+        windowTitle,
+        WS_OVERLAPPEDWINDOW,
+        desc.m_position.x, desc.m_position.y, adjustedWidth, adjustedHeight,
+        nullptr,
+        nullptr,
+        static_cast<HINSTANCE>(m_applicationInstanceHandle),
+        this
+    );
+
+    if (hwnd)
+    {
+        ShowWindow(hwnd, SW_SHOW);
+    }
+
+    return hwnd;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The swap chain and display context go first, while the window still exists; ReleaseDC has to run
+// on the thread that called GetDC, which is this one.
+//
+void Win32WindowBackend::DestroyChildWindow(Window& window)
+{
+    HWND const hwnd = static_cast<HWND>(window.m_windowHandle);
+
+    if (hwnd == nullptr)
+    {
+        return;
+    }
+
+    DX_SAFE_RELEASE(window.m_swapChain);
+
+    if (window.m_displayContext != nullptr)
+    {
+        ReleaseDC(hwnd, static_cast<HDC>(window.m_displayContext));
+        window.m_displayContext = nullptr;
+    }
+
+    SendToMessageThread(WM_DESTROY_CHILD_WINDOW, hwnd);
+    window.m_windowHandle = nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+// A swap chain may be created for a window another thread owns; presenting to it never waits on that
+// thread's message pump in windowed mode, so a child held in a modal size/move loop does not stall the
+// frame.
+//
+bool Win32WindowBackend::AttachChildWindow(Window& window)
+{
+    window.m_displayContext = GetDC(static_cast<HWND>(window.m_windowHandle));
+
+    HRESULT const hr = g_theRenderer->CreateWindowSwapChain(window);
+
+    if (FAILED(hr))
+    {
+        DebuggerPrintf("Failed to create window swap chain: 0x%08X\n", hr);
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Win32WindowBackend::ResizeChildWindow(Window& window)
+{
+    HRESULT const hr = g_theRenderer->ResizeWindowSwapChain(window);
+
+    if (FAILED(hr))
+    {
+        DebuggerPrintf("Failed to resize window swap chain: 0x%08X\n", hr);
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// One SetWindowPos per dirty window, each with SWP_ASYNCWINDOWPOS: the request is posted to the
+// message thread that owns the window and the game thread never waits for it, even while that thread
+// sits in a user's modal size/move loop. (A DeferWindowPos batch would be synchronous: EndDeferWindowPos
+// blocks until the owning thread has applied every position.)
+//
+int Win32WindowBackend::CommitChildWindowTransforms(WindowSlotMap& windows)
+{
+    sWindowKinematics const kinematics  = windows.GetKinematics();
+    int const               windowCount = kinematics.m_count;
+    uint8_t const*          dirtyFlags  = kinematics.m_dirtyFlags;
+
+    int commitCount = 0;
+
+    for (int windowIndex = 0; windowIndex < windowCount; ++windowIndex)
+    {
+        uint8_t const dirtyFlag = dirtyFlags[windowIndex];
+
+        if (dirtyFlag == WINDOW_DIRTY_NONE)
+        {
+            continue;
+        }
+
+        Window&    window = windows.GetWindowAt(windowIndex);
+        HWND const hwnd   = static_cast<HWND>(window.m_windowHandle);
+        UINT       flags  = SWP_NOZORDER | SWP_NOOWNERZORDER | SWP_NOACTIVATE | SWP_ASYNCWINDOWPOS;
+
+        if ((dirtyFlag & WINDOW_DIRTY_POSITION) == 0) flags |= SWP_NOMOVE;
+        if ((dirtyFlag & WINDOW_DIRTY_SIZE) == 0) flags |= SWP_NOSIZE;
+
+        // Dimensions are client size; the window manager wants the outer frame size.
+        RECT rect = {0, 0, static_cast<int>(kinematics.m_width[windowIndex]), static_cast<int>(kinematics.m_height[windowIndex])};
+        AdjustWindowRectEx(&rect, WS_OVERLAPPEDWINDOW, FALSE, 0);
+
+        int const x      = static_cast<int>(kinematics.m_positionX[windowIndex]);
+        int const y      = static_cast<int>(kinematics.m_positionY[windowIndex]);
+        int const width  = rect.right - rect.left;
+        int const height = rect.bottom - rect.top;
+
+        SetWindowPos(hwnd, nullptr, x, y, width, height, flags);
+        ++commitCount;
+
+        if ((dirtyFlag & WINDOW_DIRTY_SIZE) != 0)
+        {
+            window.needsResize = true;
+        }
+    }
+
+    return commitCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The Engine has no per-window render target: the child's view was drawn into the region of the main
+// back buffer underneath the child, and RenderViewportToWindow copies that region into the child's
+// swap chain and presents it before returning. App::Render relies on that to let the main view clear
+// the back buffer afterwards.
+//
+void Win32WindowBackend::PresentChildWindow(Window const& window)
+{
+    g_theRenderer->RenderViewportToWindow(window);
+}
+
+//----------------------------------------------------------------------------------------------------
+// The scene is the main window's back buffer, drawn by App::Render before any child composites and
+// presented only at Renderer::EndFrame, so there is nothing to capture.
+//
+void Win32WindowBackend::BeginComposite()
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+// RenderViewportToWindow copies the part of the back buffer that lies underneath the window's client
+// area into the window's swap chain on the GPU and presents it; parts outside the main window keep
+// the swap chain's clear color.
+//
+void Win32WindowBackend::CompositeChildWindow(Window const& window)
+{
+    g_theRenderer->RenderViewportToWindow(window);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Win32WindowBackend::EndComposite()
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+// Child client rect relative to the main window's client rect, normalized and flipped to Y-up so it
+// maps straight onto the scene camera's orthographic bounds. Built from the position the next
+// CommitChildWindowTransforms will request rather than from the OS rect, which lags a frame behind:
+// the client origin sits inside the frame by the same border AdjustWindowRectEx adds to size it.
+//
+AABB2 Win32WindowBackend::GetChildWindowNormalizedBounds(Vec2 const& framePosition, Vec2 const& clientDimensions) const
+{
+    HWND const mainWindowHandle = static_cast<HWND>(g_theWindow->GetWindowHandle());
+
+    RECT frameBorder = {0, 0, 0, 0};
+    AdjustWindowRectEx(&frameBorder, WS_OVERLAPPEDWINDOW, FALSE, 0);
+
+    POINT mainOrigin = {0, 0};
+    ClientToScreen(mainWindowHandle, &mainOrigin);
+
+    RECT mainClientRect;
+    GetClientRect(mainWindowHandle, &mainClientRect);
+
+    float const mainWidth    = static_cast<float>(mainClientRect.right > 0 ? mainClientRect.right : 1);
+    float const mainHeight   = static_cast<float>(mainClientRect.bottom > 0 ? mainClientRect.bottom : 1);
+    int const   childOriginX = static_cast<int>(framePosition.x) - frameBorder.left;
+    int const   childOriginY = static_cast<int>(framePosition.y) - frameBorder.top;
+
+    float const left   = static_cast<float>(childOriginX - mainOrigin.x) / mainWidth;
+    float const top    = static_cast<float>(childOriginY - mainOrigin.y) / mainHeight;
+    float const right  = left + static_cast<float>(static_cast<int>(clientDimensions.x)) / mainWidth;
+    float const bottom = top + static_cast<float>(static_cast<int>(clientDimensions.y)) / mainHeight;
+
+    return AABB2(left, 1.f - bottom, right, 1.f - top);
+}
+
+//----------------------------------------------------------------------------------------------------
+// The primary monitor's work area, so drifting windows stay clear of the taskbar.
+//
+AABB2 Win32WindowBackend::GetDesktopBounds() const
+{
+    RECT workArea;
+    SystemParametersInfo(SPI_GETWORKAREA, 0, &workArea, 0);
+
+    return AABB2(static_cast<float>(workArea.left), static_cast<float>(workArea.top),
+                 static_cast<float>(workArea.right), static_cast<float>(workArea.bottom));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Win32WindowBackend::IsMainWindowFocused() const
+{
+    return GetActiveWindow() == g_theWindow->GetWindowHandle();
+}
+
+//----------------------------------------------------------------------------------------------------
+eWindowBackendType Win32WindowBackend::GetType() const
+{
+    return eWindowBackendType::WIN32_NATIVE;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Runs on the message thread for every child window message. Only what the frame loop acts on is
+// posted; everything still goes on to DefWindowProc except WM_CLOSE, which would destroy a window
+// the App still owns. Moves are reported only while the user drags: the drift commits in
+// CommitChildWindowTransforms move windows every frame, and echoing those back would fight them.
+//
+bool Win32WindowBackend::TranslateChildWindowMessage(void* windowHandle, uint32_t const message, uintptr_t const wParam, intptr_t const lParam)
+{
+    sWindowEvent event;
+    event.m_timeSeconds  = GetSchedulerTimeSeconds();
+    event.m_windowHandle = windowHandle;
+
+    switch (message)
+    {
+    case WM_KEYDOWN:
+        event.m_type    = eWindowEventType::KEY_DOWN;
+        event.m_keyCode = static_cast<uint8_t>(wParam);
+        break;
+
+    case WM_KEYUP:
+        event.m_type    = eWindowEventType::KEY_UP;
+        event.m_keyCode = static_cast<uint8_t>(wParam);
+        break;
+
+    case WM_LBUTTONDOWN:
+    case WM_RBUTTONDOWN:
+        event.m_type    = eWindowEventType::KEY_DOWN;
+        event.m_keyCode = message == WM_LBUTTONDOWN ? KEYCODE_LEFT_MOUSE : KEYCODE_RIGHT_MOUSE;
+        break;
+
+    case WM_LBUTTONUP:
+    case WM_RBUTTONUP:
+        event.m_type    = eWindowEventType::KEY_UP;
+        event.m_keyCode = message == WM_LBUTTONUP ? KEYCODE_LEFT_MOUSE : KEYCODE_RIGHT_MOUSE;
+        break;
+
+    case WM_CHAR:
+        event.m_type      = eWindowEventType::CHAR;
+        event.m_codePoint = static_cast<uint32_t>(wParam);     // UTF-16 code unit, as the engine's WNDPROC passes it on
+        break;
+
+    case WM_ENTERSIZEMOVE:
+        m_isInSizeMove = true;
+        event.m_type   = eWindowEventType::SIZE_MOVE_BEGIN;
+        break;
+
+    case WM_EXITSIZEMOVE:
+        m_isInSizeMove = false;
+        return false;
+
+    case WM_MOVE:
+        {
+            if (!m_isInSizeMove)
+            {
+                return false;
+            }
+
+            RECT windowRect;
+            GetWindowRect(static_cast<HWND>(windowHandle), &windowRect);
+
+            event.m_type = eWindowEventType::MOVED;
+            event.m_x    = windowRect.left;
+            event.m_y    = windowRect.top;
+            break;
+        }
+
+    case WM_SIZE:
+        if (wParam == SIZE_MINIMIZED)
+        {
+            return false;
+        }
+
+        event.m_type = eWindowEventType::RESIZED;
+        event.m_x    = LOWORD(lParam);
+        event.m_y    = HIWORD(lParam);
+        break;
+
+    case WM_CLOSE:
+        event.m_type = eWindowEventType::CLOSE_REQUESTED;
+        PostWindowEvent(event);
+        return true;
+
+    default:
+        return false;
+    }
+
+    PostWindowEvent(event);
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// GetMessage keeps this thread asleep between messages. Child windows are gone by the time the
+// control window is closed, since App destroys them before shutting the backend down.
+//
+void Win32WindowBackend::RunMessageThread(std::promise<void*>* controlWindowPromise)
+{
+    RegisterWindowClasses();
+
+    HWND const controlWindowHandle = CreateWindowEx(0, L"GameWindowControl", nullptr, 0, 0, 0, 0, 0, HWND_MESSAGE, nullptr,
+                                                    static_cast<HINSTANCE>(m_applicationInstanceHandle), this);
+
+    controlWindowPromise->set_value(controlWindowHandle);
+
+    if (controlWindowHandle == nullptr)
+    {
+        return;
+    }
+
+    MSG message;
+
+    while (GetMessage(&message, nullptr, 0, 0) > 0)
+    {
+        TranslateMessage(&message);
+        DispatchMessage(&message);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Sent messages are dispatched even from inside a modal size/move loop, so this never waits for the
+// user to let go of a window.
+//
+intptr_t Win32WindowBackend::SendToMessageThread(uint32_t const message, void const* const payload) const
+{
+    return SendMessage(static_cast<HWND>(m_controlWindowHandle), message, 0, reinterpret_cast<LPARAM>(payload));
+}
+
+//----------------------------------------------------------------------------------------------------
+void Win32WindowBackend::RegisterWindowClasses()
+{
+    if (m_isClassRegistered)
+    {
+        return;
+    }
+
+    WNDCLASS wc      = {};
+    wc.lpfnWndProc   = ChildWindowProc;
+    wc.hInstance     = static_cast<HINSTANCE>(m_applicationInstanceHandle);
+    wc.lpszClassName = L"GameWindow";
+    wc.hbrBackground = (HBRUSH)(COLOR_WINDOW + 1);
+    wc.hCursor       = LoadCursor(nullptr, IDC_ARROW);
+
+    RegisterClass(&wc);
+
+    WNDCLASS controlClass      = {};
+    controlClass.lpfnWndProc   = ControlWindowProc;
+    controlClass.hInstance     = static_cast<HINSTANCE>(m_applicationInstanceHandle);
+    controlClass.lpszClassName = L"GameWindowControl";
+
+    RegisterClass(&controlClass);
+    m_isClassRegistered = true;
+}
+
+#endif // defined(_WIN32) && !defined(GAME_HEADLESS)
@@ -0,0 +1,67 @@
+//----------------------------------------------------------------------------------------------------
+// WindowBackend_Win32.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <future>
+#include <thread>
+
+#include "Game/Framework/WindowBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Child windows are real Win32 windows owned by a dedicated message thread.
+/// The message thread creates and destroys them (on request from the game thread, which waits
+/// meanwhile) and pumps their messages, translating input and window-manager changes into
+/// sWindowEvents for the game thread to drain. Their swap chains stay with the Renderer on the game
+/// thread, so a frame never waits on the message thread. A user dragging or resizing a child window
+/// puts only the message thread into the OS's modal size/move loop; the frame loop and every other
+/// window keep running.
+/// Every child window presents through its own Renderer swap chain. In COMPOSITE_SCENE mode the
+/// main window's back buffer is the scene: once the main view has been drawn into it, each child's
+/// swap chain receives a GPU copy of the part that lies underneath the child, before the main
+/// window presents, so children show the same frame as the main window.
+class Win32WindowBackend : public WindowBackend
+{
+public:
+    explicit Win32WindowBackend(void* applicationInstanceHandle);
+
+    void Startup() override;
+    void Shutdown() override;
+    void BeginFrame() override;
+    void EndFrame() override;
+
+    void* CreateChildWindow(sChildWindowDesc const& desc) override;
+    void  DestroyChildWindow(Window& window) override;
+    bool  AttachChildWindow(Window& window) override;
+    bool  ResizeChildWindow(Window& window) override;
+    void  PresentChildWindow(Window const& window) override;
+
+    int CommitChildWindowTransforms(WindowSlotMap& windows) override;
+
+    void BeginComposite() override;
+    void CompositeChildWindow(Window const& window) override;
+    void EndComposite() override;
+
+    AABB2              GetChildWindowNormalizedBounds(Vec2 const& framePosition, Vec2 const& clientDimensions) const override;
+    AABB2              GetDesktopBounds() const override;
+    bool               IsMainWindowFocused() const override;
+    eWindowBackendType GetType() const override;
+
+    // Message thread only; called from the window procedures.
+    void* CreateChildWindowOnMessageThread(sChildWindowDesc const& desc);
+    bool  TranslateChildWindowMessage(void* windowHandle, uint32_t message, uintptr_t wParam, intptr_t lParam);
+
+private:
+    void     RunMessageThread(std::promise<void*>* controlWindowPromise);
+    void     RegisterWindowClasses();
+    intptr_t SendToMessageThread(uint32_t message, void const* payload) const;     // Blocks until the message thread has handled it
+
+    void*       m_applicationInstanceHandle = nullptr;
+    bool        m_isClassRegistered         = false;
+    std::thread m_messageThread;
+    void*       m_controlWindowHandle       = nullptr;     // Message-only window; create / destroy requests are sent to it
+    bool        m_isInSizeMove              = false;       // Message thread only
+};
@@ -0,0 +1,55 @@
+//----------------------------------------------------------------------------------------------------
+// WindowEvents.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+#include "Game/Framework/SPSCQueue.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class eWindowEventType : uint8_t
+{
+    KEY_DOWN,               // m_keyCode; mouse buttons arrive as KEYCODE_LEFT_MOUSE / KEYCODE_RIGHT_MOUSE
+    KEY_UP,                 // m_keyCode
+    CHAR,                   // m_codePoint
+    MOVED,                  // m_x, m_y: new desktop position of the window frame; only user drags are reported
+    RESIZED,                // m_x, m_y: new client width and height
+    SIZE_MOVE_BEGIN,        // The user grabbed the window's frame or title bar
+    CLOSE_REQUESTED
+};
+
+//----------------------------------------------------------------------------------------------------
+// One OS window message, reduced to what the frame loop needs. m_timeSeconds is on the
+// GetSchedulerTimeSeconds clock, stamped when the message was handled on the message thread.
+//
+struct sWindowEvent
+{
+    double           m_timeSeconds  = 0.0;
+    void*            m_windowHandle = nullptr;     // Native handle; matches Window::m_windowHandle
+    int32_t          m_x            = 0;
+    int32_t          m_y            = 0;
+    uint32_t         m_codePoint    = 0;
+    eWindowEventType m_type         = eWindowEventType::KEY_DOWN;
+    uint8_t          m_keyCode      = 0;
+};
+
+static_assert(sizeof(sWindowEvent) <= 32, "sWindowEvent should stay two to a cache line");
+
+//----------------------------------------------------------------------------------------------------
+// A key-mashing user produces a few dozen events per frame; a drag a few hundred per second.
+//
+using WindowEventQueue = SPSCQueue<sWindowEvent, 1024>;
+
+//----------------------------------------------------------------------------------------------------
+struct sWindowEventStats
+{
+    uint64_t m_postedCount         = 0;
+    uint64_t m_droppedCount        = 0;       // Ring full; the game thread fell more than 1024 events behind
+    uint64_t m_drainedCount        = 0;
+    double   m_maxLatencySeconds   = 0.0;     // Message handled to event drained
+    double   m_totalLatencySeconds = 0.0;
+
+    double GetAverageLatencySeconds() const { return m_drainedCount > 0 ? m_totalLatencySeconds / static_cast<double>(m_drainedCount) : 0.0; }
+};
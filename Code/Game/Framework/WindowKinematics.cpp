@@ -0,0 +1,332 @@
+//----------------------------------------------------------------------------------------------------
+// WindowKinematics.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/WindowKinematics.hpp"
+
+#include <chrono>
+#include <cmath>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Platform/Window.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define WINDOW_KINEMATICS_SSE
+#if defined(__AVX__)
+#define WINDOW_KINEMATICS_AVX
+#endif
+#endif
+
+//----------------------------------------------------------------------------------------------------
+// Shared by the scalar kernel and the SIMD kernels' remainder loop, so all paths agree bit for bit.
+//
+static int IntegrateWindowDriftRange(sWindowKinematics const& kinematics, AABB2 const& desktopBounds, float const deltaSeconds, int const beginIndex, int const endIndex)
+{
+    int movedCount = 0;
+
+    for (int windowIndex = beginIndex; windowIndex < endIndex; ++windowIndex)
+    {
+        float& positionX = kinematics.m_positionX[windowIndex];
+        float& positionY = kinematics.m_positionY[windowIndex];
+        float& velocityX = kinematics.m_velocityX[windowIndex];
+        float& velocityY = kinematics.m_velocityY[windowIndex];
+
+        if (velocityX == 0.f && velocityY == 0.f)
+        {
+            continue;
+        }
+
+        float const maxX = desktopBounds.m_maxs.x - kinematics.m_width[windowIndex];
+        float const maxY = desktopBounds.m_maxs.y - kinematics.m_height[windowIndex];
+
+        positionX += velocityX * deltaSeconds;
+        positionY += velocityY * deltaSeconds;
+
+        if (positionX < desktopBounds.m_mins.x) { positionX = desktopBounds.m_mins.x; velocityX = fabsf(velocityX); }
+        if (positionY < desktopBounds.m_mins.y) { positionY = desktopBounds.m_mins.y; velocityY = fabsf(velocityY); }
+        if (positionX > maxX) { positionX = maxX; velocityX = -fabsf(velocityX); }
+        if (positionY > maxY) { positionY = maxY; velocityY = -fabsf(velocityY); }
+
+        kinematics.m_dirtyFlags[windowIndex] |= WINDOW_DIRTY_POSITION;
+        ++movedCount;
+    }
+
+    return movedCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int FlagMovedLanes(uint8_t* dirtyFlags, int laneMask)
+{
+    int movedCount = 0;
+
+    for (int lane = 0; laneMask != 0; ++lane, laneMask >>= 1)
+    {
+        if ((laneMask & 1) != 0)
+        {
+            dirtyFlags[lane] |= WINDOW_DIRTY_POSITION;
+            ++movedCount;
+        }
+    }
+
+    return movedCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+int IntegrateWindowDriftScalar(sWindowKinematics const& kinematics, AABB2 const& desktopBounds, float const deltaSeconds)
+{
+    return IntegrateWindowDriftRange(kinematics, desktopBounds, deltaSeconds, 0, kinematics.m_count);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Branch-free version of IntegrateWindowDriftRange: the edge reflections become compare masks, and
+// windows at rest keep their old state through a final select so they are never clamped or flagged.
+//
+int IntegrateWindowDriftSIMD(sWindowKinematics const& kinematics, AABB2 const& desktopBounds, float const deltaSeconds)
+{
+    int windowIndex = 0;
+    int movedCount  = 0;
+
+#if defined(WINDOW_KINEMATICS_AVX)
+    {
+        __m256 const deltaSeconds8 = _mm256_set1_ps(deltaSeconds);
+        __m256 const minX8         = _mm256_set1_ps(desktopBounds.m_mins.x);
+        __m256 const minY8         = _mm256_set1_ps(desktopBounds.m_mins.y);
+        __m256 const desktopMaxX8  = _mm256_set1_ps(desktopBounds.m_maxs.x);
+        __m256 const desktopMaxY8  = _mm256_set1_ps(desktopBounds.m_maxs.y);
+        __m256 const signMask8     = _mm256_set1_ps(-0.f);
+        __m256 const zero8         = _mm256_setzero_ps();
+
+        for (; windowIndex + 8 <= kinematics.m_count; windowIndex += 8)
+        {
+            __m256 const oldPositionX = _mm256_loadu_ps(kinematics.m_positionX + windowIndex);
+            __m256 const oldPositionY = _mm256_loadu_ps(kinematics.m_positionY + windowIndex);
+            __m256 const oldVelocityX = _mm256_loadu_ps(kinematics.m_velocityX + windowIndex);
+            __m256 const oldVelocityY = _mm256_loadu_ps(kinematics.m_velocityY + windowIndex);
+            __m256 const maxX         = _mm256_sub_ps(desktopMaxX8, _mm256_loadu_ps(kinematics.m_width + windowIndex));
+            __m256 const maxY         = _mm256_sub_ps(desktopMaxY8, _mm256_loadu_ps(kinematics.m_height + windowIndex));
+
+            __m256 const isMoving  = _mm256_or_ps(_mm256_cmp_ps(oldVelocityX, zero8, _CMP_NEQ_UQ), _mm256_cmp_ps(oldVelocityY, zero8, _CMP_NEQ_UQ));
+            __m256       velocityX = oldVelocityX;
+            __m256       velocityY = oldVelocityY;
+
+            __m256 positionX = _mm256_add_ps(oldPositionX, _mm256_mul_ps(velocityX, deltaSeconds8));
+            __m256 positionY = _mm256_add_ps(oldPositionY, _mm256_mul_ps(velocityY, deltaSeconds8));
+
+            __m256 const isBelowX = _mm256_cmp_ps(positionX, minX8, _CMP_LT_OQ);
+            __m256 const isBelowY = _mm256_cmp_ps(positionY, minY8, _CMP_LT_OQ);
+            positionX             = _mm256_blendv_ps(positionX, minX8, isBelowX);
+            positionY             = _mm256_blendv_ps(positionY, minY8, isBelowY);
+            velocityX             = _mm256_blendv_ps(velocityX, _mm256_andnot_ps(signMask8, velocityX), isBelowX);
+            velocityY             = _mm256_blendv_ps(velocityY, _mm256_andnot_ps(signMask8, velocityY), isBelowY);
+
+            __m256 const isAboveX = _mm256_cmp_ps(positionX, maxX, _CMP_GT_OQ);
+            __m256 const isAboveY = _mm256_cmp_ps(positionY, maxY, _CMP_GT_OQ);
+            positionX             = _mm256_blendv_ps(positionX, maxX, isAboveX);
+            positionY             = _mm256_blendv_ps(positionY, maxY, isAboveY);
+            velocityX             = _mm256_blendv_ps(velocityX, _mm256_or_ps(signMask8, velocityX), isAboveX);
+            velocityY             = _mm256_blendv_ps(velocityY, _mm256_or_ps(signMask8, velocityY), isAboveY);
+
+            _mm256_storeu_ps(kinematics.m_positionX + windowIndex, _mm256_blendv_ps(oldPositionX, positionX, isMoving));
+            _mm256_storeu_ps(kinematics.m_positionY + windowIndex, _mm256_blendv_ps(oldPositionY, positionY, isMoving));
+            _mm256_storeu_ps(kinematics.m_velocityX + windowIndex, _mm256_blendv_ps(oldVelocityX, velocityX, isMoving));
+            _mm256_storeu_ps(kinematics.m_velocityY + windowIndex, _mm256_blendv_ps(oldVelocityY, velocityY, isMoving));
+
+            movedCount += FlagMovedLanes(kinematics.m_dirtyFlags + windowIndex, _mm256_movemask_ps(isMoving));
+        }
+    }
+#endif
+
+#if defined(WINDOW_KINEMATICS_SSE)
+    {
+        __m128 const deltaSeconds4 = _mm_set1_ps(deltaSeconds);
+        __m128 const minX4         = _mm_set1_ps(desktopBounds.m_mins.x);
+        __m128 const minY4         = _mm_set1_ps(desktopBounds.m_mins.y);
+        __m128 const desktopMaxX4  = _mm_set1_ps(desktopBounds.m_maxs.x);
+        __m128 const desktopMaxY4  = _mm_set1_ps(desktopBounds.m_maxs.y);
+        __m128 const signMask4     = _mm_set1_ps(-0.f);
+        __m128 const zero4         = _mm_setzero_ps();
+
+        // SSE2 has no blendv; select(mask, a, b) = (mask & a) | (~mask & b).
+        auto const select = [](__m128 const mask, __m128 const ifTrue, __m128 const ifFalse) { return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse)); };
+
+        for (; windowIndex + 4 <= kinematics.m_count; windowIndex += 4)
+        {
+            __m128 const oldPositionX = _mm_loadu_ps(kinematics.m_positionX + windowIndex);
+            __m128 const oldPositionY = _mm_loadu_ps(kinematics.m_positionY + windowIndex);
+            __m128 const oldVelocityX = _mm_loadu_ps(kinematics.m_velocityX + windowIndex);
+            __m128 const oldVelocityY = _mm_loadu_ps(kinematics.m_velocityY + windowIndex);
+            __m128 const maxX         = _mm_sub_ps(desktopMaxX4, _mm_loadu_ps(kinematics.m_width + windowIndex));
+            __m128 const maxY         = _mm_sub_ps(desktopMaxY4, _mm_loadu_ps(kinematics.m_height + windowIndex));
+
+            __m128 const isMoving  = _mm_or_ps(_mm_cmpneq_ps(oldVelocityX, zero4), _mm_cmpneq_ps(oldVelocityY, zero4));
+            __m128       velocityX = oldVelocityX;
+            __m128       velocityY = oldVelocityY;
+
+            __m128 positionX = _mm_add_ps(oldPositionX, _mm_mul_ps(velocityX, deltaSeconds4));
+            __m128 positionY = _mm_add_ps(oldPositionY, _mm_mul_ps(velocityY, deltaSeconds4));
+
+            __m128 const isBelowX = _mm_cmplt_ps(positionX, minX4);
+            __m128 const isBelowY = _mm_cmplt_ps(positionY, minY4);
+            positionX             = select(isBelowX, minX4, positionX);
+            positionY             = select(isBelowY, minY4, positionY);
+            velocityX             = select(isBelowX, _mm_andnot_ps(signMask4, velocityX), velocityX);
+            velocityY             = select(isBelowY, _mm_andnot_ps(signMask4, velocityY), velocityY);
+
+            __m128 const isAboveX = _mm_cmpgt_ps(positionX, maxX);
+            __m128 const isAboveY = _mm_cmpgt_ps(positionY, maxY);
+            positionX             = select(isAboveX, maxX, positionX);
+            positionY             = select(isAboveY, maxY, positionY);
+            velocityX             = select(isAboveX, _mm_or_ps(signMask4, velocityX), velocityX);
+            velocityY             = select(isAboveY, _mm_or_ps(signMask4, velocityY), velocityY);
+
+            _mm_storeu_ps(kinematics.m_positionX + windowIndex, select(isMoving, positionX, oldPositionX));
+            _mm_storeu_ps(kinematics.m_positionY + windowIndex, select(isMoving, positionY, oldPositionY));
+            _mm_storeu_ps(kinematics.m_velocityX + windowIndex, select(isMoving, velocityX, oldVelocityX));
+            _mm_storeu_ps(kinematics.m_velocityY + windowIndex, select(isMoving, velocityY, oldVelocityY));
+
+            movedCount += FlagMovedLanes(kinematics.m_dirtyFlags + windowIndex, _mm_movemask_ps(isMoving));
+        }
+    }
+#endif
+
+    return movedCount + IntegrateWindowDriftRange(kinematics, desktopBounds, deltaSeconds, windowIndex, kinematics.m_count);
+}
+
+//----------------------------------------------------------------------------------------------------
+int IntegrateWindowDrift(sWindowKinematics const& kinematics, AABB2 const& desktopBounds, float const deltaSeconds)
+{
+#if defined(WINDOW_KINEMATICS_SSE)
+    return IntegrateWindowDriftSIMD(kinematics, desktopBounds, deltaSeconds);
+#else
+    return IntegrateWindowDriftScalar(kinematics, desktopBounds, deltaSeconds);
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+char const* GetWindowDriftKernelName()
+{
+#if defined(WINDOW_KINEMATICS_AVX)
+    return "AVX";
+#elif defined(WINDOW_KINEMATICS_SSE)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+// Stand-in for the old layout: drift state lived inside each Window, next to its config strings and
+// native handles, and was advanced one object at a time.
+//
+struct sDriftingWindowObject
+{
+    void UpdateWindowDrift(float const deltaSeconds, AABB2 const& desktopBounds)
+    {
+        Vec2 const maxPosition = desktopBounds.m_maxs - Vec2(static_cast<float>(m_dimensions.x), static_cast<float>(m_dimensions.y));
+
+        m_position += m_velocity * deltaSeconds;
+
+        if (m_position.x < desktopBounds.m_mins.x) { m_position.x = desktopBounds.m_mins.x; m_velocity.x = fabsf(m_velocity.x); }
+        if (m_position.y < desktopBounds.m_mins.y) { m_position.y = desktopBounds.m_mins.y; m_velocity.y = fabsf(m_velocity.y); }
+        if (m_position.x > maxPosition.x) { m_position.x = maxPosition.x; m_velocity.x = -fabsf(m_velocity.x); }
+        if (m_position.y > maxPosition.y) { m_position.y = maxPosition.y; m_velocity.y = -fabsf(m_velocity.y); }
+    }
+
+    sWindowConfig m_config;
+    void*         m_windowHandle   = nullptr;
+    void*         m_displayContext = nullptr;
+    Vec2          m_position;
+    Vec2          m_velocity;
+    IntVec2       m_dimensions;
+    bool          needsUpdate      = false;
+    bool          needsResize      = false;
+};
+
+//----------------------------------------------------------------------------------------------------
+void RunWindowDriftBenchmark(std::vector<sWindowDriftBenchmarkResult>& out_results)
+{
+    using BenchmarkClock = std::chrono::steady_clock;
+
+    int constexpr   WINDOW_COUNTS[]            = {10, 1000, 100000};
+    int constexpr   TARGET_UPDATES_PER_VARIANT = 20000000;
+    float constexpr DELTA_SECONDS              = 1.f / 60.f;
+    AABB2 const     desktopBounds(0.f, 0.f, 2560.f, 1440.f);
+
+    // Anything the timed loops write feeds this sink, so the optimizer cannot drop them.
+    volatile float sink = 0.f;
+
+    for (int const windowCount : WINDOW_COUNTS)
+    {
+        int const iterationCount = TARGET_UPDATES_PER_VARIANT / windowCount;
+
+        std::vector<sDriftingWindowObject> objects(windowCount);
+        std::vector<float>                 positionX(windowCount), positionY(windowCount), velocityX(windowCount), velocityY(windowCount);
+        std::vector<float>                 width(windowCount, 400.f), height(windowCount, 300.f);
+        std::vector<uint8_t>               dirtyFlags(windowCount, WINDOW_DIRTY_NONE);
+
+        for (int windowIndex = 0; windowIndex < windowCount; ++windowIndex)
+        {
+            float const seed = static_cast<float>(windowIndex);
+
+            objects[windowIndex].m_position   = Vec2(fmodf(seed * 37.f, 2000.f), fmodf(seed * 53.f, 1000.f));
+            objects[windowIndex].m_velocity   = Vec2(60.f + fmodf(seed * 7.f, 120.f), -60.f - fmodf(seed * 11.f, 120.f));
+            objects[windowIndex].m_dimensions = IntVec2(400, 300);
+
+            positionX[windowIndex] = objects[windowIndex].m_position.x;
+            positionY[windowIndex] = objects[windowIndex].m_position.y;
+            velocityX[windowIndex] = objects[windowIndex].m_velocity.x;
+            velocityY[windowIndex] = objects[windowIndex].m_velocity.y;
+        }
+
+        sWindowKinematics kinematics;
+        kinematics.m_positionX  = positionX.data();
+        kinematics.m_positionY  = positionY.data();
+        kinematics.m_velocityX  = velocityX.data();
+        kinematics.m_velocityY  = velocityY.data();
+        kinematics.m_width      = width.data();
+        kinematics.m_height     = height.data();
+        kinematics.m_dirtyFlags = dirtyFlags.data();
+        kinematics.m_count      = windowCount;
+
+        double const updateCount = static_cast<double>(windowCount) * iterationCount;
+
+        auto const perObjectStart = BenchmarkClock::now();
+        for (int iteration = 0; iteration < iterationCount; ++iteration)
+        {
+            for (sDriftingWindowObject& object : objects)
+            {
+                object.UpdateWindowDrift(DELTA_SECONDS, desktopBounds);
+            }
+        }
+        auto const perObjectEnd = BenchmarkClock::now();
+        sink = sink + objects[windowCount - 1].m_position.x;
+
+        auto const scalarStart = BenchmarkClock::now();
+        for (int iteration = 0; iteration < iterationCount; ++iteration)
+        {
+            IntegrateWindowDriftScalar(kinematics, desktopBounds, DELTA_SECONDS);
+        }
+        auto const scalarEnd = BenchmarkClock::now();
+        sink = sink + positionX[windowCount - 1];
+
+        auto const simdStart = BenchmarkClock::now();
+        for (int iteration = 0; iteration < iterationCount; ++iteration)
+        {
+            IntegrateWindowDriftSIMD(kinematics, desktopBounds, DELTA_SECONDS);
+        }
+        auto const simdEnd = BenchmarkClock::now();
+        sink = sink + positionX[windowCount - 1];
+
+        sWindowDriftBenchmarkResult result;
+        result.m_windowCount          = windowCount;
+        result.m_iterationCount       = iterationCount;
+        result.m_perObjectNanoseconds = std::chrono::duration<double, std::nano>(perObjectEnd - perObjectStart).count() / updateCount;
+        result.m_scalarSoANanoseconds = std::chrono::duration<double, std::nano>(scalarEnd - scalarStart).count() / updateCount;
+        result.m_simdSoANanoseconds   = std::chrono::duration<double, std::nano>(simdEnd - simdStart).count() / updateCount;
+
+        out_results.push_back(result);
+    }
+}
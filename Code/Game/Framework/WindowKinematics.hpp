@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------------------------------
+// WindowKinematics.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/AABB2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Bits of sWindowKinematics::m_dirtyFlags; set by whoever changes a window, cleared by whoever commits it.
+//
+uint8_t constexpr WINDOW_DIRTY_NONE     = 0;
+uint8_t constexpr WINDOW_DIRTY_POSITION = 1u << 0;
+uint8_t constexpr WINDOW_DIRTY_SIZE     = 1u << 1;
+
+//----------------------------------------------------------------------------------------------------
+// Structure-of-arrays view of every window's hot state; all arrays have m_count elements.
+// Positions are the desktop position of the window in pixels (Y-down), velocities are pixels per
+// second, and width / height are the client size in pixels.
+//
+struct sWindowKinematics
+{
+    float*   m_positionX  = nullptr;
+    float*   m_positionY  = nullptr;
+    float*   m_velocityX  = nullptr;
+    float*   m_velocityY  = nullptr;
+    float*   m_width      = nullptr;
+    float*   m_height     = nullptr;
+    uint8_t* m_dirtyFlags = nullptr;
+    int      m_count      = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Integrates drift and reflects windows off the desktop edges. Every window with a non-zero velocity
+// is flagged WINDOW_DIRTY_POSITION; the return value is how many were flagged.
+// IntegrateWindowDrift picks the widest kernel this build was compiled for (AVX, then SSE2, then
+// scalar); the explicit variants exist for the benchmark and produce identical results.
+//
+int IntegrateWindowDrift(sWindowKinematics const& kinematics, AABB2 const& desktopBounds, float deltaSeconds);
+int IntegrateWindowDriftScalar(sWindowKinematics const& kinematics, AABB2 const& desktopBounds, float deltaSeconds);
+int IntegrateWindowDriftSIMD(sWindowKinematics const& kinematics, AABB2 const& desktopBounds, float deltaSeconds);
+
+char const* GetWindowDriftKernelName();
+
+//----------------------------------------------------------------------------------------------------
+struct sWindowDriftBenchmarkResult
+{
+    int    m_windowCount          = 0;
+    int    m_iterationCount       = 0;
+    double m_perObjectNanoseconds = 0.0;     // Per window per update
+    double m_scalarSoANanoseconds = 0.0;
+    double m_simdSoANanoseconds   = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Times the old per-object drift loop against the scalar and SIMD SoA kernels for 10, 1k and 100k
+// simulated windows. No OS windows are created; only the drift math is measured.
+//
+void RunWindowDriftBenchmark(std::vector<sWindowDriftBenchmarkResult>& out_results);
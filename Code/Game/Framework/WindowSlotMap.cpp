@@ -0,0 +1,229 @@
+//----------------------------------------------------------------------------------------------------
+// WindowSlotMap.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/WindowSlotMap.hpp"
+
+//----------------------------------------------------------------------------------------------------
+sWindowHandle WindowSlotMap::Add(sWindowConfig const& config, void* nativeHandle, Vec2 const& position, IntVec2 const& dimensions)
+{
+    uint32_t slotIndex;
+
+    if (m_firstFreeSlot != sWindowHandle::INVALID_SLOT_INDEX)
+    {
+        slotIndex       = m_firstFreeSlot;
+        m_firstFreeSlot = m_slots[slotIndex].m_nextFreeSlot;
+    }
+    else
+    {
+        slotIndex = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+        m_windowStorage.emplace_back();
+    }
+
+    Window& window        = m_windowStorage[slotIndex].emplace(config);
+    window.m_windowHandle = nativeHandle;
+
+    sSlot& slot         = m_slots[slotIndex];
+    slot.m_denseIndex   = static_cast<uint32_t>(m_denseSlots.size());
+    slot.m_nextFreeSlot = sWindowHandle::INVALID_SLOT_INDEX;
+    slot.m_nativeHandle = nativeHandle;
+
+    m_denseSlots.push_back(slotIndex);
+    m_denseWindows.push_back(&window);
+    m_positionX.push_back(position.x);
+    m_positionY.push_back(position.y);
+    m_velocityX.push_back(0.f);
+    m_velocityY.push_back(0.f);
+    m_width.push_back(static_cast<float>(dimensions.x));
+    m_height.push_back(static_cast<float>(dimensions.y));
+    m_dirtyFlags.push_back(WINDOW_DIRTY_NONE);
+
+    sWindowHandle handle;
+    handle.m_slotIndex  = slotIndex;
+    handle.m_generation = slot.m_generation;
+
+    if (nativeHandle != nullptr)
+    {
+        m_nativeHandleToWindow[nativeHandle] = handle;
+    }
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Swap-and-pop: the last dense window moves into the removed window's dense index.
+// The Window object itself never moves; only the dense bookkeeping does.
+//
+bool WindowSlotMap::Remove(sWindowHandle const handle)
+{
+    if (!IsAlive(handle))
+    {
+        return false;
+    }
+
+    sSlot&         slot           = m_slots[handle.m_slotIndex];
+    uint32_t const denseIndex     = slot.m_denseIndex;
+    uint32_t const lastDenseIndex = static_cast<uint32_t>(m_denseSlots.size() - 1);
+
+    if (denseIndex != lastDenseIndex)
+    {
+        uint32_t const movedSlotIndex = m_denseSlots[lastDenseIndex];
+
+        m_denseSlots[denseIndex]   = movedSlotIndex;
+        m_denseWindows[denseIndex] = m_denseWindows[lastDenseIndex];
+        m_positionX[denseIndex]    = m_positionX[lastDenseIndex];
+        m_positionY[denseIndex]    = m_positionY[lastDenseIndex];
+        m_velocityX[denseIndex]    = m_velocityX[lastDenseIndex];
+        m_velocityY[denseIndex]    = m_velocityY[lastDenseIndex];
+        m_width[denseIndex]        = m_width[lastDenseIndex];
+        m_height[denseIndex]       = m_height[lastDenseIndex];
+        m_dirtyFlags[denseIndex]   = m_dirtyFlags[lastDenseIndex];
+
+        m_slots[movedSlotIndex].m_denseIndex = denseIndex;
+    }
+
+    m_denseSlots.pop_back();
+    m_denseWindows.pop_back();
+    m_positionX.pop_back();
+    m_positionY.pop_back();
+    m_velocityX.pop_back();
+    m_velocityY.pop_back();
+    m_width.pop_back();
+    m_height.pop_back();
+    m_dirtyFlags.pop_back();
+
+    m_nativeHandleToWindow.erase(slot.m_nativeHandle);
+    m_windowStorage[handle.m_slotIndex].reset();
+
+    ++slot.m_generation;
+    slot.m_denseIndex   = sWindowHandle::INVALID_SLOT_INDEX;
+    slot.m_nextFreeSlot = m_firstFreeSlot;
+    slot.m_nativeHandle = nullptr;
+    m_firstFreeSlot     = handle.m_slotIndex;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Bumps every live slot's generation so no handle issued before Clear() resolves afterwards.
+//
+void WindowSlotMap::Clear()
+{
+    while (!m_denseSlots.empty())
+    {
+        uint32_t const slotIndex = m_denseSlots.back();
+
+        sWindowHandle handle;
+        handle.m_slotIndex  = slotIndex;
+        handle.m_generation = m_slots[slotIndex].m_generation;
+
+        Remove(handle);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only the dense arrays are reserved; window storage is a deque and grows without relocating.
+//
+void WindowSlotMap::Reserve(int const windowCount)
+{
+    size_t const capacity = static_cast<size_t>(windowCount);
+
+    m_slots.reserve(capacity);
+    m_denseSlots.reserve(capacity);
+    m_denseWindows.reserve(capacity);
+    m_positionX.reserve(capacity);
+    m_positionY.reserve(capacity);
+    m_velocityX.reserve(capacity);
+    m_velocityY.reserve(capacity);
+    m_width.reserve(capacity);
+    m_height.reserve(capacity);
+    m_dirtyFlags.reserve(capacity);
+    m_nativeHandleToWindow.reserve(capacity);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool WindowSlotMap::IsAlive(sWindowHandle const handle) const
+{
+    if (handle.m_slotIndex >= m_slots.size())
+    {
+        return false;
+    }
+
+    sSlot const& slot = m_slots[handle.m_slotIndex];
+
+    return slot.m_generation == handle.m_generation && slot.m_denseIndex != sWindowHandle::INVALID_SLOT_INDEX;
+}
+
+//----------------------------------------------------------------------------------------------------
+Window* WindowSlotMap::Get(sWindowHandle const handle)
+{
+    return IsAlive(handle) ? &*m_windowStorage[handle.m_slotIndex] : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+Window const* WindowSlotMap::Get(sWindowHandle const handle) const
+{
+    return IsAlive(handle) ? &*m_windowStorage[handle.m_slotIndex] : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+sWindowHandle WindowSlotMap::FindByNativeHandle(void* nativeHandle) const
+{
+    auto const found = m_nativeHandleToWindow.find(nativeHandle);
+
+    return found != m_nativeHandleToWindow.end() ? found->second : sWindowHandle();
+}
+
+//----------------------------------------------------------------------------------------------------
+int WindowSlotMap::GetDenseIndex(sWindowHandle const handle) const
+{
+    return IsAlive(handle) ? static_cast<int>(m_slots[handle.m_slotIndex].m_denseIndex) : -1;
+}
+
+//----------------------------------------------------------------------------------------------------
+int WindowSlotMap::GetCount() const
+{
+    return static_cast<int>(m_denseSlots.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+Window& WindowSlotMap::GetWindowAt(int const denseIndex)
+{
+    return *m_denseWindows[denseIndex];
+}
+
+//----------------------------------------------------------------------------------------------------
+Window const& WindowSlotMap::GetWindowAt(int const denseIndex) const
+{
+    return *m_denseWindows[denseIndex];
+}
+
+//----------------------------------------------------------------------------------------------------
+sWindowHandle WindowSlotMap::GetHandleAt(int const denseIndex) const
+{
+    uint32_t const slotIndex = m_denseSlots[denseIndex];
+
+    sWindowHandle handle;
+    handle.m_slotIndex  = slotIndex;
+    handle.m_generation = m_slots[slotIndex].m_generation;
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+sWindowKinematics WindowSlotMap::GetKinematics()
+{
+    sWindowKinematics kinematics;
+    kinematics.m_positionX  = m_positionX.data();
+    kinematics.m_positionY  = m_positionY.data();
+    kinematics.m_velocityX  = m_velocityX.data();
+    kinematics.m_velocityY  = m_velocityY.data();
+    kinematics.m_width      = m_width.data();
+    kinematics.m_height     = m_height.data();
+    kinematics.m_dirtyFlags = m_dirtyFlags.data();
+    kinematics.m_count      = GetCount();
+
+    return kinematics;
+}
@@ -0,0 +1,92 @@
+//----------------------------------------------------------------------------------------------------
+// WindowSlotMap.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Platform/Window.hpp"
+#include "Game/Framework/WindowKinematics.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Generational handle to a child window. A handle whose window was removed stays invalid forever,
+// even after its slot is reused, because the slot's generation has moved on.
+//
+struct sWindowHandle
+{
+    static uint32_t constexpr INVALID_SLOT_INDEX = 0xFFFFFFFFu;
+
+    bool IsValid() const { return m_slotIndex != INVALID_SLOT_INDEX; }
+    bool operator==(sWindowHandle const& other) const { return m_slotIndex == other.m_slotIndex && m_generation == other.m_generation; }
+    bool operator!=(sWindowHandle const& other) const { return !(*this == other); }
+
+    uint32_t m_slotIndex  = INVALID_SLOT_INDEX;
+    uint32_t m_generation = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Owns every child Window with stable addresses and O(1) add / remove / lookup.
+/// Windows live in a per-slot deque and are constructed in place, so adding a window never moves or
+/// copies the others (their native handles and swap-chain state stay where the Renderer left them).
+/// Live windows are also packed into a dense order: hot per-frame state (position, velocity, size,
+/// dirty flags) is kept as structure-of-arrays indexed by dense index (see GetKinematics), and
+/// removal is a swap-and-pop.
+/// Dense indices are only stable until the next Remove; hold an sWindowHandle across frames instead.
+class WindowSlotMap
+{
+public:
+    WindowSlotMap() = default;
+    WindowSlotMap(WindowSlotMap const&)            = delete;
+    WindowSlotMap& operator=(WindowSlotMap const&) = delete;
+
+    sWindowHandle Add(sWindowConfig const& config, void* nativeHandle, Vec2 const& position, IntVec2 const& dimensions);
+    bool          Remove(sWindowHandle handle);
+    void          Clear();
+    void          Reserve(int windowCount);
+
+    bool          IsAlive(sWindowHandle handle) const;
+    Window*       Get(sWindowHandle handle);
+    Window const* Get(sWindowHandle handle) const;
+    sWindowHandle FindByNativeHandle(void* nativeHandle) const;
+    int           GetDenseIndex(sWindowHandle handle) const;
+
+    int           GetCount() const;
+    Window&       GetWindowAt(int denseIndex);
+    Window const& GetWindowAt(int denseIndex) const;
+    sWindowHandle GetHandleAt(int denseIndex) const;
+
+    sWindowKinematics GetKinematics();     // Valid until the next Add / Remove / Clear
+
+private:
+    struct sSlot
+    {
+        uint32_t m_generation   = 0;
+        uint32_t m_denseIndex   = sWindowHandle::INVALID_SLOT_INDEX;
+        uint32_t m_nextFreeSlot = sWindowHandle::INVALID_SLOT_INDEX;
+        void*    m_nativeHandle = nullptr;     // Kept here because the backend may clear Window::m_windowHandle on destroy
+    };
+
+    std::deque<std::optional<Window>> m_windowStorage;     // Indexed by slot; never shrinks, so addresses are stable
+    std::vector<sSlot>                m_slots;
+    uint32_t                          m_firstFreeSlot = sWindowHandle::INVALID_SLOT_INDEX;
+
+    std::vector<uint32_t> m_denseSlots;                    // Dense index -> slot index
+    std::vector<Window*>  m_denseWindows;                  // Dense index -> window
+    std::vector<float>    m_positionX;                     // Hot state, see sWindowKinematics
+    std::vector<float>    m_positionY;
+    std::vector<float>    m_velocityX;
+    std::vector<float>    m_velocityY;
+    std::vector<float>    m_width;
+    std::vector<float>    m_height;
+    std::vector<uint8_t>  m_dirtyFlags;
+
+    std::unordered_map<void*, sWindowHandle> m_nativeHandleToWindow;
+};
@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------------------------------------
+// WindowTransformBatch.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/WindowTransformBatch.hpp"
+
+#include "Game/Framework/WindowBackend.hpp"
+#include "Game/Framework/WindowSlotMap.hpp"
+
+//----------------------------------------------------------------------------------------------------
+WindowTransformBatch::WindowTransformBatch(WindowSlotMap& windows)
+    : m_windows(windows)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void WindowTransformBatch::MoveWindow(int const denseIndex, Vec2 const& position)
+{
+    sWindowKinematics const kinematics = m_windows.GetKinematics();
+
+    kinematics.m_positionX[denseIndex] = position.x;
+    kinematics.m_positionY[denseIndex] = position.y;
+    kinematics.m_dirtyFlags[denseIndex] |= WINDOW_DIRTY_POSITION;
+    ++m_frameStats.m_requestCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void WindowTransformBatch::MoveAllWindows(Vec2 const& position)
+{
+    for (int windowIndex = 0; windowIndex < m_windows.GetCount(); ++windowIndex)
+    {
+        MoveWindow(windowIndex, position);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void WindowTransformBatch::ResizeWindow(int const denseIndex, IntVec2 const& dimensions)
+{
+    sWindowKinematics const kinematics = m_windows.GetKinematics();
+
+    kinematics.m_width[denseIndex]  = static_cast<float>(dimensions.x);
+    kinematics.m_height[denseIndex] = static_cast<float>(dimensions.y);
+    kinematics.m_dirtyFlags[denseIndex] |= WINDOW_DIRTY_SIZE;
+    ++m_frameStats.m_requestCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// For bulk writers of the kinematics arrays (the drift kernel), which flag windows themselves and
+// only report how many they moved.
+//
+void WindowTransformBatch::AddMoveRequests(int const moveCount)
+{
+    m_frameStats.m_requestCount += static_cast<uint32_t>(moveCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+void WindowTransformBatch::Commit(WindowBackend& backend)
+{
+    uint8_t*  dirtyFlags  = m_windows.GetKinematics().m_dirtyFlags;
+    int const windowCount = m_windows.GetCount();
+
+    for (int windowIndex = 0; windowIndex < windowCount; ++windowIndex)
+    {
+        if (dirtyFlags[windowIndex] != WINDOW_DIRTY_NONE)
+        {
+            ++m_frameStats.m_committedWindowCount;
+        }
+    }
+
+    if (m_frameStats.m_committedWindowCount > 0)
+    {
+        m_frameStats.m_platformCommitCount = static_cast<uint32_t>(backend.CommitChildWindowTransforms(m_windows));
+
+        for (int windowIndex = 0; windowIndex < windowCount; ++windowIndex)
+        {
+            dirtyFlags[windowIndex] = WINDOW_DIRTY_NONE;
+        }
+    }
+
+    m_totalStats.m_requestCount += m_frameStats.m_requestCount;
+    m_totalStats.m_committedWindowCount += m_frameStats.m_committedWindowCount;
+    m_totalStats.m_platformCommitCount += m_frameStats.m_platformCommitCount;
+
+    m_lastFrameStats = m_frameStats;
+    m_frameStats     = sWindowTransformStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+sWindowTransformStats const& WindowTransformBatch::GetLastFrameStats() const
+{
+    return m_lastFrameStats;
+}
+
+//----------------------------------------------------------------------------------------------------
+sWindowTransformStats const& WindowTransformBatch::GetTotalStats() const
+{
+    return m_totalStats;
+}
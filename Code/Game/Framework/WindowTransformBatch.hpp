@@ -0,0 +1,52 @@
+//----------------------------------------------------------------------------------------------------
+// WindowTransformBatch.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Vec2.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class WindowBackend;
+class WindowSlotMap;
+
+//----------------------------------------------------------------------------------------------------
+struct sWindowTransformStats
+{
+    uint32_t GetSavedPlatformCommitCount() const { return m_requestCount > m_platformCommitCount ? m_requestCount - m_platformCommitCount : 0; }
+
+    uint32_t m_requestCount         = 0;     // Move / resize requests; before batching each one was a platform call
+    uint32_t m_committedWindowCount = 0;     // Distinct windows that actually changed
+    uint32_t m_platformCommitCount  = 0;     // Window-manager commits issued by the backend
+};
+
+//----------------------------------------------------------------------------------------------------
+/// @brief
+/// Collects child window moves and resizes during the frame and commits them once, at App::EndFrame.
+/// A request only writes the window's hot state in the WindowSlotMap and sets its dirty bit, so any
+/// number of requests for one window in one frame collapse to a single change, and all dirty windows
+/// reach the OS together in one backend batch.
+class WindowTransformBatch
+{
+public:
+    explicit WindowTransformBatch(WindowSlotMap& windows);
+
+    void MoveWindow(int denseIndex, Vec2 const& position);
+    void MoveAllWindows(Vec2 const& position);
+    void ResizeWindow(int denseIndex, IntVec2 const& dimensions);
+    void AddMoveRequests(int moveCount);
+
+    void Commit(WindowBackend& backend);
+
+    sWindowTransformStats const& GetLastFrameStats() const;
+    sWindowTransformStats const& GetTotalStats() const;
+
+private:
+    WindowSlotMap&        m_windows;
+    sWindowTransformStats m_frameStats;
+    sWindowTransformStats m_lastFrameStats;
+    sWindowTransformStats m_totalStats;
+};
@@ -11,15 +11,25 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Input/InputSystem.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Platform/Window.hpp"
 #include "Engine/Renderer/DebugRenderSystem.hpp"
 #include "Engine/Renderer/Renderer.hpp"
 #include "Game/Framework/App.hpp"
+#include "Game/Framework/AssetRegistry.hpp"
+#include "Game/Framework/AudioService.hpp"
+#include "Game/Framework/DebugDrawBatch.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/RenderDevice.hpp"
+#include "Game/Framework/RetainedDebugText.hpp"
+
+//----------------------------------------------------------------------------------------------------
+float constexpr DISC_RADIUS = 300.f;
 
 //----------------------------------------------------------------------------------------------------
 Game::Game()
 {
-    g_theEventSystem->SubscribeEventCallbackFunction("OnWindowSizeChanged", OnWindowSizeChanged);
+    g_theGameEventBus->Subscribe<sWindowSizeChangedEvent, &Game::OnWindowSizeChanged>();
     m_screenCamera = new Camera();
 
     Vec2 const bottomLeft     = Vec2::ZERO;
@@ -27,12 +37,41 @@ Game::Game()
 
     m_screenCamera->SetOrthoGraphicView(bottomLeft, screenTopRight);
     m_screenCamera->SetNormalizedViewport(AABB2::ZERO_TO_ONE);
+    m_screenView.SetSceneBounds(AABB2(bottomLeft, screenTopRight));
 
     m_gameClock = new Clock(Clock::GetSystemClock());
+
+    if (g_theRenderDevice != nullptr)
+    {
+        CreatePipelineStates();
+    }
+
+    if (g_theRetainedDebugText != nullptr)
+    {
+        sDebugTextDesc textDesc;
+        textDesc.m_position = m_screenCamera->GetOrthographicTopRight() - Vec2(200.f, 60.f);
+        m_clockTextTopRight = g_theRetainedDebugText->Add(textDesc);
+
+        textDesc.m_position   = m_screenCamera->GetOrthographicBottomLeft();
+        m_clockTextBottomLeft = g_theRetainedDebugText->Add(textDesc);
+    }
+
+    if (g_theAudio != nullptr)
+    {
+        m_clickSound = g_theAssetRegistry->InternSound(ASSET_SOUND_CLICK);
+    }
 }
 
 Game::~Game()
 {
+    g_theGameEventBus->Unsubscribe<sWindowSizeChangedEvent, &Game::OnWindowSizeChanged>();
+
+    if (g_theRetainedDebugText != nullptr)
+    {
+        g_theRetainedDebugText->Remove(m_clockTextTopRight);
+        g_theRetainedDebugText->Remove(m_clockTextBottomLeft);
+    }
+
     GAME_SAFE_RELEASE(m_screenCamera);
 }
 
@@ -41,24 +80,61 @@ void Game::Update()
 {
     UpdateFromInput();
     AdjustForPauseAndTimeDistortion();
+
+    if (g_theRenderDevice != nullptr)
+    {
+        // The software rasterizer runs headless, where there is no main window to size the view by.
+        IntVec2 const clientDimensions = g_theWindow != nullptr ? g_theWindow->GetClientDimensions() : IntVec2(static_cast<int>(SCREEN_SIZE_X), static_cast<int>(SCREEN_SIZE_Y));
+        m_screenView.SetTargetDimensions(Vec2(static_cast<float>(clientDimensions.x), static_cast<float>(clientDimensions.y)));
+
+        UpdateRetainedGeometry();
+    }
+
+    if (g_theRetainedDebugText != nullptr && m_gameState == eGameState::GAME)
+    {
+        UpdateDebugText();
+    }
+
+    double const deltaSeconds = GetFrameDeltaSeconds();
+
+    if (!m_isFixedTimestepEnabled)
+    {
+        UpdateSimulation(static_cast<float>(deltaSeconds));
+        return;
+    }
+
+    // Simulation advances in fixed steps of game-clock time, independent of the render rate.
+    int const stepCount = m_simulationTimestep.ConsumeSteps(deltaSeconds);
+
+    for (int stepIndex = 0; stepIndex < stepCount; ++stepIndex)
+    {
+        UpdateSimulation(static_cast<float>(m_simulationTimestep.m_stepSeconds));
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
 void Game::Render() const
 {
     //-Start-of-Screen-Camera-------------------------------------------------------------------------
-    g_theRenderer->BeginCamera(*m_screenCamera);
+    g_theRenderDevice->BeginCamera(*m_screenCamera);
 
     if (m_gameState == eGameState::ATTRACT)
     {
-        RenderAttractMode();
+        RenderAttractMode(m_screenView);
     }
     else if (m_gameState == eGameState::GAME)
     {
-        RenderGame();
+        RenderGame(m_screenView);
     }
 
-    g_theRenderer->EndCamera(*m_screenCamera);
+    g_theDebugDrawBatch->Render();
+
+    if (m_gameState == eGameState::GAME)
+    {
+        RenderDebugText();
+    }
+
+    g_theRenderDevice->EndCamera(*m_screenCamera);
     //-End-of-Screen-Camera---------------------------------------------------------------------------
 
     if (m_gameState == eGameState::GAME)
@@ -67,11 +143,31 @@ void Game::Render() const
     }
 }
 
-bool Game::OnGameStateChanged(EventArgs& args)
+//----------------------------------------------------------------------------------------------------
+// Draws the scene through another camera (e.g. a child window's porthole), culling against its bounds.
+// Screen-space debug text belongs to the main view only and is not drawn here.
+//
+void Game::RenderView(sRenderView const& view) const
 {
-    String const newGameState = args.GetValue("OnGameStateChanged", "DEFAULT");
+    g_theRenderDevice->BeginCamera(view.m_camera);
 
-    if (newGameState == "ATTRACT")
+    if (m_gameState == eGameState::ATTRACT)
+    {
+        RenderAttractMode(view);
+    }
+    else if (m_gameState == eGameState::GAME)
+    {
+        RenderGame(view);
+    }
+
+    g_theDebugDrawBatch->Render();
+
+    g_theRenderDevice->EndCamera(view.m_camera);
+}
+
+bool Game::OnGameStateChanged(sGameStateChangedEvent const& event)
+{
+    if (event.m_newState == eGameState::ATTRACT)
     {
         App::RequestQuit();
     }
@@ -79,12 +175,18 @@ bool Game::OnGameStateChanged(EventArgs& args)
     return true;
 }
 
-bool Game::OnWindowSizeChanged(EventArgs& args)
+bool Game::OnWindowSizeChanged(sWindowSizeChangedEvent const& event)
 {
-    int newHeight = args.GetValue("newHeight", -1);
-    int newWidth  = args.GetValue("newWidth", -1);
+    int const newHeight = event.m_newDimensions.y;
+    int const newWidth  = event.m_newDimensions.x;
     DebuggerPrintf("OnWindowSizeChanged (%d, %d)\n", newWidth, newHeight);
     // g_theGame->m_screenCamera->SetViewport(AABB2(Vec2::ZERO, Vec2(newWidth, newHeight)));
+
+    if (g_theGame != nullptr)
+    {
+        g_theGame->m_isRetainedGeometryDirty = true;
+    }
+
     return true;
 }
 
@@ -93,18 +195,39 @@ eGameState Game::GetCurrentGameState() const
     return m_gameState;
 }
 
+//----------------------------------------------------------------------------------------------------
+// stepSeconds <= 0 falls back to one variable-length simulation step per rendered frame.
+//
+void Game::SetFixedTimestep(float const stepSeconds)
+{
+    m_isFixedTimestepEnabled = stepSeconds > 0.f;
+
+    if (m_isFixedTimestepEnabled)
+    {
+        m_simulationTimestep.m_stepSeconds        = static_cast<double>(stepSeconds);
+        m_simulationTimestep.m_accumulatedSeconds = 0.0;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// frameDeltaSeconds <= 0 goes back to the game clock's wall-clock delta.
+//
+void Game::SetFixedFrameDelta(double const frameDeltaSeconds)
+{
+    m_fixedFrameDeltaSeconds = frameDeltaSeconds > 0.0 ? frameDeltaSeconds : 0.0;
+}
+
 void Game::ChangeGameState(eGameState const newGameState)
 {
     if (newGameState == m_gameState) return;
 
-    EventArgs args;
-
-    if (newGameState == eGameState::ATTRACT) args.SetValue("OnGameStateChanged", "ATTRACT");
-    else if (newGameState == eGameState::GAME) args.SetValue("OnGameStateChanged", "GAME");
+    sGameStateChangedEvent event;
+    event.m_previousState = m_gameState;
+    event.m_newState      = newGameState;
 
     m_gameState = newGameState;
 
-    g_theEventSystem->FireEvent("OnGameStateChanged", args);
+    g_theGameEventBus->Fire(event);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -112,46 +235,6 @@ void Game::UpdateFromInput()
 {
     if (m_gameState == eGameState::ATTRACT)
     {
-        if (g_theInput->IsKeyDown(KEYCODE_W)) m_position.y += 10.f;
-        if (g_theInput->IsKeyDown(KEYCODE_A)) m_position.x -= 10.f;
-        if (g_theInput->IsKeyDown(KEYCODE_S)) m_position.y -= 10.f;
-        if (g_theInput->IsKeyDown(KEYCODE_D)) m_position.x += 10.f;
-        if (g_theInput->IsKeyDown(KEYCODE_L))
-        {
-            m_windowPosition.x += 10.f;
-            for (Window& window : g_theApp->windows)
-            {
-                window.UpdateWindowPosition(Vec2(m_windowPosition.x, m_windowPosition.y));
-            }
-        }
-        if (g_theInput->IsKeyDown(KEYCODE_J))
-        {
-            m_windowPosition.x -= 10.f;
-            for (Window& window : g_theApp->windows)
-            {
-                window.UpdateWindowPosition(Vec2(m_windowPosition.x, m_windowPosition.y));
-            }
-        }
-
-        if (g_theInput->IsKeyDown(KEYCODE_I))
-        {
-            m_windowPosition.y += 10.f;
-            for (Window& window : g_theApp->windows)
-            {
-                window.UpdateWindowPosition(Vec2(m_windowPosition.x, m_windowPosition.y));
-            }
-        }
-
-        if (g_theInput->IsKeyDown(KEYCODE_K))
-        {
-            m_windowPosition.y -= 10.f;
-
-            for (Window& window : g_theApp->windows)
-            {
-                window.UpdateWindowPosition(Vec2(m_windowPosition.x, m_windowPosition.y));
-            }
-        }
-
         if (g_theInput->WasKeyJustPressed(KEYCODE_ESC))
         {
             App::RequestQuit();
@@ -160,8 +243,13 @@ void Game::UpdateFromInput()
         if (g_theInput->WasKeyJustPressed(KEYCODE_SPACE))
         {
             ChangeGameState(eGameState::GAME);
-            SoundID const clickSound = g_theAudio->CreateOrGetSound("Data/Audio/TestSound.mp3", eAudioSystemSoundDimension::Sound2D);
-            g_theAudio->StartSound(clickSound, false, 1.f, 0.f, 0.5f);
+
+            if (m_clickSound.IsValid())
+            {
+                sPlaySoundParams params;
+                params.m_speed = 0.5f;
+                g_theAudioService->PlaySound(g_theAssetRegistry->GetSound(m_clickSound), params);
+            }
         }
     }
     else if (m_gameState == eGameState::GAME)
@@ -169,12 +257,51 @@ void Game::UpdateFromInput()
         if (g_theInput->WasKeyJustPressed(KEYCODE_ESC))
         {
             ChangeGameState(eGameState::ATTRACT);
-            SoundID const clickSound = g_theAudio->CreateOrGetSound("Data/Audio/TestSound.mp3", eAudioSystemSoundDimension::Sound2D);
-            g_theAudio->StartSound(clickSound);
+
+            if (m_clickSound.IsValid())
+            {
+                g_theAudioService->PlaySound(g_theAssetRegistry->GetSound(m_clickSound));
+            }
         }
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+// Continuous (held-key) movement, of the disc (WASD) and of every window (IJKL), lives here so it
+// scales with simulation time, not frame count.
+//
+void Game::UpdateSimulation(float const deltaSeconds)
+{
+    if (m_gameState != eGameState::ATTRACT)
+    {
+        return;
+    }
+
+    float constexpr DISC_SPEED     = 600.f;     // 10 units per frame at the original 60Hz
+    float constexpr WINDOW_SPEED   = 600.f;     // 10 pixels per frame at the original 60Hz
+    float const     distance       = DISC_SPEED * deltaSeconds;
+    float const     windowDistance = WINDOW_SPEED * deltaSeconds;
+
+    if (g_theInput->IsKeyDown(KEYCODE_W)) m_position.y += distance;
+    if (g_theInput->IsKeyDown(KEYCODE_A)) m_position.x -= distance;
+    if (g_theInput->IsKeyDown(KEYCODE_S)) m_position.y -= distance;
+    if (g_theInput->IsKeyDown(KEYCODE_D)) m_position.x += distance;
+
+    bool const isWindowMoved = g_theInput->IsKeyDown(KEYCODE_I) || g_theInput->IsKeyDown(KEYCODE_J) ||
+                               g_theInput->IsKeyDown(KEYCODE_K) || g_theInput->IsKeyDown(KEYCODE_L);
+
+    if (g_theInput->IsKeyDown(KEYCODE_I)) m_windowPosition.y += windowDistance;
+    if (g_theInput->IsKeyDown(KEYCODE_J)) m_windowPosition.x -= windowDistance;
+    if (g_theInput->IsKeyDown(KEYCODE_K)) m_windowPosition.y -= windowDistance;
+    if (g_theInput->IsKeyDown(KEYCODE_L)) m_windowPosition.x += windowDistance;
+
+    // One move for all held keys, rather than one per key as the per-frame version did.
+    if (isWindowMoved)
+    {
+        g_theApp->GetWindowTransforms().MoveAllWindows(m_windowPosition);
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::AdjustForPauseAndTimeDistortion()
 {
@@ -200,61 +327,168 @@ void Game::AdjustForPauseAndTimeDistortion()
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::RenderAttractMode() const
+// With a fixed frame delta the game clock still decides whether time runs this frame (pause, single
+// step) and how fast (time scale); only the amount of wall-clock time is replaced.
+//
+double Game::GetFrameDeltaSeconds() const
 {
-    VertexList_PCU verts1;
-    AddVertsForAABB2D(verts1, AABB2(Vec2::ZERO, Vec2(1920.0f, 1200.0f)));
-    g_theRenderer->SetModelConstants();
-    g_theRenderer->SetBlendMode(eBlendMode::OPAQUE);
-    g_theRenderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
-    g_theRenderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
-    g_theRenderer->SetDepthMode(eDepthMode::DISABLED);
-    g_theRenderer->BindTexture(g_theRenderer->CreateOrGetTextureFromFile("Data/Images/goop.png"));
-    g_theRenderer->BindShader(g_theRenderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
-    g_theRenderer->DrawVertexArray(verts1);
-
-    VertexList_PCU verts2;
-    AddVertsForDisc2D(verts2, Vec2(SCREEN_SIZE_X * 0.5f + m_position.x, SCREEN_SIZE_Y * 0.5f + m_position.y), 300.f, 10.f, Rgba8::YELLOW);
-    g_theRenderer->SetModelConstants();
-    g_theRenderer->SetBlendMode(eBlendMode::OPAQUE);
-    g_theRenderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
-    g_theRenderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
-    g_theRenderer->SetDepthMode(eDepthMode::DISABLED);
-    g_theRenderer->BindTexture(nullptr);
-    g_theRenderer->BindShader(g_theRenderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
-    g_theRenderer->DrawVertexArray(verts2);
+    double const clockDeltaSeconds = m_gameClock->GetDeltaSeconds();
+
+    if (m_fixedFrameDeltaSeconds <= 0.0 || clockDeltaSeconds <= 0.0)
+    {
+        return clockDeltaSeconds;
+    }
+
+    return m_fixedFrameDeltaSeconds * static_cast<double>(m_gameClock->GetTimeScale());
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::RenderGame() const
+// Regenerates and uploads the static scene geometry, but only when the screen bounds it was built
+// for have changed (or a window resize asked for it). Nothing here runs in a steady-state frame.
+//
+void Game::UpdateRetainedGeometry()
 {
-    VertexList_PCU verts1;
-    AddVertsForAABB2D(verts1, AABB2(Vec2::ZERO, Vec2(1920.0f, 1200.0f)));
-    g_theRenderer->SetModelConstants();
-    g_theRenderer->SetBlendMode(eBlendMode::OPAQUE);
-    g_theRenderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
-    g_theRenderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
-    g_theRenderer->SetDepthMode(eDepthMode::DISABLED);
-    g_theRenderer->BindTexture(g_theRenderer->CreateOrGetTextureFromFile("Data/Images/serenity.png"));
-    g_theRenderer->BindShader(g_theRenderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
-    g_theRenderer->DrawVertexArray(verts1);
-
-    VertexList_PCU verts2;
-    Vec2 const     screenBottomLeft  = m_screenCamera->GetOrthographicBottomLeft();
-    Vec2 const     screenTopRight    = m_screenCamera->GetOrthographicTopRight();
+    AABB2 const sceneBounds(m_screenCamera->GetOrthographicBottomLeft(), m_screenCamera->GetOrthographicTopRight());
+
+    bool const haveSceneBoundsChanged = sceneBounds.m_mins != m_retainedSceneBounds.m_mins || sceneBounds.m_maxs != m_retainedSceneBounds.m_maxs;
+
+    if (!m_isRetainedGeometryDirty && !haveSceneBoundsChanged)
+    {
+        return;
+    }
+
+    AABB2 const attractUVs = g_theAssetRegistry != nullptr ? g_theAssetRegistry->GetTextureUVs(m_attractBackgroundTexture) : AABB2::ZERO_TO_ONE;
+    AABB2 const gameUVs    = g_theAssetRegistry != nullptr ? g_theAssetRegistry->GetTextureUVs(m_gameBackgroundTexture) : AABB2::ZERO_TO_ONE;
+
+    VertexList_PCU backgroundVerts;
+    AddVertsForAABB2D(backgroundVerts, AABB2(Vec2::ZERO, Vec2(1920.0f, 1200.0f)), Rgba8::WHITE, attractUVs.m_mins, attractUVs.m_maxs);
+    m_attractBackgroundMesh.Build(backgroundVerts);
+
+    backgroundVerts.clear();
+    AddVertsForAABB2D(backgroundVerts, AABB2(Vec2::ZERO, Vec2(1920.0f, 1200.0f)), Rgba8::WHITE, gameUVs.m_mins, gameUVs.m_maxs);
+    m_gameBackgroundMesh.Build(backgroundVerts);
+
+    // Every LOD bucket is built up front (about 1500 verts in all); each view draws the one that
+    // matches the disc's size in its own pixels.
+    sDiscShape disc;
+    disc.m_radius = DISC_RADIUS;
+    disc.m_color  = Rgba8::YELLOW;
+
+    VertexList_PCU discVerts;
+
+    for (int lodBucket = 0; lodBucket < SHAPE_LOD_BUCKET_COUNT; ++lodBucket)
+    {
+        disc.m_segmentCount = GetShapeLODBucketSegmentCount(lodBucket);
+        discVerts.resize(static_cast<size_t>(GetDiscVertCount(disc.m_segmentCount)));
+        TessellateDiscs(discVerts.data(), static_cast<int>(discVerts.size()), &disc, 1);
+        m_discMeshes[lodBucket].Build(discVerts);
+    }
+
+    Vec2 const     screenBottomLeft  = sceneBounds.m_mins;
+    Vec2 const     screenTopRight    = sceneBounds.m_maxs;
     Vec2 const     screenBottomRight = Vec2(screenBottomLeft.x + screenTopRight.x, screenBottomLeft.y);
     Vec2 const     screenTopLeft     = Vec2(screenBottomLeft.x + screenBottomLeft.y, screenTopRight.y);
-    AddVertsForLineSegment2D(verts2, screenBottomLeft + Vec2(100, 100), screenTopRight - Vec2(100, 100), 10.f, false, Rgba8::GREEN);
-    AddVertsForLineSegment2D(verts2, screenTopLeft + Vec2(100, -100), screenBottomRight + Vec2(-100, 100), 10.f, false, Rgba8::GREEN);
-    g_theRenderer->SetModelConstants();
-    g_theRenderer->SetBlendMode(eBlendMode::OPAQUE);
-    g_theRenderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
-    g_theRenderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
-    g_theRenderer->SetDepthMode(eDepthMode::DISABLED);
-    g_theRenderer->BindTexture(nullptr);
-    g_theRenderer->BindShader(g_theRenderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
-    g_theRenderer->DrawVertexArray(verts2);
-
-    DebugAddScreenText(Stringf("Time: %.2f\nFPS: %.2f\nScale: %.1f", m_gameClock->GetTotalSeconds(), 1.f / m_gameClock->GetDeltaSeconds(), m_gameClock->GetTimeScale()), m_screenCamera->GetOrthographicTopRight() - Vec2(200.f, 60.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
-    DebugAddScreenText(Stringf("Time: %.2f\nFPS: %.2f\nScale: %.1f", m_gameClock->GetTotalSeconds(), 1.f / m_gameClock->GetDeltaSeconds(), m_gameClock->GetTimeScale()), m_screenCamera->GetOrthographicBottomLeft(), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    VertexList_PCU crossVerts;
+    AddVertsForLineSegment2D(crossVerts, screenBottomLeft + Vec2(100, 100), screenTopRight - Vec2(100, 100), 10.f, false, Rgba8::GREEN);
+    AddVertsForLineSegment2D(crossVerts, screenTopLeft + Vec2(100, -100), screenBottomRight + Vec2(-100, 100), 10.f, false, Rgba8::GREEN);
+    m_crossMesh.Build(crossVerts);
+
+    m_retainedSceneBounds     = sceneBounds;
+    m_isRetainedGeometryDirty = false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Textures and shaders are interned here, once, before the AssetRegistry is sealed. When both
+// backgrounds are on the same atlas page the two background states are identical apart from UVs,
+// so switching screens costs no texture bind. Headless software rendering registers null Textures
+// and shaders for these paths and samples CPU copies of the textures by their texture keys.
+//
+void Game::CreatePipelineStates()
+{
+    sPipelineStateDesc desc;
+    desc.m_blendMode      = eBlendMode::OPAQUE;
+    desc.m_rasterizerMode = eRasterizerMode::SOLID_CULL_BACK;
+    desc.m_samplerMode    = eSamplerMode::BILINEAR_CLAMP;
+    desc.m_depthMode      = eDepthMode::DISABLED;
+
+    desc.m_shader = g_theAssetRegistry->GetShader(g_theAssetRegistry->InternShader(ASSET_SHADER_DEFAULT));
+
+    m_attractBackgroundTexture = g_theAssetRegistry->InternTexture(ASSET_TEXTURE_GOOP);
+    m_gameBackgroundTexture    = g_theAssetRegistry->InternTexture(ASSET_TEXTURE_SERENITY);
+
+    desc.m_texture           = g_theAssetRegistry->GetTexture(m_attractBackgroundTexture);
+    desc.m_textureKey        = g_theAssetRegistry->GetTextureKey(m_attractBackgroundTexture);
+    m_attractBackgroundState = PipelineState(desc);
+
+    desc.m_texture        = g_theAssetRegistry->GetTexture(m_gameBackgroundTexture);
+    desc.m_textureKey     = g_theAssetRegistry->GetTextureKey(m_gameBackgroundTexture);
+    m_gameBackgroundState = PipelineState(desc);
+
+    desc.m_texture    = nullptr;
+    desc.m_textureKey = 0;
+    m_untexturedState = PipelineState(desc);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::RenderAttractMode(sRenderView const& view) const
+{
+    AABB2 const backgroundBounds(Vec2::ZERO, Vec2(1920.0f, 1200.0f));
+
+    if (view.IsVisible(backgroundBounds))
+    {
+        g_thePipelineStateCache->SetModelConstants();
+        g_thePipelineStateCache->Bind(m_attractBackgroundState);
+        m_attractBackgroundMesh.Draw();
+    }
+
+    Vec2 const discCenter = Vec2(SCREEN_SIZE_X * 0.5f + m_position.x, SCREEN_SIZE_Y * 0.5f + m_position.y);
+
+    if (view.IsVisible(AABB2(discCenter - Vec2(DISC_RADIUS, DISC_RADIUS), discCenter + Vec2(DISC_RADIUS, DISC_RADIUS))))
+    {
+        int const lodBucket = GetShapeLODBucket(GetSegmentCountForProjectedRadius(view.GetProjectedLength(DISC_RADIUS)));
+
+        g_thePipelineStateCache->SetModelConstants(Mat44::MakeTranslation2D(discCenter));
+        g_thePipelineStateCache->Bind(m_untexturedState);
+        m_discMeshes[lodBucket].Draw();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::RenderGame(sRenderView const& view) const
+{
+    AABB2 const backgroundBounds(Vec2::ZERO, Vec2(1920.0f, 1200.0f));
+
+    if (view.IsVisible(backgroundBounds))
+    {
+        g_thePipelineStateCache->SetModelConstants();
+        g_thePipelineStateCache->Bind(m_gameBackgroundState);
+        m_gameBackgroundMesh.Draw();
+    }
+
+    // The cross always spans the full scene, so it is bounded by the scene rect minus its inset.
+    if (view.IsVisible(AABB2(m_retainedSceneBounds.m_mins + Vec2(95.f, 95.f), m_retainedSceneBounds.m_maxs - Vec2(95.f, 95.f))))
+    {
+        g_thePipelineStateCache->SetModelConstants();
+        g_thePipelineStateCache->Bind(m_untexturedState);
+        m_crossMesh.Draw();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Typically only the last digit or two of each value changes, so most glyphs keep their quads.
+//
+void Game::UpdateDebugText()
+{
+    double const totalSeconds = m_gameClock->GetTotalSeconds();
+    double const fps          = 1.0 / m_gameClock->GetDeltaSeconds();
+    float const  timeScale    = m_gameClock->GetTimeScale();
+
+    g_theRetainedDebugText->Format(m_clockTextTopRight, "Time: %.2f\nFPS: %.2f\nScale: %.1f", totalSeconds, fps, timeScale);
+    g_theRetainedDebugText->Format(m_clockTextBottomLeft, "Time: %.2f\nFPS: %.2f\nScale: %.1f", totalSeconds, fps, timeScale);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::RenderDebugText() const
+{
+    g_theRetainedDebugText->Render();
 }
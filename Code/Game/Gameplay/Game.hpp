@@ -8,6 +8,16 @@
 
 #include "Engine/Core/EventSystem.hpp"
 #include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Game/Framework/AssetRegistry.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+#include "Game/Framework/GameEventBus.hpp"
+#include "Game/Framework/GameEvents.hpp"
+#include "Game/Framework/PipelineState.hpp"
+#include "Game/Framework/RenderView.hpp"
+#include "Game/Framework/RetainedDebugText.hpp"
+#include "Game/Framework/RetainedMesh.hpp"
+#include "Game/Framework/ShapeTessellation.hpp"
 
 //-Forward-Declaration--------------------------------------------------------------------------------
 class Camera;
@@ -20,6 +30,15 @@ enum class eGameState : int8_t
     GAME
 };
 
+//----------------------------------------------------------------------------------------------------
+struct sGameStateChangedEvent
+{
+    static constexpr sEventId ID = sEventId("GameStateChanged");
+
+    eGameState m_previousState = eGameState::ATTRACT;
+    eGameState m_newState      = eGameState::ATTRACT;
+};
+
 //----------------------------------------------------------------------------------------------------
 class Game
 {
@@ -29,22 +48,54 @@ public:
 
     void Update();
     void Render() const;
+    void RenderView(sRenderView const& view) const;
 
-    static bool OnGameStateChanged(EventArgs& args);
-    static bool OnWindowSizeChanged(EventArgs& args);
+    static bool OnGameStateChanged(sGameStateChangedEvent const& event);
+    static bool OnWindowSizeChanged(sWindowSizeChangedEvent const& event);
 
     eGameState GetCurrentGameState() const;
     void       ChangeGameState(eGameState newGameState);
+    void       SetFixedTimestep(float stepSeconds);
+    void       SetFixedFrameDelta(double frameDeltaSeconds);
     Vec2 m_position = Vec2::ZERO;
     Vec2 m_windowPosition = Vec2::ZERO;
 private:
     void UpdateFromInput();
+    void UpdateSimulation(float deltaSeconds);
     void AdjustForPauseAndTimeDistortion();
-    void RenderAttractMode() const;
-    void RenderGame() const;
+    double GetFrameDeltaSeconds() const;
+    void UpdateRetainedGeometry();
+    void UpdateDebugText();
+    void CreatePipelineStates();
+    void RenderAttractMode(sRenderView const& view) const;
+    void RenderGame(sRenderView const& view) const;
+    void RenderDebugText() const;
+
+    Camera*     m_screenCamera = nullptr;
+    sRenderView m_screenView;
+    eGameState  m_gameState    = eGameState::ATTRACT;
+    Clock*      m_gameClock    = nullptr;
+
+    sFixedTimestepAccumulator m_simulationTimestep;
+    bool                      m_isFixedTimestepEnabled = false;
+    double                    m_fixedFrameDeltaSeconds = 0.0;     // > 0 replaces the wall-clock frame delta (input replay)
+
+    // Built once on the GPU; rebuilt only when the scene bounds they were built for change.
+    RetainedMesh m_attractBackgroundMesh;           // Separate meshes: each carries its own atlas UVs
+    RetainedMesh m_gameBackgroundMesh;
+    RetainedMesh m_discMeshes[SHAPE_LOD_BUCKET_COUNT];     // One per LOD bucket, centered on the origin; placed with model constants
+    RetainedMesh m_crossMesh;
+    AABB2        m_retainedSceneBounds;
+    bool         m_isRetainedGeometryDirty = true;
+
+    PipelineState  m_attractBackgroundState;
+    PipelineState  m_gameBackgroundState;
+    PipelineState  m_untexturedState;
+    sTextureHandle m_attractBackgroundTexture;
+    sTextureHandle m_gameBackgroundTexture;
+    sSoundHandle   m_clickSound;
 
-    Camera*    m_screenCamera = nullptr;
-    eGameState m_gameState    = eGameState::ATTRACT;
-    Clock*     m_gameClock    = nullptr;
+    sDebugTextHandle m_clockTextTopRight;
+    sDebugTextHandle m_clockTextBottomLeft;
 
 };